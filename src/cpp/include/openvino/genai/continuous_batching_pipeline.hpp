@@ -15,6 +15,7 @@
 #include "openvino/genai/llm_pipeline.hpp"
 #include "openvino/genai/streamer_base.hpp"
 #include "openvino/genai/visibility.hpp"
+#include "openvino/genai/kv_cache_snapshot.hpp"
 #include "cache_eviction.hpp"
 
 namespace ov::genai {
@@ -48,6 +49,17 @@ struct PipelineMetrics {
     * Running average of the KV cache usage during the lifetime of the pipeline, with max window size of 1000 steps
     */
     float avg_cache_usage = 0.0;
+
+    /**
+    * Number of requests stopped or cancelled via their handles, which were released before the next generation step
+    */
+    size_t cancelled_requests = 0;
+
+    /**
+    * Number of tokens which were not computed because their requests were stopped or cancelled via handles: prompt tokens
+    * which were not processed yet and next tokens of running sequences
+    */
+    size_t cancelled_tokens_saved = 0;
 };
 
 class OPENVINO_GENAI_EXPORTS ContinuousBatchingPipeline {
@@ -59,11 +71,13 @@ protected:
     class ContinuousBatchingForPromptLookupImpl;
     class SpeculativeDecodingImpl;
     class PromptLookupImpl;
+    class DisaggregatedImpl;
 
     friend class ContinuousBatchingForSpeculativeDecodingImpl;
     friend class ContinuousBatchingForPromptLookupImpl;
     friend class SpeculativeDecodingImpl;
     friend class PromptLookupImpl;
+    friend class DisaggregatedImpl;
 
     std::shared_ptr<IContinuousBatchingPipeline> m_impl;
 
@@ -132,6 +146,42 @@ public:
     GenerationHandle add_request(uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& sampling_params);
     GenerationHandle add_request(uint64_t request_id, const std::string& prompt, const ov::genai::GenerationConfig& sampling_params);
 
+    /**
+     * @brief Sets queue which reports ids of requests with new outputs or changed status, so that a single thread can
+     * serve handles of all requests. Applies to requests added after the call, nullptr disables reporting.
+     * @param completion_queue Queue shared by requests, it might be shared by several pipelines if request ids are unique.
+     */
+    void set_completion_queue(std::shared_ptr<GenerationCompletionQueue> completion_queue);
+
+    /**
+     * @brief Adds a request which resumes a conversation parked via `park_kv_cache`.
+     *
+     * KV cache of the longest common prefix of `input_ids` and `snapshot.token_ids` is copied into freshly allocated
+     * KV cache blocks, so only the remaining prompt tokens are prefilled. If the KV cache cannot fit the snapshot,
+     * the whole prompt is processed as for a regular request.
+     * @param request_id Identifier of the request.
+     * @param input_ids Full prompt of the resumed conversation.
+     * @param sampling_params Generation config of the request.
+     * @param snapshot KV cache snapshot obtained via `take_kv_cache_snapshot` or `KVCacheSnapshot::load`.
+     */
+    GenerationHandle add_request(uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& sampling_params, const KVCacheSnapshot& snapshot);
+
+    /**
+     * @brief Requests to keep KV cache of a request once it is finished or stopped.
+     *
+     * Before the request's KV cache blocks are released, the blocks of its best sequence are copied to host memory
+     * together with the corresponding token ids. The copy is retrieved via `take_kv_cache_snapshot`.
+     * @param request_id Identifier of a request added via `add_request`.
+     */
+    void park_kv_cache(uint64_t request_id);
+
+    /**
+     * @brief Retrieves the KV cache snapshot of a parked request and releases it from the pipeline.
+     * @param request_id Identifier of a request previously passed to `park_kv_cache`.
+     * @return Snapshot of the request's KV cache. Throws if the request has not finished yet or was cancelled.
+     */
+    KVCacheSnapshot take_kv_cache_snapshot(uint64_t request_id);
+
     void step();
 
     bool has_non_finished_requests();
@@ -151,4 +201,38 @@ public:
     */
     void finish_chat();
 };
+
+/**
+* @brief decode_device property enables prefill / decode disaggregation in ContinuousBatchingPipeline.
+* Prompts are processed by a dedicated prefill instance of the model on the pipeline device, after which
+* KV cache of each request is transferred to a decode instance created on `decode_device`, which generates tokens.
+* This way long prompts do not delay token generation of already running requests.
+* Both devices must use the same KV cache block size, layout and precision.
+*/
+static constexpr ov::Property<std::string> decode_device{"decode_device"};
+
+/**
+* @brief decode_properties property sets properties passed to ov::Core::compile_model for the decode instance
+* when prefill / decode disaggregation is enabled, e.g. to pin it to different CPU cores.
+* If not set, the pipeline properties are used.
+*/
+static constexpr ov::Property<ov::AnyMap> decode_properties{"decode_properties"};
+
+/**
+* @brief num_infer_requests property enables data parallel step execution in ContinuousBatchingPipeline on CPU.
+* The model is compiled with `num_infer_requests` streams (unless ov::num_streams is set explicitly) and each step
+* splits the scheduled batch into up to `num_infer_requests` sub-batches, which are inferred concurrently
+* on infer requests sharing the same KV cache. It helps to utilize many-core machines on small decode batches.
+* Cannot be used together with cache eviction or LoRA adapters.
+*/
+static constexpr ov::Property<size_t> num_infer_requests{"num_infer_requests"};
+
+/**
+* @brief logits_top_k property makes the model compute top `logits_top_k` logits and their token ids in addition to
+* full vocabulary logits. Steps where all scheduled requests use greedy decoding or multinomial sampling with
+* top_k <= logits_top_k (without top_p, penalties, min_new_tokens, log probs and echo) are sampled from these candidates only,
+* which avoids scanning the whole vocabulary on the host. In case of multinomial sampling, log probabilities of generated
+* tokens are normalized over the candidates.
+*/
+static constexpr ov::Property<size_t> logits_top_k{"logits_top_k"};
 }
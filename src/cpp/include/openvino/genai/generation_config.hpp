@@ -5,6 +5,7 @@
 
 #include <filesystem>
 #include <limits>
+#include <optional>
 #include <variant>
 #include <string>
 
@@ -25,6 +26,23 @@ namespace genai {
  */
 enum class StopCriteria { EARLY, HEURISTIC, NEVER };
 
+/**
+ * @brief Structure to keep parameters of structured output generation. Generated text is constrained to match
+ * exactly one of the following descriptions:
+ * @param json_schema JSON schema of the generated JSON document.
+ * @param regex regular expression which generated text must fully match.
+ * @param grammar EBNF grammar in GBNF notation with `root` start rule. Recursive rules are not supported.
+ */
+class OPENVINO_GENAI_EXPORTS StructuredOutputConfig {
+public:
+    std::optional<std::string> json_schema;
+    std::optional<std::string> regex;
+    std::optional<std::string> grammar;
+
+    /// @throws Exception if not exactly one of the parameters is set.
+    void validate() const;
+};
+
 /**
  * @brief Structure to keep generation config parameters. For a selected method of decoding, only parameters from that group
  * and generic parameters are used. For example, if do_sample is set to true, then only generic parameters and random sampling parameters will
@@ -70,7 +88,9 @@ enum class StopCriteria { EARLY, HEURISTIC, NEVER };
  * @param temperature the value used to modulate token probabilities for random sampling.
  * @param top_p - if set to float < 1, only the smallest set of most probable tokens with probabilities that add up to top_p or higher are kept for generation.
  * @param top_k the number of highest probability vocabulary tokens to keep for top-k-filtering.
- * @param rng_seed initializes random generator.
+ * @param rng_seed initializes random generator of a request. Random streams are derived from rng_seed, request id, token position
+ * and the number of generate() calls made by the pipeline, so results of random sampling do not depend on other requests processed
+ * in the same batch, while consecutive generate() calls of the same pipeline produce different samples.
  * @param num_return_sequences the number of sequences to generate from a single prompt.
  *
  * Assisting generation parameters:
@@ -79,6 +99,9 @@ enum class StopCriteria { EARLY, HEURISTIC, NEVER };
  * @param max_ngram_size is maximum ngram to use when looking for matches in the prompt.
  *
  * @param apply_chat_template whether or not to apply chat_template for non-chat scenarios
+ *
+ * @param structured_output_config if set, generated text is constrained by JSON schema, regular expression or grammar.
+ *        Not supported by beam search.
  */
 
 class OPENVINO_GENAI_EXPORTS GenerationConfig {
@@ -133,6 +156,8 @@ public:
     // set to true if chat template should be applied for non-chat scenarios, set to false otherwise
     bool apply_chat_template = true;
 
+    std::optional<StructuredOutputConfig> structured_output_config;
+
     /** @brief sets eos_token_id to tokenizer_eos_token_id if eos_token_id is less than 0.
      * Otherwise verifies eos_token_id == tokenizer_eos_token_id.
      */
@@ -196,6 +221,8 @@ static constexpr ov::Property<size_t> num_assistant_tokens{"num_assistant_tokens
 
 static constexpr ov::Property<bool> apply_chat_template{"apply_chat_template"};
 
+static constexpr ov::Property<StructuredOutputConfig> structured_output_config{"structured_output_config"};
+
 // Predefined Configs
 
 OPENVINO_DEPRECATED("Please, use individual parameters instead of predefined configs. This method will be removed in 2026.0.0 release")
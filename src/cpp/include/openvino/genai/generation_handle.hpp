@@ -3,8 +3,13 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "openvino/genai/generation_config.hpp"
 #include "openvino/genai/visibility.hpp"
@@ -73,6 +78,53 @@ using GenerationOutputs = std::unordered_map<uint64_t, GenerationOutput>;
 
 class GenerationStream;
 
+/**
+ * @brief Reports ids of requests whose GenerationHandle got new outputs or changed status, so that a single thread
+ * can serve many handles without polling each of them. Handles report to the queue after
+ * ContinuousBatchingPipeline::set_completion_queue or GenerationHandle::set_completion_queue call.
+ * Thread safe.
+ */
+class OPENVINO_GENAI_EXPORTS GenerationCompletionQueue {
+public:
+    GenerationCompletionQueue();
+    ~GenerationCompletionQueue();
+
+    GenerationCompletionQueue(const GenerationCompletionQueue&) = delete;
+    GenerationCompletionQueue& operator=(const GenerationCompletionQueue&) = delete;
+
+    /**
+     * @brief Waits until some requests are ready or timeout expires.
+     * @return ids of ready requests in the order they became ready, every id is returned once until it's ready again.
+     * Ready request has to be checked with GenerationHandle::can_read / read_available / get_status.
+     */
+    std::vector<uint64_t> wait(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Returns ids of ready requests without waiting.
+     */
+    std::vector<uint64_t> poll();
+
+    /**
+     * @brief File descriptor which is readable while there are ready requests, it can be added to epoll / poll / select
+     * of an event loop, ids are taken with poll(). Linux only, -1 on other platforms.
+     */
+    int get_fd() const;
+
+    /**
+     * @brief Marks the request as ready, called by the pipeline
+     */
+    void notify(uint64_t request_id);
+
+private:
+    std::vector<uint64_t> take_ready_requests();
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::vector<uint64_t> m_ready_requests;
+    std::unordered_set<uint64_t> m_ready_requests_set;
+    int m_event_fd = -1;
+};
+
 class OPENVINO_GENAI_EXPORTS 
 GenerationHandleImpl {
     std::shared_ptr<GenerationStream> m_generation_stream;
@@ -106,8 +158,18 @@ public:
 
     void cancel();
 
+    /**
+     * @brief Makes handle report to the queue when it gets new outputs or its status changes.
+     * The handle is reported immediately if it already has outputs to read or is finished.
+     * Can be set only once.
+     */
+    void set_completion_queue(std::shared_ptr<GenerationCompletionQueue> completion_queue, uint64_t request_id);
+
     // Reads result of a generation for single iteration
     GenerationOutputs read();
+    // Reads results of all iterations generated since the previous read merged per sequence, doesn't wait for new results.
+    // Returns empty outputs if there are no new results.
+    GenerationOutputs read_available();
     // Reads all generated tokens for all sequences
     std::vector<GenerationOutput> read_all();
 };
@@ -0,0 +1,57 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+#include "openvino/genai/visibility.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Host copy of the KV cache of a single sequence.
+ *
+ * A snapshot allows to park a conversation outside of the pipeline's KV cache, e.g. between chat turns,
+ * and resume it later via ContinuousBatchingPipeline::add_request without recomputing the parked tokens.
+ * The stored blocks are mapped into freshly allocated physical blocks on import.
+ */
+struct OPENVINO_GENAI_EXPORTS KVCacheSnapshot {
+    /**
+     * Tokens whose keys and values are stored in the snapshot.
+     * Only the longest common prefix of these tokens and the resumed prompt is restored.
+     */
+    std::vector<int64_t> token_ids;
+
+    /**
+     * Number of tokens per KV cache block. Must match the block size of the importing pipeline.
+     */
+    size_t block_size = 0;
+
+    /**
+     * Per decoder layer key cache blocks with shape [num_blocks, ...] in the device-specific KV cache layout.
+     */
+    std::vector<ov::Tensor> key_cache;
+
+    /**
+     * Per decoder layer value cache blocks with shape [num_blocks, ...] in the device-specific KV cache layout.
+     */
+    std::vector<ov::Tensor> value_cache;
+
+    /**
+     * @brief Serializes the snapshot into a binary file.
+     * @param path Path to the output file.
+     */
+    void save(const std::filesystem::path& path) const;
+
+    /**
+     * @brief Reads a snapshot previously written by save().
+     * @param path Path to the snapshot file.
+     */
+    static KVCacheSnapshot load(const std::filesystem::path& path);
+};
+
+}  // namespace ov::genai
@@ -5,6 +5,7 @@
 
 #include "openvino/genai/tokenizer.hpp"
 #include <variant>
+#include <vector>
 
 namespace ov {
 namespace genai {
@@ -44,5 +45,33 @@ public:
     virtual ~StreamerBase();
 };
 
+/// @brief New results of a single request of a batch passed to BatchStreamerBase
+struct BatchStreamingUpdate {
+    /// @brief index of the request in the batch passed to generate
+    size_t request_index = 0;
+    /// @brief tokens generated since the previous update of the request
+    std::vector<int64_t> tokens;
+    /// @brief text of the tokens, filled only by BatchTextStreamer
+    std::string text;
+    /// @brief the request is finished, it won't get new updates
+    bool finished = false;
+};
+
+/**
+ * @brief base class for streamers receiving results of all requests of a batch generated by ContinuousBatchingPipeline.
+ * Pass it to generate as StreamerVariant. Requests with beam search are streamed once they are finished, the best beam
+ * is streamed. Requests have to return a single sequence (num_return_sequences == 1).
+ * Other pipelines, speculative decoding and prompt lookup throw an exception when generate is called with it.
+ */
+class OPENVINO_GENAI_EXPORTS BatchStreamerBase : public StreamerBase {
+public:
+    /// @brief write is called once per generation step with updates of all requests which got new tokens or finished
+    /// @return StreamingStatus flag applied to all requests of the batch
+    virtual StreamingStatus write(const std::vector<BatchStreamingUpdate>& updates) = 0;
+
+    /// @brief tokens of a single sequence are never written to batch streamer
+    StreamingStatus write(int64_t token) override;
+};
+
 }  // namespace genai
 }  // namespace ov
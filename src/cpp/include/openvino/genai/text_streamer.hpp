@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <memory>
+#include <unordered_map>
+
 #include "openvino/genai/streamer_base.hpp"
 #include "openvino/genai/tokenizer.hpp"
 
@@ -23,6 +26,7 @@ class OPENVINO_GENAI_EXPORTS TextStreamer: public StreamerBase {
 
     std::function<CallbackTypeVariant(std::string)> m_subword_callback = [](std::string words)->bool { return false; };
     StreamingStatus run_callback_if_needed(const std::string& text);
+    std::string decode_tokens_cache(size_t num_tokens);
 
 public:
     StreamingStatus write(int64_t token) override;
@@ -32,10 +36,52 @@ public:
     TextStreamer(const Tokenizer& tokenizer, std::function<CallbackTypeVariant(std::string)> callback);
 
 protected:
+    /// @brief constructs streamer which decodes tokens with overridden decode() instead of a tokenizer
+    TextStreamer(std::function<CallbackTypeVariant(std::string)> callback, size_t delay_n_tokens);
+
+    /// @brief decodes tokens of the sliding window, Tokenizer::decode is used by default
+    virtual std::string decode(const std::vector<int64_t>& tokens);
+
     Tokenizer m_tokenizer;
+    // The first m_num_printed_tokens tokens are already printed and are kept as a context for decoding of the next tokens
     std::vector<int64_t> m_tokens_cache;
-    std::vector<int64_t> m_decoded_lengths;
+    size_t m_num_printed_tokens = 0;
+    // Length of decoded text of the first m_num_printed_tokens tokens
     size_t m_printed_len = 0;
+    // Number of the last tokens which are printed only after the next tokens are generated
+    size_t m_delay_n_tokens = 0;
+    // Texts of the first N tokens of the cache decoded while their last tokens were delayed, N => text
+    std::unordered_map<size_t, std::string> m_delayed_texts;
+};
+
+/**
+ * @brief BatchTextStreamer decodes tokens of every request of a batch into text incrementally, the same way
+ * as TextStreamer does, and calls a user-defined callback with updates of all requests once per generation step.
+ *
+ * @param tokenizer Tokenizer object to decode tokens into text.
+ * @param callback User-defined callback function to process updates with the decoded text, callback should return
+ * either boolean flag or StreamingStatus. Updates without new text are passed only if the request is finished.
+ */
+class OPENVINO_GENAI_EXPORTS BatchTextStreamer: public BatchStreamerBase {
+public:
+    using Callback = std::function<CallbackTypeVariant(const std::vector<BatchStreamingUpdate>&)>;
+
+    BatchTextStreamer(const Tokenizer& tokenizer, Callback callback);
+
+    StreamingStatus write(const std::vector<BatchStreamingUpdate>& updates) override;
+    using BatchStreamerBase::write;
+
+    void end() override;
+
+private:
+    Tokenizer m_tokenizer;
+    Callback m_callback;
+    // streamers of requests which are not finished yet
+    std::unordered_map<size_t, std::unique_ptr<TextStreamer>> m_request_streamers;
+    // text printed by streamer of the request which is being written
+    std::string m_request_text;
+
+    TextStreamer& get_request_streamer(size_t request_index);
 };
 
 }  // namespace genai
@@ -7,6 +7,7 @@
 #include <vector>
 #include <initializer_list>
 #include <filesystem>
+#include <future>
 
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/genai/visibility.hpp"
@@ -220,6 +221,54 @@ public:
         return decode(tokens, AnyMap{std::forward<Properties>(detokenization_params)...});
     }
 
+    /**
+    * @brief encode a prompt split into segments, e.g. a shared system prompt or few-shot preamble and a unique suffix.
+    * Segments are tokenized separately, so with tokenization_cache_size property set the shared segments are tokenized once.
+    * Segments should be split at boundaries which are not crossed by tokens, e.g. after new line symbols or special tokens.
+    * Every boundary is checked by tokenizing short texts around it. If tokens are merged across a boundary or the tokenizer
+    * adds a prefix to separately tokenized text (e.g. SentencePiece dummy prefix "▁"), the concatenated prompt is tokenized
+    * instead.
+    * @param segments vector of prompt parts, their concatenation is the prompt
+    * @param tokenization_params AnyMap with tokenization parameters, e.g. {{"add_special_tokens", false}}.
+    * Special tokens (e.g. BOS, EOS) are added once around the whole sequence. Prompts with other parameters,
+    * e.g. max_length or pad_to_max_length, are tokenized as a whole.
+    * @return pair of [input_ids, attention_mask] of shape [1, num_tokens]
+    */
+    TokenizedInputs encode_segments(const std::vector<std::string>& segments, const ov::AnyMap& tokenization_params = {});
+
+    /**
+    * @brief encode a single prompt asynchronously. Concurrent calls are spread across infer requests of tokenizer,
+    * their number is set by ov::genai::num_tokenizer_infer_requests property
+    * @param prompt std::string with input prompt
+    * @param tokenization_params AnyMap with tokenization parameters, e.g. {{"add_special_tokens", false}, {"max_length", 128}}
+    * @return future of pair of [input_ids, attention_mask]
+    */
+    std::future<TokenizedInputs> encode_async(std::string prompt, const ov::AnyMap& tokenization_params = {});
+
+    /**
+    * @brief encode batch of prompts asynchronously
+    * @param prompts vector storing batch of prompts
+    * @param tokenization_params AnyMap with tokenization parameters, e.g. {{"add_special_tokens", false}, {"max_length", 128}}
+    * @return future of pair of [input_ids, attention_mask]
+    */
+    std::future<TokenizedInputs> encode_async(std::vector<std::string> prompts, const ov::AnyMap& tokenization_params = {});
+
+    /**
+    * @brief decode sequence of tokens asynchronously
+    * @param tokens vector storing tokens
+    * @param detokenization_params AnyMap with detokenization parameters, e.g. {"skip_special_tokens", false}
+    * @return future of sequence string
+    */
+    std::future<std::string> decode_async(std::vector<int64_t> tokens, const ov::AnyMap& detokenization_params = {});
+
+    /**
+    * @brief batched decoding of tokens asynchronously
+    * @param tokens vector of vectors with tokens, tokens.size() is equal to batch_size
+    * @param detokenization_params AnyMap with detokenization parameters, e.g. {"skip_special_tokens", false}
+    * @return future of vector of std::string, with size equal to batch_size
+    */
+    std::future<std::vector<std::string>> decode_async(std::vector<std::vector<int64_t>> tokens, const ov::AnyMap& detokenization_params = {});
+
     /**
      * @brief Embeds input prompts with special tags for a chat scenario.
      *
@@ -253,6 +302,19 @@ public:
     std::string get_eos_token() const;
     std::string get_pad_token() const;
 
+    /**
+     * @brief Raw bytes of every token indexed by token id, e.g. " Hello" for SentencePiece token "▁Hello".
+     * The table is extracted from detokenizer model on the first use and allows decoding without model inference.
+     * @return Empty vector if detokenizer is not supported by the table, decode infers detokenizer model in this case
+     */
+    const std::vector<std::string>& get_vocab_vector() const;
+
+    /**
+     * @brief Flags of special tokens which are removed by decode with skip_special_tokens(true), indexed by token id.
+     * @return Empty vector if get_vocab_vector() is empty
+     */
+    const std::vector<bool>& get_special_tokens_mask() const;
+
     Tokenizer() = default;
     ~Tokenizer();
 private:
@@ -264,5 +326,18 @@ static constexpr ov::Property<bool> add_special_tokens{"add_special_tokens"};
 static constexpr ov::Property<bool> skip_special_tokens{"skip_special_tokens"};
 static constexpr ov::Property<bool> pad_to_max_length{"pad_to_max_length"};
 
+/**
+ * @brief Number of infer requests of tokenizer and detokenizer models, i.e. the number of encode/decode calls executed
+ * concurrently. ov::optimal_number_of_infer_requests of compiled models is used by default.
+ * Unless ov::num_streams is passed to Tokenizer explicitly, the number of streams is set equal to this value.
+ */
+static constexpr ov::Property<size_t> num_tokenizer_infer_requests{"num_tokenizer_infer_requests"};
+
+/**
+ * @brief Number of single prompt encoding results kept in LRU cache of Tokenizer, keyed by prompt and tokenization
+ * parameters. Repeated prompts and segments of Tokenizer::encode_segments are tokenized once. Disabled (0) by default.
+ */
+static constexpr ov::Property<size_t> tokenization_cache_size{"tokenization_cache_size"};
+
 }  // namespace genai
 }  // namespace ov
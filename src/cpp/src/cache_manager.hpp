@@ -19,7 +19,8 @@ class CacheManager {
     std::vector<ov::PartialShape> m_key_shapes, m_value_shapes;
     std::vector<ov::Tensor> m_key_cache, m_value_cache;
     size_t m_num_allocated_kv_blocks = 0, m_block_size_in_bytes = 0;
-    ov::InferRequest m_request;
+    // all requests share the same KV cache tensors
+    std::vector<ov::InferRequest> m_requests;
     size_t m_k_head_size = 0;
 
     static ov::Shape set_kv_blocks(ov::PartialShape pshape, size_t num_kv_blocks) {
@@ -28,8 +29,10 @@ class CacheManager {
     }
 
     void update_request_tensor(size_t decoder_layer_id) {
-        m_request.set_tensor(std::string("key_cache.") + std::to_string(decoder_layer_id), m_key_cache[decoder_layer_id]);
-        m_request.set_tensor(std::string("value_cache.") + std::to_string(decoder_layer_id), m_value_cache[decoder_layer_id]);
+        for (auto& request : m_requests) {
+            request.set_tensor(std::string("key_cache.") + std::to_string(decoder_layer_id), m_key_cache[decoder_layer_id]);
+            request.set_tensor(std::string("value_cache.") + std::to_string(decoder_layer_id), m_value_cache[decoder_layer_id]);
+        }
     }
 
     ov::PartialShape to_partial_shape(const KVHeadConfig& config, ov::element::Type cache_type, bool key_param) {
@@ -82,11 +85,52 @@ class CacheManager {
         return pshape;
     }
 
+    static ov::Tensor get_block_roi(const ov::Tensor& cache, size_t block_id) {
+        ov::Coordinate start_roi(cache.get_shape().size(), 0);
+        ov::Coordinate end_roi = cache.get_shape();
+        end_roi[0] = (start_roi[0] = block_id) + 1;
+        return ov::Tensor(cache, start_roi, end_roi);
+    }
+
+    // KV cache on GPU is a remote tensor, its ROIs are remote tensors as well and are copied from / to host tensors
+    void copy_block_to_host(const ov::Tensor& cache, size_t block_id, ov::Tensor& dst) const {
+        if (m_device.find("GPU") == std::string::npos) {
+            get_block_roi(cache, block_id).copy_to(dst);
+            return;
+        }
+        ov::Coordinate start_roi(cache.get_shape().size(), 0);
+        ov::Coordinate end_roi = cache.get_shape();
+        end_roi[0] = (start_roi[0] = block_id) + 1;
+        ov::RemoteTensor src_roi(cache, start_roi, end_roi);
+        src_roi.copy_to(dst);
+    }
+
+    void copy_block_from_host(const ov::Tensor& src, ov::Tensor& cache, size_t block_id) {
+        if (m_device.find("GPU") == std::string::npos) {
+            ov::Tensor dst_roi = get_block_roi(cache, block_id);
+            src.copy_to(dst_roi);
+            return;
+        }
+        ov::Coordinate start_roi(cache.get_shape().size(), 0);
+        ov::Coordinate end_roi = cache.get_shape();
+        end_roi[0] = (start_roi[0] = block_id) + 1;
+        ov::RemoteTensor dst_roi(cache, start_roi, end_roi);
+        dst_roi.copy_from(src);
+    }
+
 public:
     CacheManager(ov::InferRequest request, const std::vector<KVHeadConfig>& kv_cache_config) :
-        m_request(request) {
+        CacheManager(std::vector<ov::InferRequest>{request}, kv_cache_config) {}
+
+    /**
+     * Constructs the CacheManager, which binds the same KV cache tensors to all the given infer requests.
+     * All requests must be created from the same compiled model.
+     */
+    CacheManager(const std::vector<ov::InferRequest>& requests, const std::vector<KVHeadConfig>& kv_cache_config) :
+        m_requests(requests) {
+        OPENVINO_ASSERT(!m_requests.empty(), "CacheManager requires at least one infer request");
         // extract information about inference device
-        ov::CompiledModel compiled_model = request.get_compiled_model();
+        ov::CompiledModel compiled_model = m_requests.front().get_compiled_model();
         std::vector<std::string> execution_devices = compiled_model.get_property(ov::execution_devices);
         OPENVINO_ASSERT(execution_devices.size() == 1, "Contituous batching: execution device is expected to be CPU or GPU, but got ", execution_devices.size(), " devices");
         m_device = execution_devices[0];
@@ -206,7 +250,7 @@ public:
                 update_request_tensor(decoder_layer_id);
             }
         } else {
-            auto remote_context = m_request.get_compiled_model().get_context();
+            auto remote_context = m_requests.front().get_compiled_model().get_context();
 
             for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
                 ov::Shape value_cache_shape = set_kv_blocks(m_value_shapes[decoder_layer_id], num_kv_blocks);
@@ -285,6 +329,53 @@ public:
             }
         }
     }
+
+    /**
+     * Copies the content of the given physical blocks of a decoder layer to host memory.
+     * @param decoder_layer_id Index of the decoder layer.
+     * @param block_ids Physical block indices in the order they should be stored.
+     * @return Pair of host key and value tensors of shape [block_ids.size(), ...] in the device-specific cache layout.
+     * Blocks of KV cache allocated on GPU are copied from device memory.
+     */
+    std::pair<ov::Tensor, ov::Tensor> export_blocks(size_t decoder_layer_id, const std::vector<size_t>& block_ids) const {
+        OPENVINO_ASSERT(decoder_layer_id < m_key_cache.size(), "decoder_layer_id = ", decoder_layer_id, ", num_layers = ", m_key_cache.size());
+        ov::Tensor key_blocks(get_key_cache_precision(decoder_layer_id), set_kv_blocks(m_key_shapes[decoder_layer_id], block_ids.size()));
+        ov::Tensor value_blocks(get_value_cache_precision(decoder_layer_id), set_kv_blocks(m_value_shapes[decoder_layer_id], block_ids.size()));
+
+        for (size_t i = 0; i < block_ids.size(); ++i) {
+            OPENVINO_ASSERT(block_ids[i] < m_num_allocated_kv_blocks, "Block ", block_ids[i], " is out of allocated KV cache range");
+            ov::Tensor key_dst_roi = get_block_roi(key_blocks, i);
+            ov::Tensor value_dst_roi = get_block_roi(value_blocks, i);
+            copy_block_to_host(m_key_cache[decoder_layer_id], block_ids[i], key_dst_roi);
+            copy_block_to_host(m_value_cache[decoder_layer_id], block_ids[i], value_dst_roi);
+        }
+
+        return {key_blocks, value_blocks};
+    }
+
+    /**
+     * Writes blocks previously obtained via `export_blocks` into the given physical blocks of a decoder layer.
+     * @param decoder_layer_id Index of the decoder layer.
+     * @param block_ids Destination physical block indices, block_ids[i] receives the i-th stored block.
+     * @param key_blocks Host key tensor of shape [N, ...] where N >= block_ids.size().
+     * @param value_blocks Host value tensor of shape [N, ...] where N >= block_ids.size().
+     */
+    void import_blocks(size_t decoder_layer_id, const std::vector<size_t>& block_ids, const ov::Tensor& key_blocks, const ov::Tensor& value_blocks) {
+        OPENVINO_ASSERT(decoder_layer_id < m_key_cache.size(), "decoder_layer_id = ", decoder_layer_id, ", num_layers = ", m_key_cache.size());
+        OPENVINO_ASSERT(key_blocks.get_element_type() == get_key_cache_precision(decoder_layer_id) &&
+                        value_blocks.get_element_type() == get_value_cache_precision(decoder_layer_id),
+                        "KV cache precision of imported blocks does not match the pipeline KV cache precision");
+        OPENVINO_ASSERT(m_key_shapes[decoder_layer_id].compatible(key_blocks.get_shape()) &&
+                        m_value_shapes[decoder_layer_id].compatible(value_blocks.get_shape()),
+                        "KV cache layout of imported blocks does not match the pipeline KV cache layout");
+        OPENVINO_ASSERT(key_blocks.get_shape()[0] >= block_ids.size() && value_blocks.get_shape()[0] >= block_ids.size());
+
+        for (size_t i = 0; i < block_ids.size(); ++i) {
+            OPENVINO_ASSERT(block_ids[i] < m_num_allocated_kv_blocks, "Block ", block_ids[i], " is out of allocated KV cache range");
+            copy_block_from_host(get_block_roi(key_blocks, i), m_key_cache[decoder_layer_id], block_ids[i]);
+            copy_block_from_host(get_block_roi(value_blocks, i), m_value_cache[decoder_layer_id], block_ids[i]);
+        }
+    }
 };
 
 }
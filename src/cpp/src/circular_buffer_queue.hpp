@@ -3,34 +3,30 @@
 
 #pragma once
 
-#include <queue>
+#include <condition_variable>
+#include <functional>
 #include <mutex>
-#include <future>
-#include <algorithm>
-#include <atomic>
+#include <numeric>
+#include <vector>
 
 namespace ov::genai {
 
-// From OVMS:
-// https://github.com/openvinotoolkit/model_server/blob/d73e85cbb8ac1d761754cb2064a00551a9ffc655/src/queue.hpp#L34
+// Pool of reusable elements (e.g. infer requests). Acquiring waits on a condition variable until some element
+// is returned, idle elements are reused in LIFO order, so the most recently used element is taken first.
 template <typename T>
 class CircularBufferQueue
 {
-    int m_front_idx;
-    std::atomic<int> m_back_idx;
-    std::vector<int> m_values;
-    std::queue<std::promise<int>> m_promises;
+    std::vector<int> m_idle_values;
     std::vector<T> m_data;
-    std::mutex m_front_mut;
-    std::mutex m_queue_mutex;
+    std::mutex m_mutex;
+    std::condition_variable m_idle_cv;
 
 public:
 
-    CircularBufferQueue(size_t length, const std::function<T()>& create_fn) :
-        m_values(length),
-        m_front_idx{0},
-        m_back_idx{0} {
-        std::iota(m_values.begin(), m_values.end(), 0);
+    CircularBufferQueue(size_t length, const std::function<T()>& create_fn) {
+        m_idle_values.resize(length);
+        // reversed, so that the first element is taken first
+        std::iota(m_idle_values.rbegin(), m_idle_values.rend(), 0);
         m_data.reserve(length);
         for (size_t i = 0; i < length; i++) {
             m_data.emplace_back(std::move(create_fn()));
@@ -45,40 +41,27 @@ public:
         return m_data[value];
     }
 
-    std::future<int> get_idle() {
-        int value;
-        std::promise<int> idle_promise;
-        std::future<int> idle_future = idle_promise.get_future();
-        std::unique_lock<std::mutex> lk(m_front_mut);
-        if (m_values[m_front_idx] < 0) {
-            std::unique_lock<std::mutex> queueLock(m_queue_mutex);
-            m_promises.push(std::move(idle_promise));
-        } else {
-            value = m_values[m_front_idx];
-            m_values[m_front_idx] = -1;
-            m_front_idx = (m_front_idx + 1) % m_values.size();
-            lk.unlock();
-            idle_promise.set_value(value);
-        }
-        return idle_future;
+    size_t size() const {
+        return m_data.size();
+    }
+
+    // blocks until some element is idle
+    int get_idle() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_idle_cv.wait(lock, [this] {
+            return !m_idle_values.empty();
+        });
+        int value = m_idle_values.back();
+        m_idle_values.pop_back();
+        return value;
     }
 
     void return_to(int value) {
-        std::unique_lock<std::mutex> lk(m_queue_mutex);
-        if (m_promises.size()) {
-            std::promise<int> promise = std::move(m_promises.front());
-            m_promises.pop();
-            lk.unlock();
-            promise.set_value(value);
-            return;
-        }
-        int old_back = m_back_idx.load();
-        while (!m_back_idx.compare_exchange_weak(
-            old_back,
-            (old_back + 1) % m_values.size(),
-            std::memory_order_relaxed)) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_idle_values.push_back(value);
         }
-        m_values[old_back] = value;
+        m_idle_cv.notify_one();
     }
 };
 
@@ -88,7 +71,7 @@ class CircularBufferQueueElementGuard {
     int m_value;
 public:
     CircularBufferQueueElementGuard(CircularBufferQueue<T>* queue) : m_queue(queue) {
-        m_value = m_queue->get_idle().get();   // blocking until we get the element
+        m_value = m_queue->get_idle();   // blocking until we get the element
     }
 
     T& get() {
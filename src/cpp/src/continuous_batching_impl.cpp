@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <atomic>
+#include <condition_variable>
+#include <future>
 #include <thread>
 
 #include "openvino/genai/text_streamer.hpp"
@@ -10,6 +12,7 @@
 #include "paged_attention_transformations.hpp"
 #include "lora_helper.hpp"
 #include "cache_state_dumper.hpp"
+#include "sampler_kernels.hpp"
 #include "utils.hpp"
 
 namespace {
@@ -118,7 +121,18 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::ContinuousBatchingImpl(
     auto kv_cache_config = utils::apply_paged_attention_transformations(model, is_need_per_layer_cache_control, allow_cache_rotation);
     utils::apply_gather_before_matmul_transformation(model);
 
-    initialize_pipeline(model, scheduler_config, device, properties, kv_cache_config);
+    // optionally compute candidate logits on the model side, so that sampler does not scan the whole vocabulary
+    ov::AnyMap filtered_properties = properties;
+    auto logits_top_k_it = filtered_properties.find(ov::genai::logits_top_k.name());
+    if (logits_top_k_it != filtered_properties.end()) {
+        const size_t num_logits_candidates = logits_top_k_it->second.as<size_t>();
+        filtered_properties.erase(logits_top_k_it);
+        if (num_logits_candidates > 0) {
+            utils::apply_topk_logits_transformation(model, num_logits_candidates);
+        }
+    }
+
+    initialize_pipeline(model, scheduler_config, device, filtered_properties, kv_cache_config);
 }
 
 ContinuousBatchingPipeline::ContinuousBatchingImpl::~ContinuousBatchingImpl() {
@@ -129,6 +143,10 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::~ContinuousBatchingImpl() {
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_pull_awaiting_requests() {
     std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+    for (const auto& [sequence_group, snapshot] : m_awaiting_kv_cache_imports) {
+        _import_kv_cache(sequence_group, snapshot);
+    }
+    m_awaiting_kv_cache_imports.clear();
     m_requests.insert(m_requests.end(), m_awaiting_requests.begin(), m_awaiting_requests.end());
     m_awaiting_requests.clear();
     m_pipeline_metrics.requests = m_requests.size();
@@ -153,6 +171,24 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
         sampler_num_threads = sampler_num_threads_it->second.as<size_t>();
         filtered_properties.fork().erase("sampler_num_threads");   // do not use iterator sampler_num_threads_it because a forked container may not be the same container
     }
+    // Extract num_infer_requests property if exists and remove it from properties
+    size_t num_infer_requests = 1;
+    auto num_infer_requests_it = filtered_properties->find(ov::genai::num_infer_requests.name());
+    if (num_infer_requests_it != filtered_properties->end()) {
+        num_infer_requests = num_infer_requests_it->second.as<size_t>();
+        filtered_properties.fork().erase(ov::genai::num_infer_requests.name());
+    }
+    OPENVINO_ASSERT(num_infer_requests > 0, "num_infer_requests must be positive");
+    if (num_infer_requests > 1) {
+        OPENVINO_ASSERT(device.find("CPU") != std::string::npos, "Data parallel step execution over multiple infer requests is supported only on CPU");
+        OPENVINO_ASSERT(!scheduler_config.use_cache_eviction, "Data parallel step execution over multiple infer requests cannot be used together with cache eviction");
+        // AdapterController tracks state of a single infer request
+        OPENVINO_ASSERT(!m_adapter_controller, "Data parallel step execution over multiple infer requests cannot be used together with LoRA adapters");
+        // each sub-batch is inferred by its own CPU stream
+        if (filtered_properties->find(ov::num_streams.name()) == filtered_properties->end()) {
+            filtered_properties.fork()[ov::num_streams.name()] = ov::streams::Num(static_cast<int32_t>(num_infer_requests));
+        }
+    }
 
     // TODO: remove once plugin automatically set KV cache precisions
     apply_kv_cache_precision(model, device, *filtered_properties);
@@ -160,10 +196,14 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
     ov::CompiledModel compiled_model = utils::singleton_core().compile_model(model, device, *filtered_properties);
 
     ov::genai::utils::print_compiled_model_properties(compiled_model, "LLM with Paged Attention");
-    ov::InferRequest infer_request = compiled_model.create_infer_request();
+    std::vector<ov::InferRequest> infer_requests;
+    for (size_t i = 0; i < num_infer_requests; ++i) {
+        infer_requests.push_back(compiled_model.create_infer_request());
+    }
+    ov::InferRequest infer_request = infer_requests.front();
 
     // Cache manager
-    std::shared_ptr<CacheManager> cache_manager = std::make_shared<CacheManager>(infer_request, kv_cache_config);
+    std::shared_ptr<CacheManager> cache_manager = std::make_shared<CacheManager>(infer_requests, kv_cache_config);
     m_num_decoder_layers = cache_manager->get_num_decoder_layers();
     m_block_size = cache_manager->get_block_size();
 
@@ -228,11 +268,10 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
         }
     } else {
         m_model_runner =
-            std::make_shared<ModelRunner>(infer_request, m_block_size, m_num_decoder_layers);
+            std::make_shared<ModelRunner>(infer_requests, m_block_size, m_num_decoder_layers);
     }
 
     m_sampler = std::make_shared<Sampler>(m_tokenizer, sampler_num_threads);
-    m_sampler->set_seed(m_generation_config.rng_seed);
 
     // If eos_token_id was not provided, take value
     if (m_generation_config.eos_token_id == -1)
@@ -240,10 +279,10 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
 };
 
 
-GenerationHandle
-ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request_id,
-                                                               const ov::Tensor& input_ids,
-                                                               ov::genai::GenerationConfig sampling_params) {
+SequenceGroup::Ptr
+ContinuousBatchingPipeline::ContinuousBatchingImpl::_create_sequence_group(uint64_t request_id,
+                                                                           const ov::Tensor& input_ids,
+                                                                           ov::genai::GenerationConfig sampling_params) {
     // If stop_token_ids were not provided, take value from default m_generation_config
     if (sampling_params.stop_token_ids.empty())
         sampling_params.stop_token_ids = m_generation_config.stop_token_ids;
@@ -251,21 +290,78 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request
     if (sampling_params.eos_token_id == -1)
         sampling_params.set_eos_token_id(m_generation_config.eos_token_id);
     sampling_params.validate();
+    // structured output is compiled by the thread adding the request, so that invalid description is rejected here
+    m_sampler->prepare_structured_output(request_id, sampling_params);
 
-    SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(request_id, input_ids, sampling_params, m_block_size);
+    return std::make_shared<SequenceGroup>(request_id, input_ids, sampling_params, m_block_size);
+}
 
-    if (m_scheduler->get_config().enable_prefix_caching) {
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_add_sequence_group(const SequenceGroup::Ptr& sequence_group,
+                                                                             std::optional<KVCacheSnapshot> snapshot) {
+    if (snapshot) {
+        OPENVINO_ASSERT(!m_scheduler->get_config().use_cache_eviction, "KV cache snapshots cannot be used together with cache eviction");
+        OPENVINO_ASSERT(snapshot->block_size == m_block_size,
+                        "KV cache snapshot block size ", snapshot->block_size, " does not match pipeline block size ", m_block_size);
+        OPENVINO_ASSERT(snapshot->key_cache.size() == m_num_decoder_layers && snapshot->value_cache.size() == m_num_decoder_layers,
+                        "KV cache snapshot is expected to contain ", m_num_decoder_layers, " decoder layers");
+    } else if (m_scheduler->get_config().enable_prefix_caching) {
         m_scheduler->restore_cached_blocks(sequence_group);
     }
 
-    {
-        std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
-        m_awaiting_requests.push_back(sequence_group);
+    std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+    if (snapshot) {
+        m_awaiting_kv_cache_imports.emplace_back(sequence_group, std::move(*snapshot));
     }
+    m_awaiting_requests.push_back(sequence_group);
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_submit_sequence_group(const SequenceGroup::Ptr& sequence_group) {
+    _add_sequence_group(sequence_group);
+}
 
-    return std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(), sampling_params);
+GenerationHandle
+ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request_id,
+                                                               const ov::Tensor& input_ids,
+                                                               ov::genai::GenerationConfig sampling_params) {
+    SequenceGroup::Ptr sequence_group = _create_sequence_group(request_id, input_ids, sampling_params);
+    _submit_sequence_group(sequence_group);
+    return std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(), sequence_group->get_sampling_parameters());
 };
 
+GenerationHandle
+ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request_id,
+                                                                const ov::Tensor& input_ids,
+                                                                ov::genai::GenerationConfig sampling_params,
+                                                                const KVCacheSnapshot& snapshot) {
+    SequenceGroup::Ptr sequence_group = _create_sequence_group(request_id, input_ids, sampling_params);
+    _add_sequence_group(sequence_group, snapshot);
+    return std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(), sequence_group->get_sampling_parameters());
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::park_kv_cache(uint64_t request_id) {
+    OPENVINO_ASSERT(!m_scheduler->get_config().use_cache_eviction, "KV cache snapshots cannot be used together with cache eviction");
+    std::lock_guard<std::mutex> lock{m_parked_kv_caches_mutex};
+    m_requests_to_park.insert(request_id);
+}
+
+KVCacheSnapshot ContinuousBatchingPipeline::ContinuousBatchingImpl::take_kv_cache_snapshot(uint64_t request_id) {
+    std::optional<KVCacheSnapshot> snapshot = _try_take_kv_cache_snapshot(request_id);
+    OPENVINO_ASSERT(snapshot.has_value(), "KV cache of request ", request_id, " is not parked. "
+                    "Make sure park_kv_cache() was called for the request and the request has finished without cancellation");
+    return std::move(*snapshot);
+}
+
+std::optional<KVCacheSnapshot> ContinuousBatchingPipeline::ContinuousBatchingImpl::_try_take_kv_cache_snapshot(uint64_t request_id) {
+    std::lock_guard<std::mutex> lock{m_parked_kv_caches_mutex};
+    auto it = m_parked_kv_caches.find(request_id);
+    if (it == m_parked_kv_caches.end()) {
+        return std::nullopt;
+    }
+    KVCacheSnapshot snapshot = std::move(it->second);
+    m_parked_kv_caches.erase(it);
+    return snapshot;
+}
+
 GenerationHandle
 ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request_id,
                                                                 const std::string& prompt,
@@ -288,6 +384,15 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     step_timer.start();
 
     _pull_awaiting_requests();
+    _free_requests_dropped_by_handle();
+
+    // all requests were dropped by handles, there is nothing to schedule
+    if (m_requests.empty()) {
+        m_batch_size = 0;
+        m_pipeline_metrics.scheduled_requests = 0;
+        step_timer.end();
+        return;
+    }
 
     Scheduler::Output scheduler_output;
 
@@ -357,7 +462,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     {
         static ManualTimer timer("sample");
         timer.start();
-        sampler_output = m_sampler->sample(m_requests, logits, m_is_validation_mode_enabled);
+        sampler_output = m_sampler->sample(m_requests, logits, m_is_validation_mode_enabled, m_model_runner->get_logits_token_ids());
         m_batch_size = sampler_output.num_generated_tokens;
         timer.end();
     }
@@ -406,15 +511,43 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::set_adapters(const std:
     }
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::start_generation() {
+    m_sampler->start_generation();
+}
+
 std::vector<EncodedGenerationResult>
 ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<ov::Tensor>& input_ids,
                                                              const std::vector<GenerationConfig>& sampling_params,
                                                              const StreamerVariant& streamer) {
+    OPENVINO_ASSERT(input_ids.size() == sampling_params.size());
+    return _generate(sampling_params, streamer, [&input_ids](const AddRequestCallback& add_request) {
+        for (size_t request_id = 0; request_id < input_ids.size(); ++request_id) {
+            OPENVINO_ASSERT(1 == input_ids[request_id].get_shape().at(0), "Use multiple tensors to pass a batch.");
+            add_request(request_id, input_ids[request_id]);
+        }
+    }, false);
+}
+
+std::vector<EncodedGenerationResult>
+ContinuousBatchingPipeline::ContinuousBatchingImpl::tokenize_and_generate(const std::vector<std::string>& prompts,
+                                                                          const std::vector<GenerationConfig>& sampling_params,
+                                                                          const StreamerVariant& streamer,
+                                                                          std::vector<MicroSeconds>& tokenization_durations) {
+    // each request is added to the pipeline as soon as its batch is tokenized, so generation overlaps tokenization
+    return _generate(sampling_params, streamer, [&](const AddRequestCallback& add_request) {
+        tokenize_prompts(prompts, sampling_params, tokenization_durations, add_request);
+    }, true);
+}
+
+std::vector<EncodedGenerationResult>
+ContinuousBatchingPipeline::ContinuousBatchingImpl::_generate(const std::vector<GenerationConfig>& sampling_params,
+                                                              const StreamerVariant& streamer,
+                                                              const std::function<void(const AddRequestCallback&)>& add_requests,
+                                                              bool add_requests_async) {
     ManualTimer generate_timer("generate()");
     generate_timer.start();
 
     OPENVINO_ASSERT(!has_non_finished_requests(), "Generate cannot be called while ContinuousBatchingPipeline is already in running state. Use ContinuousBatchingPipeline::add_request");
-    OPENVINO_ASSERT(input_ids.size() == sampling_params.size());
 
     auto start_time =  std::chrono::steady_clock::now();
     PerfMetrics perf_metrics;
@@ -426,27 +559,100 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
         OPENVINO_ASSERT(sampling_params[i - 1].adapters == sampling_params[i].adapters,
             "LoRA adapters value must be the same for all requests");
     }
-    set_adapters(sampling_params[0].adapters);
+    set_adapters(sampling_params.at(0).adapters);
+    start_generation();
 
-    const auto streamer_ptr = std::make_shared<ThreadedStreamerWrapper>(streamer, m_tokenizer);
+    // batch streamer gets new tokens of all requests after every step, other streamers are run in a separate thread
+    const auto batch_streamer = utils::get_batch_streamer(streamer);
+    const auto streamer_ptr = std::make_shared<ThreadedStreamerWrapper>(batch_streamer ? StreamerVariant{std::monostate{}} : streamer, m_tokenizer);
 
-    OPENVINO_ASSERT(!streamer_ptr->has_callback() || input_ids.size() == 1 && sampling_params[0].num_return_sequences == 1 &&
+    OPENVINO_ASSERT(!streamer_ptr->has_callback() || sampling_params.size() == 1 && sampling_params[0].num_return_sequences == 1 &&
         (sampling_params[0].is_greedy_decoding() || sampling_params[0].is_multinomial()),
         "Currently streaming is possible only with batch size=1 and only for greedy or multinomial decoding");
-
-    std::vector<GenerationHandle> generations;
-    for (size_t request_id = 0; request_id < input_ids.size(); ++request_id) {
-        OPENVINO_ASSERT(1 == input_ids[request_id].get_shape().at(0), "Use multiple tensors to pass a batch.");
-        generations.push_back(add_request(request_id, input_ids[request_id], sampling_params[request_id]));
+    for (const GenerationConfig& config : sampling_params) {
+        OPENVINO_ASSERT(!batch_streamer || config.num_return_sequences == 1,
+            "Batch streaming is possible only for requests with num_return_sequences=1");
     }
-    auto all_requests = m_awaiting_requests; // we need to store all requests to get results from them once generation has finished
 
-    GenerationHandle& generation = generations.at(0);
+    // we need to store all requests to get results from them once generation has finished
+    const size_t num_requests = sampling_params.size();
+    std::vector<SequenceGroup::Ptr> all_requests(num_requests);
+    std::vector<GenerationHandle> generations(num_requests);
+    std::vector<uint8_t> finished_streaming(num_requests, 0);
+    StreamingStatus batch_streaming_status = StreamingStatus::RUNNING;
+
+    // requests added by `add_requests` since the previous iteration of generation loop, protected by added_requests_mutex
+    std::vector<size_t> added_requests;
+    bool all_requests_added = false, generation_failed = false;
+    std::exception_ptr add_requests_exception = nullptr;
+    std::mutex added_requests_mutex;
+    std::condition_variable added_requests_cv;
+
+    const AddRequestCallback add_request = [&](size_t request_id, const ov::Tensor& input_ids) {
+        {
+            std::lock_guard<std::mutex> lock{added_requests_mutex};
+            if (generation_failed)
+                return;
+        }
+        SequenceGroup::Ptr sequence_group = _create_sequence_group(request_id, input_ids, sampling_params[request_id]);
+        _submit_sequence_group(sequence_group);
+        {
+            std::lock_guard<std::mutex> lock{added_requests_mutex};
+            all_requests[request_id] = sequence_group;
+            added_requests.push_back(request_id);
+        }
+        added_requests_cv.notify_one();
+    };
+    const auto run_add_requests = [&]() {
+        std::exception_ptr exception = nullptr;
+        try {
+            add_requests(add_request);
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        {
+            std::lock_guard<std::mutex> lock{added_requests_mutex};
+            add_requests_exception = exception;
+            all_requests_added = true;
+        }
+        added_requests_cv.notify_one();
+    };
+
+    // declared after the state it references, so that it's destroyed (and waited for) first
+    std::future<void> adding_requests;
+    if (add_requests_async) {
+        adding_requests = std::async(std::launch::async, run_add_requests);
+    } else {
+        run_add_requests();
+    }
 
     streamer_ptr->start();
 
-    while (has_non_finished_requests()) {
+    while (true) {
         try {
+            {
+                std::unique_lock<std::mutex> lock{added_requests_mutex};
+                // nothing to generate until the next request is added
+                added_requests_cv.wait(lock, [&] {
+                    return all_requests_added || !added_requests.empty() || has_non_finished_requests();
+                });
+                for (size_t request_id : added_requests) {
+                    const SequenceGroup::Ptr& request = all_requests[request_id];
+                    generations[request_id] = std::make_shared<GenerationHandleImpl>(request->get_generation_stream(), request->get_sampling_parameters());
+                    // batch streamer has already stopped generation of requests added before
+                    if (batch_streaming_status != StreamingStatus::RUNNING) {
+                        batch_streaming_status == StreamingStatus::CANCEL ? generations[request_id]->cancel() : generations[request_id]->stop();
+                    }
+                }
+                added_requests.clear();
+                if (add_requests_exception) {
+                    std::rethrow_exception(add_requests_exception);
+                }
+                if (all_requests_added && !has_non_finished_requests()) {
+                    break;
+                }
+            }
+
             const auto infer_start = std::chrono::steady_clock::now();
             step();
             if (m_batch_size > 0) {
@@ -458,15 +664,37 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
                 raw_perf_counters.m_batch_sizes.emplace_back(m_batch_size);
             }
         } catch (...) {
+            // requests which are being added have to be in the pipeline to be dropped
+            {
+                std::lock_guard<std::mutex> lock{added_requests_mutex};
+                generation_failed = true;
+            }
+            if (adding_requests.valid()) {
+                adding_requests.wait();
+            }
+            _pull_awaiting_requests();
             drop_requests(); // remove all requests from pipeline state in case of exception
             streamer_ptr->end();
+            if (batch_streamer) {
+                batch_streamer->end();
+            }
             std::rethrow_exception(std::current_exception());
         }
-        stream_tokens(streamer_ptr, generation);
+        if (batch_streamer) {
+            const StreamingStatus streaming_status = stream_batch_tokens(batch_streamer, generations, finished_streaming);
+            if (streaming_status != StreamingStatus::RUNNING) {
+                batch_streaming_status = streaming_status;
+            }
+        } else if (generations.at(0)) {
+            stream_tokens(streamer_ptr, generations[0]);
+        }
     }
 
     // waiting for competion of streaming
     streamer_ptr->end();
+    if (batch_streamer) {
+        batch_streamer->end();
+    }
 
     OPENVINO_ASSERT(m_requests.empty(), "Internal error: current request is supposed to be dropped within step() function as completed");
 
@@ -508,7 +736,7 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
         results.push_back(std::move(result));
     }
 
-    OPENVINO_ASSERT(results.size() == input_ids.size());
+    OPENVINO_ASSERT(results.size() == num_requests);
 
     generate_timer.end();
     return results;
@@ -519,12 +747,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_free_non_running_reque
     while (requests_iterator != m_requests.end()) {
         const auto& request = *requests_iterator;
         if(request->has_finished() || request->handle_stopped() || request->handle_cancelled()) {
-            for (const auto& sequence: request->get_sequences()) {
-                if (m_scheduler->has_block_table(sequence->get_id())) {
-                    m_scheduler->free_sequence(sequence->get_id());
-                }
-            }
-            m_sampler->clear_request_info(request->get_request_id());
+            _release_request(request);
             requests_iterator = m_requests.erase(requests_iterator);
         } else {
             requests_iterator++;
@@ -532,6 +755,98 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_free_non_running_reque
     }
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_free_requests_dropped_by_handle() {
+    std::vector<SequenceGroup::Ptr>::iterator requests_iterator = m_requests.begin();
+    while (requests_iterator != m_requests.end()) {
+        const auto& request = *requests_iterator;
+        if (request->has_finished() || !(request->handle_stopped() || request->handle_cancelled())) {
+            requests_iterator++;
+            continue;
+        }
+
+        // tokens which would be scheduled for the request in this step
+        const size_t num_processed_tokens = std::min(request->get_num_processed_tokens(), request->get_prompt_len());
+        size_t num_saved_tokens = request->get_prompt_len() - num_processed_tokens;
+        if (num_saved_tokens == 0) {
+            num_saved_tokens = request->num_running_seqs();
+        }
+        m_pipeline_metrics.cancelled_requests++;
+        m_pipeline_metrics.cancelled_tokens_saved += num_saved_tokens;
+
+        // unblock read() of the handle as _notify_requests_dropped_by_handle() does
+        request->push_empty_outputs();
+        _release_request(request);
+        requests_iterator = m_requests.erase(requests_iterator);
+    }
+    m_pipeline_metrics.requests = m_requests.size();
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_release_request(const SequenceGroup::Ptr& request) {
+    _park_kv_cache_if_requested(request);
+    for (const auto& sequence: request->get_sequences()) {
+        if (m_scheduler->has_block_table(sequence->get_id())) {
+            m_scheduler->free_sequence(sequence->get_id());
+        }
+    }
+    m_sampler->clear_request_info(request->get_request_id());
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_park_kv_cache_if_requested(const SequenceGroup::Ptr& request) {
+    std::lock_guard<std::mutex> lock{m_parked_kv_caches_mutex};
+    auto it = m_requests_to_park.find(request->get_request_id());
+    if (it == m_requests_to_park.end()) {
+        return;
+    }
+    m_requests_to_park.erase(it);
+
+    // cancelled requests drop their prompt and generated tokens from history, so there is nothing to resume
+    if (request->handle_cancelled() || request->out_of_memory()) {
+        return;
+    }
+
+    // the best sequence, whose blocks are still allocated, is parked
+    for (const auto& sequence : request->get_finished_sequences()) {
+        if (!m_scheduler->has_block_table(sequence->get_id())) {
+            continue;
+        }
+
+        TokenIds token_ids = request->get_prompt_ids();
+        const auto& generated_ids = sequence->get_generated_ids();
+        token_ids.insert(token_ids.end(), generated_ids.begin(), generated_ids.end());
+        // the last sampled token has not been processed by the model yet, so its KV cache is not available
+        const size_t num_tokens = std::min(request->get_num_processed_tokens(), token_ids.size());
+        if (num_tokens == 0) {
+            return;
+        }
+
+        KVCacheSnapshot snapshot = m_scheduler->export_kv_cache(sequence->get_id(), num_tokens);
+        token_ids.resize(num_tokens);
+        snapshot.token_ids = std::move(token_ids);
+        m_parked_kv_caches[request->get_request_id()] = std::move(snapshot);
+        return;
+    }
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_import_kv_cache(const SequenceGroup::Ptr& sequence_group, const KVCacheSnapshot& snapshot) {
+    const auto& prompt_ids = sequence_group->get_prompt_ids();
+    if (prompt_ids.empty() || snapshot.key_cache.empty()) {
+        return;
+    }
+
+    // at least one prompt token has to be processed by the model to get logits for the first generated token
+    const size_t max_num_tokens = std::min({prompt_ids.size() - 1,
+                                            snapshot.token_ids.size(),
+                                            snapshot.key_cache[0].get_shape()[0] * m_block_size});
+    size_t num_tokens = 0;
+    while (num_tokens < max_num_tokens && prompt_ids[num_tokens] == snapshot.token_ids[num_tokens]) {
+        ++num_tokens;
+    }
+
+    if (num_tokens > 0 && m_scheduler->import_kv_cache(sequence_group, snapshot, num_tokens)) {
+        sequence_group->update_processed_tokens_num(num_tokens);
+    }
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_notify_requests_dropped_by_handle() {
     // Notify the last time by pushing empty output
     // This causes read() to unblock by adding anything to the queue
@@ -728,23 +1043,10 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_fill_prompt_log_probs(
             int64_t token_id = sequence_group->get_prompt_ids()[token_id_offset];
             float token_logit = token_logits[token_id];
 
-            // find max value for log softmax
-            float max_value = -std::numeric_limits<float>::infinity();
-            size_t max_index = 0;
-            for (size_t i = 0; i < vocab_size; ++i) {
-                if (token_logits[i] > max_value) {
-                    max_value = token_logits[i];
-                    max_index = i;
-                }
-            }
-
             // apply log softmax to token logit
-            float log_sum = std::log(std::accumulate(
-                token_logits, token_logits + vocab_size, 0.0f, [max_value](float accumulated, float to_add) {
-                    return accumulated + std::exp(to_add - max_value);
-            }));
+            float log_sum = kernels::log_sum_exp(token_logits, vocab_size);
 
-            sequence_group->append_prompt_log_prob(token_logit - max_value - log_sum);
+            sequence_group->append_prompt_log_prob(token_logit - log_sum);
         }
         currently_processed_tokens += output_seq_len * num_running_sequences;
         // For max_new_tokens == 0, we don't reach sampling so need to notify handle separately
@@ -11,6 +11,8 @@
 namespace ov::genai {
 
 class ContinuousBatchingPipeline::ContinuousBatchingImpl : public ContinuousBatchingPipeline::IContinuousBatchingPipeline {
+    friend class ContinuousBatchingPipeline::DisaggregatedImpl;
+
 protected:
     std::shared_ptr<Scheduler> m_scheduler;
     std::shared_ptr<ModelRunner> m_model_runner;
@@ -23,6 +25,15 @@ protected:
     std::vector<SequenceGroup::Ptr> m_awaiting_requests;
     // Mutex protecting access to m_awaiting_requests, so add_request and step methods can be called from different threads
     std::mutex m_awaiting_requests_mutex;
+    // KV cache snapshots to be imported for awaiting requests, protected by m_awaiting_requests_mutex
+    std::vector<std::pair<SequenceGroup::Ptr, KVCacheSnapshot>> m_awaiting_kv_cache_imports;
+
+    // requests whose KV cache should be copied to host memory once they are finished
+    std::set<uint64_t> m_requests_to_park;
+    // KV cache snapshots of finished parked requests
+    std::map<uint64_t, KVCacheSnapshot> m_parked_kv_caches;
+    // Mutex protecting access to m_requests_to_park and m_parked_kv_caches
+    std::mutex m_parked_kv_caches_mutex;
 
     std::map<size_t, CacheEvictionAlgorithm> m_seq_group_id_to_cache_eviction_algo_map;
 
@@ -74,6 +85,49 @@ protected:
      */
     void _free_non_running_requests();
 
+    /**
+     * Releases requests stopped or cancelled via handles before scheduling, so that their KV cache blocks are
+     * available to other requests in the same step
+     */
+    void _free_requests_dropped_by_handle();
+
+    /**
+     * Frees KV cache blocks and sampler state of a request which is removed from running queue
+     */
+    void _release_request(const SequenceGroup::Ptr& request);
+
+    /**
+     * Creates a sequence group for a request, filling generation config defaults from the pipeline config
+     */
+    SequenceGroup::Ptr _create_sequence_group(uint64_t request_id, const ov::Tensor& input_ids, ov::genai::GenerationConfig sampling_params);
+
+    /**
+     * Puts a sequence group to awaiting queue
+     * If snapshot is provided, KV cache of the prompt prefix is restored from it when the request is pulled
+     */
+    void _add_sequence_group(const SequenceGroup::Ptr& sequence_group, std::optional<KVCacheSnapshot> snapshot = std::nullopt);
+
+    /**
+     * Sends a new sequence group created by add_request() or generate() to processing, puts it to awaiting queue by default
+     */
+    virtual void _submit_sequence_group(const SequenceGroup::Ptr& sequence_group);
+
+    /**
+     * Returns and releases KV cache snapshot of a parked request if it exists
+     */
+    std::optional<KVCacheSnapshot> _try_take_kv_cache_snapshot(uint64_t request_id);
+
+    /**
+     * Copies KV cache of a finished request to host memory if it was marked via park_kv_cache()
+     * Should be called before the request's blocks are freed
+     */
+    void _park_kv_cache_if_requested(const SequenceGroup::Ptr& request);
+
+    /**
+     * Restores KV cache of a newly pulled request from a snapshot
+     */
+    void _import_kv_cache(const SequenceGroup::Ptr& sequence_group, const KVCacheSnapshot& snapshot);
+
     /**
      * Notify dropped requests by pushing empty output
      */
@@ -95,6 +149,26 @@ protected:
 
     virtual void drop_requests();
 
+    // Adds a request with given index to the pipeline, may be called from several threads at once
+    using AddRequestCallback = std::function<void(size_t request_id, const ov::Tensor& input_ids)>;
+
+    /**
+     * Generation loop shared by encoded and text generate()
+     * `add_requests` calls its argument for every request; if `add_requests_async` is set, it's run in a separate
+     * thread while already added requests are being generated
+     */
+    std::vector<EncodedGenerationResult>
+    _generate(const std::vector<GenerationConfig>& sampling_params,
+              const StreamerVariant& streamer,
+              const std::function<void(const AddRequestCallback&)>& add_requests,
+              bool add_requests_async);
+
+    std::vector<EncodedGenerationResult>
+    tokenize_and_generate(const std::vector<std::string>& prompts,
+                          const std::vector<GenerationConfig>& sampling_params,
+                          const StreamerVariant& streamer,
+                          std::vector<MicroSeconds>& tokenization_durations) override;
+
 public:
     ContinuousBatchingImpl(const std::shared_ptr<ov::Model>& model,
                            const Tokenizer& tokenizer,
@@ -114,6 +188,15 @@ public:
                                  const std::string& prompt,
                                  ov::genai::GenerationConfig sampling_params) override;
 
+    GenerationHandle add_request(uint64_t request_id,
+                                 const ov::Tensor& input_ids,
+                                 ov::genai::GenerationConfig sampling_params,
+                                 const KVCacheSnapshot& snapshot) override;
+
+    void park_kv_cache(uint64_t request_id) override;
+
+    KVCacheSnapshot take_kv_cache_snapshot(uint64_t request_id) override;
+
     bool has_non_finished_requests() override;
 
     void step() override;
@@ -126,6 +209,11 @@ public:
     /**
      * Updates LoRA adapters for current generation call
      */
-    void set_adapters(const std::optional<AdapterConfig>& adapters);
+    virtual void set_adapters(const std::optional<AdapterConfig>& adapters);
+
+    /**
+     * Switches requests of the next generate() call to new random streams, see Sampler::start_generation()
+     */
+    void start_generation();
 };
 } // namespace ov::genai
@@ -4,6 +4,8 @@
 #include <cstdint>
 #include <mutex>
 #include <memory>
+#include <future>
+#include <optional>
 #include <openvino/runtime/properties.hpp>
 
 #include "openvino/genai/continuous_batching_pipeline.hpp"
@@ -12,6 +14,7 @@
 #include "continuous_batching_impl.hpp"
 #include "speculative_decoding/speculative_decoding_impl.hpp"
 #include "prompt_lookup/prompt_lookup_impl.hpp"
+#include "disaggregated/disaggregated_impl.hpp"
 #include "timer.hpp"
 #include "utils.hpp"
 #include "debug_utils.hpp"
@@ -38,6 +41,21 @@ extract_prompt_lookup_from_config(ov::AnyMap& config) {
     return res;
 }
 
+inline std::optional<std::string>
+extract_decode_device_from_config(ov::AnyMap& config, ov::AnyMap& decode_properties) {
+    std::optional<std::string> decode_device;
+    if (config.find(ov::genai::decode_device.name()) != config.end()) {
+        decode_device = config.at(ov::genai::decode_device.name()).as<std::string>();
+        config.erase(ov::genai::decode_device.name());
+    }
+    decode_properties = config;
+    if (config.find(ov::genai::decode_properties.name()) != config.end()) {
+        decode_properties = config.at(ov::genai::decode_properties.name()).as<ov::AnyMap>();
+        config.erase(ov::genai::decode_properties.name());
+    }
+    return decode_device;
+}
+
 inline float get_load_time(std::chrono::steady_clock::time_point start_time) {
     auto stop_time = std::chrono::steady_clock::now();
     return std::chrono::duration_cast<std::chrono::milliseconds>(stop_time - start_time).count();
@@ -53,17 +71,28 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline( const std::filesystem::p
     auto properties_without_draft_model = properties;
     auto draft_model_desr = extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    ov::AnyMap decode_properties;
+    auto decode_device = extract_decode_device_from_config(properties_without_draft_model, decode_properties);
 
+    // tokenizer is read while LLM is read, tokenizer compilation continues in background
+    auto tokenizer_future = std::async(std::launch::async, [&models_path, &tokenizer_properties]() {
+        return ov::genai::Tokenizer(models_path, tokenizer_properties);
+    });
     auto model = utils::singleton_core().read_model(models_path / "openvino_model.xml", {}, properties);
-    auto tokenizer = ov::genai::Tokenizer(models_path, tokenizer_properties);
+    auto tokenizer = tokenizer_future.get();
     auto generation_config = utils::from_config_json_if_exists(models_path);
 
     if (is_prompt_lookup_enabled) {
         OPENVINO_ASSERT(draft_model_desr.model == nullptr, "Speculative decoding and prompt lookup decoding are mutually exclusive");
+        OPENVINO_ASSERT(!decode_device.has_value(), "Prompt lookup decoding and prefill / decode disaggregation are mutually exclusive");
         m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config);
     } else if (draft_model_desr.model != nullptr) {
+        OPENVINO_ASSERT(!decode_device.has_value(), "Speculative decoding and prefill / decode disaggregation are mutually exclusive");
         auto main_model_descr = ov::genai::ModelDesc(model, tokenizer, device, properties_without_draft_model, scheduler_config, generation_config);
         m_impl = std::make_shared<SpeculativeDecodingImpl>(main_model_descr, draft_model_desr);
+    } else if (decode_device.has_value()) {
+        m_impl = std::make_shared<DisaggregatedImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model,
+                                                     *decode_device, decode_properties, generation_config);
     } else {
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, tokenizer, scheduler_config, device, properties, generation_config);
     }
@@ -82,16 +111,23 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
     auto properties_without_draft_model = properties;
     auto draft_model_desr = extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    ov::AnyMap decode_properties;
+    auto decode_device = extract_decode_device_from_config(properties_without_draft_model, decode_properties);
     std::filesystem::path openvino_model_name = "openvino_model.xml";
     auto model = utils::singleton_core().read_model(models_path / openvino_model_name, {}, properties_without_draft_model);
     auto generation_config = utils::from_config_json_if_exists(models_path);
 
     if (is_prompt_lookup_enabled) {
         OPENVINO_ASSERT(draft_model_desr.model == nullptr, "Speculative decoding and prompt lookup decoding are mutually exclusive");
+        OPENVINO_ASSERT(!decode_device.has_value(), "Prompt lookup decoding and prefill / decode disaggregation are mutually exclusive");
         m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config);
     } else if (draft_model_desr.model != nullptr) {
+        OPENVINO_ASSERT(!decode_device.has_value(), "Speculative decoding and prefill / decode disaggregation are mutually exclusive");
         auto main_model_descr = ov::genai::ModelDesc(model, tokenizer, device, properties_without_draft_model, scheduler_config, generation_config);
         m_impl = std::make_shared<SpeculativeDecodingImpl>(main_model_descr, draft_model_desr);
+    } else if (decode_device.has_value()) {
+        m_impl = std::make_shared<DisaggregatedImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model,
+                                                     *decode_device, decode_properties, generation_config);
     } else {
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, tokenizer, scheduler_config, device, properties, generation_config);
     }
@@ -112,14 +148,21 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline(
     auto properties_without_draft_model = properties;
     auto draft_model_desr = extract_draft_model_from_config(properties_without_draft_model);
     auto is_prompt_lookup_enabled = extract_prompt_lookup_from_config(properties_without_draft_model);
+    ov::AnyMap decode_properties;
+    auto decode_device = extract_decode_device_from_config(properties_without_draft_model, decode_properties);
     auto model = utils::singleton_core().read_model(model_str, weights_tensor);
 
     if (is_prompt_lookup_enabled) {
         OPENVINO_ASSERT(draft_model_desr.model == nullptr, "Speculative decoding and prompt lookup decoding are mutually exclusive");
+        OPENVINO_ASSERT(!decode_device.has_value(), "Prompt lookup decoding and prefill / decode disaggregation are mutually exclusive");
         m_impl = std::make_shared<PromptLookupImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model, generation_config);
     } else if (draft_model_desr.model != nullptr) {
+        OPENVINO_ASSERT(!decode_device.has_value(), "Speculative decoding and prefill / decode disaggregation are mutually exclusive");
         auto main_model_descr = ov::genai::ModelDesc(model, tokenizer, device, properties_without_draft_model, scheduler_config, generation_config);
         m_impl = std::make_shared<SpeculativeDecodingImpl>(main_model_descr, draft_model_desr);
+    } else if (decode_device.has_value()) {
+        m_impl = std::make_shared<DisaggregatedImpl>(model, tokenizer, scheduler_config, device, properties_without_draft_model,
+                                                     *decode_device, decode_properties, generation_config);
     } else {
         m_impl = std::make_shared<ContinuousBatchingImpl>(model, tokenizer, scheduler_config, device, properties, generation_config);
     }
@@ -139,12 +182,36 @@ PipelineMetrics ContinuousBatchingPipeline::get_metrics() const{
     return m_impl->get_metrics();
 }
 
+namespace {
+GenerationHandle attach_completion_queue(GenerationHandle handle, const std::shared_ptr<GenerationCompletionQueue>& completion_queue, uint64_t request_id) {
+    if (completion_queue)
+        handle->set_completion_queue(completion_queue, request_id);
+    return handle;
+}
+}  // namespace
+
 GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, const std::string& prompt, const ov::genai::GenerationConfig& sampling_params) {
-    return m_impl->add_request(request_id, prompt, sampling_params);
+    return attach_completion_queue(m_impl->add_request(request_id, prompt, sampling_params), m_impl->m_completion_queue, request_id);
 }
 
 GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& sampling_params) {
-    return m_impl->add_request(request_id, input_ids, sampling_params);
+    return attach_completion_queue(m_impl->add_request(request_id, input_ids, sampling_params), m_impl->m_completion_queue, request_id);
+}
+
+GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& sampling_params, const KVCacheSnapshot& snapshot) {
+    return attach_completion_queue(m_impl->add_request(request_id, input_ids, sampling_params, snapshot), m_impl->m_completion_queue, request_id);
+}
+
+void ContinuousBatchingPipeline::set_completion_queue(std::shared_ptr<GenerationCompletionQueue> completion_queue) {
+    m_impl->m_completion_queue = std::move(completion_queue);
+}
+
+void ContinuousBatchingPipeline::park_kv_cache(uint64_t request_id) {
+    m_impl->park_kv_cache(request_id);
+}
+
+KVCacheSnapshot ContinuousBatchingPipeline::take_kv_cache_snapshot(uint64_t request_id) {
+    return m_impl->take_kv_cache_snapshot(request_id);
 }
 
 void ContinuousBatchingPipeline::step() {
@@ -0,0 +1,179 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "disaggregated_impl.hpp"
+#include "timer.hpp"
+#include "utils.hpp"
+
+namespace ov::genai {
+
+ContinuousBatchingPipeline::DisaggregatedImpl::DisaggregatedImpl(const std::shared_ptr<ov::Model>& model,
+                                                                 const Tokenizer& tokenizer,
+                                                                 const SchedulerConfig& scheduler_config,
+                                                                 const std::string& prefill_device,
+                                                                 const ov::AnyMap& prefill_properties,
+                                                                 const std::string& decode_device,
+                                                                 const ov::AnyMap& decode_properties,
+                                                                 const ov::genai::GenerationConfig& generation_config)
+    // paged attention transformations are applied to a model in place, so each pipeline gets its own copy
+    : DisaggregatedImpl(model->clone(), model, tokenizer, scheduler_config, prefill_device, prefill_properties,
+                        decode_device, decode_properties, generation_config) {}
+
+ContinuousBatchingPipeline::DisaggregatedImpl::DisaggregatedImpl(const std::shared_ptr<ov::Model>& prefill_model,
+                                                                 const std::shared_ptr<ov::Model>& decode_model,
+                                                                 const Tokenizer& tokenizer,
+                                                                 const SchedulerConfig& scheduler_config,
+                                                                 const std::string& prefill_device,
+                                                                 const ov::AnyMap& prefill_properties,
+                                                                 const std::string& decode_device,
+                                                                 const ov::AnyMap& decode_properties,
+                                                                 const ov::genai::GenerationConfig& generation_config)
+    : ContinuousBatchingImpl(decode_model, tokenizer, scheduler_config, decode_device, decode_properties, generation_config) {
+    OPENVINO_ASSERT(!scheduler_config.use_cache_eviction, "Prefill / decode disaggregation cannot be used together with cache eviction");
+
+    m_prefill_pipeline = std::make_shared<ContinuousBatchingImpl>(prefill_model, tokenizer, scheduler_config, prefill_device, prefill_properties, generation_config);
+    OPENVINO_ASSERT(m_prefill_pipeline->m_block_size == m_block_size,
+                    "Prefill device ", prefill_device, " and decode device ", decode_device, " use different KV cache block sizes");
+
+    m_prefill_thread = std::thread(&DisaggregatedImpl::_prefill_worker, this);
+}
+
+ContinuousBatchingPipeline::DisaggregatedImpl::~DisaggregatedImpl() {
+    {
+        std::lock_guard<std::mutex> lock{m_prefill_mutex};
+        m_stop_prefill = true;
+    }
+    m_prefill_cv.notify_one();
+    if (m_prefill_thread.joinable()) {
+        m_prefill_thread.join();
+    }
+}
+
+void ContinuousBatchingPipeline::DisaggregatedImpl::_prefill_worker() {
+    try {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock{m_prefill_mutex};
+                m_prefill_cv.wait(lock, [this] { return m_stop_prefill || !m_prefill_requests.empty(); });
+                if (m_stop_prefill) {
+                    return;
+                }
+                // there is no need to compute prompts of requests which were stopped or cancelled before prefill
+                for (auto& prefill_request : m_prefill_requests) {
+                    const auto& sequence_group = prefill_request.sequence_group;
+                    if (sequence_group->handle_stopped() || sequence_group->handle_cancelled()) {
+                        prefill_request.prefill_handle->cancel();
+                    }
+                }
+            }
+
+            m_prefill_pipeline->step();
+
+            std::lock_guard<std::mutex> lock{m_prefill_mutex};
+            for (auto it = m_prefill_requests.begin(); it != m_prefill_requests.end();) {
+                if (it->prefill_handle->get_status() == GenerationStatus::RUNNING) {
+                    ++it;
+                    continue;
+                }
+                // snapshot is absent if prefill ran out of memory, then decode pipeline processes the whole prompt
+                uint64_t request_id = it->sequence_group->get_request_id();
+                m_prefilled_requests.emplace_back(it->sequence_group, m_prefill_pipeline->_try_take_kv_cache_snapshot(request_id));
+                it = m_prefill_requests.erase(it);
+            }
+            m_prefilled_cv.notify_all();
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> lock{m_prefill_mutex};
+        m_prefill_exception = std::current_exception();
+        m_prefilled_cv.notify_all();
+    }
+}
+
+void ContinuousBatchingPipeline::DisaggregatedImpl::_submit_sequence_group(const SequenceGroup::Ptr& sequence_group) {
+    const auto& prompt_ids = sequence_group->get_prompt_ids();
+    if (prompt_ids.size() < 2) {
+        // the only prompt token has to be processed by decode pipeline to get logits for the first generated token
+        _add_sequence_group(sequence_group);
+        return;
+    }
+
+    // prefill pipeline computes KV cache of all prompt tokens but the last one,
+    // which is processed by decode pipeline to get logits for the first generated token
+    ov::Tensor prefill_ids(ov::element::i64, {1, prompt_ids.size() - 1});
+    std::copy_n(prompt_ids.begin(), prompt_ids.size() - 1, prefill_ids.data<int64_t>());
+
+    ov::genai::GenerationConfig prefill_config = ov::genai::greedy();
+    prefill_config.max_new_tokens = 1;
+
+    uint64_t request_id = sequence_group->get_request_id();
+    m_prefill_pipeline->park_kv_cache(request_id);
+    GenerationHandle prefill_handle = m_prefill_pipeline->add_request(request_id, prefill_ids, prefill_config);
+
+    {
+        std::lock_guard<std::mutex> lock{m_prefill_mutex};
+        m_prefill_requests.push_back({sequence_group, prefill_handle});
+    }
+    m_prefill_cv.notify_one();
+}
+
+bool ContinuousBatchingPipeline::DisaggregatedImpl::has_non_finished_requests() {
+    {
+        std::lock_guard<std::mutex> lock{m_prefill_mutex};
+        if (!m_prefill_requests.empty() || !m_prefilled_requests.empty()) {
+            return true;
+        }
+    }
+    return ContinuousBatchingImpl::has_non_finished_requests();
+}
+
+void ContinuousBatchingPipeline::DisaggregatedImpl::step() {
+    {
+        std::unique_lock<std::mutex> lock{m_prefill_mutex};
+        // if there is nothing to decode, wait for prefilled requests instead of spinning
+        m_prefilled_cv.wait(lock, [this] {
+            return m_prefill_exception || !m_prefilled_requests.empty() || m_prefill_requests.empty() ||
+                   ContinuousBatchingImpl::has_non_finished_requests();
+        });
+        if (m_prefill_exception) {
+            std::rethrow_exception(m_prefill_exception);
+        }
+
+        static ManualTimer transfer_timer("disaggregated: transfer prefilled requests");
+        transfer_timer.start();
+        for (auto& [sequence_group, snapshot] : m_prefilled_requests) {
+            _add_sequence_group(sequence_group, std::move(snapshot));
+        }
+        m_prefilled_requests.clear();
+        transfer_timer.end();
+    }
+
+    if (ContinuousBatchingImpl::has_non_finished_requests()) {
+        ContinuousBatchingImpl::step();
+    } else {
+        m_batch_size = 0;
+    }
+}
+
+void ContinuousBatchingPipeline::DisaggregatedImpl::set_adapters(const std::optional<AdapterConfig>& adapters) {
+    m_prefill_pipeline->set_adapters(adapters);
+    ContinuousBatchingImpl::set_adapters(adapters);
+}
+
+void ContinuousBatchingPipeline::DisaggregatedImpl::drop_requests() {
+    {
+        std::unique_lock<std::mutex> lock{m_prefill_mutex};
+        // prefill worker releases cancelled prompts within its next step
+        for (auto& prefill_request : m_prefill_requests) {
+            prefill_request.sequence_group->get_generation_stream()->cancel();
+            prefill_request.prefill_handle->cancel();
+        }
+        m_prefilled_cv.wait(lock, [this] { return m_prefill_exception || m_prefill_requests.empty(); });
+        for (auto& [sequence_group, snapshot] : m_prefilled_requests) {
+            sequence_group->get_generation_stream()->cancel();
+        }
+        m_prefilled_requests.clear();
+    }
+    ContinuousBatchingImpl::drop_requests();
+}
+
+}
@@ -0,0 +1,91 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <condition_variable>
+#include <thread>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "continuous_batching_impl.hpp"
+
+namespace ov::genai {
+
+/**
+ * Prefill / decode disaggregation
+ *
+ * Prompts are processed by a dedicated prefill pipeline, which runs in a background thread.
+ * Once KV cache of a prompt is computed, it is exported from the prefill pipeline's cache and imported
+ * into fresh blocks of this (decode) pipeline, which generates tokens within step().
+ * Thus long prompts do not delay token generation of already running requests.
+ */
+class ContinuousBatchingPipeline::DisaggregatedImpl : public ContinuousBatchingPipeline::ContinuousBatchingImpl {
+protected:
+    struct PrefillRequest {
+        // sequence group to be decoded, created upfront to provide a generation handle to the user
+        SequenceGroup::Ptr sequence_group;
+        // handle of the corresponding prompt-only request in prefill pipeline
+        GenerationHandle prefill_handle;
+    };
+
+    std::shared_ptr<ContinuousBatchingImpl> m_prefill_pipeline;
+
+    // requests whose prompts are being processed by prefill pipeline
+    std::vector<PrefillRequest> m_prefill_requests;
+    // requests with processed prompts waiting to be moved to decode pipeline together with their KV cache
+    std::vector<std::pair<SequenceGroup::Ptr, std::optional<KVCacheSnapshot>>> m_prefilled_requests;
+    // Mutex protecting access to m_prefill_requests, m_prefilled_requests and prefill worker state
+    std::mutex m_prefill_mutex;
+    // notifies prefill worker about new prompts or stop
+    std::condition_variable m_prefill_cv;
+    // notifies step() about prefilled requests
+    std::condition_variable m_prefilled_cv;
+    std::exception_ptr m_prefill_exception = nullptr;
+    bool m_stop_prefill = false;
+    std::thread m_prefill_thread;
+
+    // prefill model is cloned before the decode pipeline transforms the original model in place
+    DisaggregatedImpl(const std::shared_ptr<ov::Model>& prefill_model,
+                      const std::shared_ptr<ov::Model>& decode_model,
+                      const Tokenizer& tokenizer,
+                      const SchedulerConfig& scheduler_config,
+                      const std::string& prefill_device,
+                      const ov::AnyMap& prefill_properties,
+                      const std::string& decode_device,
+                      const ov::AnyMap& decode_properties,
+                      const ov::genai::GenerationConfig& generation_config);
+
+    /**
+     * Prefill worker loop: performs prefill pipeline steps while there are prompts to process
+     * and moves processed prompts to m_prefilled_requests
+     * Prompts of requests stopped or cancelled via handles are not processed
+     */
+    void _prefill_worker();
+
+    /**
+     * Sends prompt of a request to prefill pipeline or directly to decode pipeline if there is nothing to prefill
+     */
+    void _submit_sequence_group(const SequenceGroup::Ptr& sequence_group) override;
+
+    void drop_requests() override;
+
+public:
+    DisaggregatedImpl(const std::shared_ptr<ov::Model>& model,
+                      const Tokenizer& tokenizer,
+                      const SchedulerConfig& scheduler_config,
+                      const std::string& prefill_device,
+                      const ov::AnyMap& prefill_properties,
+                      const std::string& decode_device,
+                      const ov::AnyMap& decode_properties,
+                      const ov::genai::GenerationConfig& generation_config);
+
+    ~DisaggregatedImpl();
+
+    bool has_non_finished_requests() override;
+
+    void step() override;
+
+    void set_adapters(const std::optional<AdapterConfig>& adapters) override;
+};
+
+}
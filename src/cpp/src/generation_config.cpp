@@ -122,6 +122,7 @@ void GenerationConfig::update_generation_config(const ov::AnyMap& properties) {
     read_anymap_param(properties, "num_return_sequences", num_return_sequences);
     read_anymap_param(properties, "adapters", adapters);
     read_anymap_param(properties, "apply_chat_template", apply_chat_template);
+    read_anymap_param(properties, "structured_output_config", structured_output_config);
 
     // penalties
     read_anymap_param(properties, "frequency_penalty", frequency_penalty);
@@ -265,6 +266,19 @@ void GenerationConfig::validate() const {
     if (num_assistant_tokens == 0) {
         OPENVINO_ASSERT(max_ngram_size == 0, "'max_ngram_size' should be set to default value 0 when prompt lookup is disabled");
     }
+
+    // structured output
+
+    if (structured_output_config.has_value()) {
+        OPENVINO_ASSERT(!is_beam_search(), "Structured output is not supported by beam search");
+        structured_output_config->validate();
+    }
+}
+
+void StructuredOutputConfig::validate() const {
+    const size_t num_descriptions = json_schema.has_value() + regex.has_value() + grammar.has_value();
+    OPENVINO_ASSERT(num_descriptions == 1,
+                    "Exactly one of 'json_schema', 'regex' or 'grammar' must be set in 'structured_output_config', but got ", num_descriptions);
 }
 
 GenerationConfig beam_search() {
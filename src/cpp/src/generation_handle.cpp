@@ -3,11 +3,73 @@
 
 #include <openvino/openvino.hpp>
 
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
 #include "openvino/genai/generation_handle.hpp"
 #include "generation_stream.hpp"
 
 using namespace ov::genai;
 
+GenerationCompletionQueue::GenerationCompletionQueue() {
+#ifdef __linux__
+    m_event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    OPENVINO_ASSERT(m_event_fd >= 0, "Failed to create eventfd for GenerationCompletionQueue");
+#endif
+}
+
+GenerationCompletionQueue::~GenerationCompletionQueue() {
+#ifdef __linux__
+    close(m_event_fd);
+#endif
+}
+
+void GenerationCompletionQueue::notify(uint64_t request_id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_ready_requests_set.insert(request_id).second)
+        return;
+    m_ready_requests.push_back(request_id);
+    // waiters are woken up only when the queue becomes non-empty
+    if (m_ready_requests.size() == 1) {
+        m_cv.notify_all();
+#ifdef __linux__
+        uint64_t value = 1;
+        [[maybe_unused]] ssize_t written = write(m_event_fd, &value, sizeof(value));
+#endif
+    }
+}
+
+std::vector<uint64_t> GenerationCompletionQueue::take_ready_requests() {
+    std::vector<uint64_t> ready_requests;
+    std::swap(ready_requests, m_ready_requests);
+    m_ready_requests_set.clear();
+#ifdef __linux__
+    if (!ready_requests.empty()) {
+        // reset the counter, so that the descriptor is not readable until the next notification
+        uint64_t value = 0;
+        [[maybe_unused]] ssize_t num_read = read(m_event_fd, &value, sizeof(value));
+    }
+#endif
+    return ready_requests;
+}
+
+std::vector<uint64_t> GenerationCompletionQueue::wait(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait_for(lock, timeout, [this] { return !m_ready_requests.empty(); });
+    return take_ready_requests();
+}
+
+std::vector<uint64_t> GenerationCompletionQueue::poll() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return take_ready_requests();
+}
+
+int GenerationCompletionQueue::get_fd() const {
+    return m_event_fd;
+}
+
 GenerationHandleImpl::~GenerationHandleImpl() {
     stop();
 }
@@ -40,11 +102,27 @@ void GenerationHandleImpl::cancel() {
     m_generation_stream->cancel();
 }
 
+void GenerationHandleImpl::set_completion_queue(std::shared_ptr<GenerationCompletionQueue> completion_queue, uint64_t request_id) {
+    OPENVINO_ASSERT(completion_queue, "Completion queue must not be null");
+    GenerationCompletionQueue* queue = completion_queue.get();
+    m_generation_stream->set_completion_queue(std::move(completion_queue), request_id);
+    // outputs might be pushed before the queue is set
+    if (m_generation_stream->can_read() || get_status() != GenerationStatus::RUNNING)
+        queue->notify(request_id);
+}
+
 std::unordered_map<uint64_t, GenerationOutput> GenerationHandleImpl::read() {
     OPENVINO_ASSERT(!is_stopped() && !is_cancelled(), "GenerationHandle cannot be used after it is stopped / cancelled.");
     return m_generation_stream->read();
 }
 
+std::unordered_map<uint64_t, GenerationOutput> GenerationHandleImpl::read_available() {
+    OPENVINO_ASSERT(!is_stopped() && !is_cancelled(), "GenerationHandle cannot be used after it is stopped / cancelled.");
+    std::unordered_map<uint64_t, GenerationOutput> outputs;
+    m_generation_stream->read_available(outputs);
+    return outputs;
+}
+
 void add_partial_result(std::unordered_map<uint64_t, GenerationOutput>& partial_results, std::unordered_map<uint64_t, GenerationOutput>& iteration_results) {
     for (auto& iteration_result: iteration_results) {
         auto partial_result_iter = partial_results.find(iteration_result.first);
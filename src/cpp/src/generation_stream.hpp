@@ -4,15 +4,66 @@
 #pragma once
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "openvino/genai/generation_handle.hpp"
-#include "synchronized_queue.hpp"
+#include "spsc_ring_buffer.hpp"
 
 namespace ov::genai {
+// Outputs of generation steps pushed by the pipeline thread and read by the single GenerationHandle.
+// Outputs are passed through lock-free ring buffer, the producer takes a lock only if the ring is full
+// or the consumer is blocked in read().
 class GenerationStream {
-    std::mutex m_mutex;
-    GenerationStatus m_status = GenerationStatus::RUNNING;
-    SynchronizedQueue<GenerationOutputs> m_output_queue;
+    static constexpr size_t OUTPUTS_RING_CAPACITY = 64;
+
+    std::atomic<GenerationStatus> m_status{GenerationStatus::RUNNING};
+    SPSCRingBuffer<GenerationOutputs> m_outputs{OUTPUTS_RING_CAPACITY};
+
+    // Outputs pushed while the ring is full, they are newer than all outputs in the ring
+    std::deque<GenerationOutputs> m_overflow;
+    std::mutex m_overflow_mutex;
+    std::atomic<bool> m_has_overflow{false};
+
+    // Consumer blocked in read() is woken up by the producer
+    std::mutex m_read_mutex;
+    std::condition_variable m_read_cv;
+    std::atomic<bool> m_consumer_waiting{false};
+
+    // Queue reporting the request when it gets new outputs or status, set once by the consumer
+    std::shared_ptr<GenerationCompletionQueue> m_completion_queue;
+    std::atomic<GenerationCompletionQueue*> m_completion_queue_ptr{nullptr};
+    uint64_t m_request_id = 0;
+
+    void notify_consumer() {
+        // pairs with the fence in read(): either the consumer sees pushed outputs or the producer sees the waiting flag
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_consumer_waiting.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(m_read_mutex);
+            m_read_cv.notify_one();
+        }
+        notify_completion_queue();
+    }
+
+    void notify_completion_queue() {
+        if (GenerationCompletionQueue* completion_queue = m_completion_queue_ptr.load())
+            completion_queue->notify(m_request_id);
+    }
+
+    static void append_outputs(GenerationOutputs& outputs, const GenerationOutputs& iteration_outputs) {
+        for (const auto& [sequence_id, iteration_output] : iteration_outputs) {
+            auto it = outputs.find(sequence_id);
+            if (it == outputs.end()) {
+                outputs.emplace(sequence_id, iteration_output);
+                continue;
+            }
+            GenerationOutput& output = it->second;
+            output.generated_ids.insert(output.generated_ids.end(), iteration_output.generated_ids.begin(), iteration_output.generated_ids.end());
+            output.generated_log_probs.insert(output.generated_log_probs.end(), iteration_output.generated_log_probs.begin(), iteration_output.generated_log_probs.end());
+            output.score = iteration_output.score;
+            output.finish_reason = iteration_output.finish_reason;
+        }
+    }
 
 public:
     using Ptr = std::shared_ptr<GenerationStream>;
@@ -25,35 +76,99 @@ public:
     }
 
     void push(GenerationOutputs outputs) {
-        m_output_queue.push(std::move(outputs));
+        push_with([&outputs](GenerationOutputs& slot) {
+            slot = std::move(outputs);
+        });
+    }
+
+    // Producer: fill(GenerationOutputs&) overwrites outputs of the previous push into the same slot, so that
+    // allocated outputs and token vectors are reused
+    template <typename Fill>
+    void push_with(Fill&& fill) {
+        // once the ring is full, outputs go to overflow until consumer reads all of them to preserve the order
+        if (m_has_overflow.load(std::memory_order_relaxed) || !m_outputs.try_push(fill)) {
+            GenerationOutputs outputs;
+            fill(outputs);
+            std::lock_guard<std::mutex> lock(m_overflow_mutex);
+            m_overflow.push_back(std::move(outputs));
+            m_has_overflow.store(true, std::memory_order_release);
+        }
+        notify_consumer();
+    }
+
+    // Consumer: moves outputs of the oldest generation step to `outputs`, returns false if there are none
+    bool try_read(GenerationOutputs& outputs) {
+        if (m_outputs.try_pop([&outputs](GenerationOutputs& slot) { outputs = std::move(slot); }))
+            return true;
+        if (!m_has_overflow.load(std::memory_order_acquire))
+            return false;
+        std::lock_guard<std::mutex> lock(m_overflow_mutex);
+        outputs = std::move(m_overflow.front());
+        m_overflow.pop_front();
+        if (m_overflow.empty())
+            m_has_overflow.store(false, std::memory_order_relaxed);
+        return true;
     }
 
+    // Consumer: waits for outputs of the next generation step
     GenerationOutputs read() {
-        return m_output_queue.pull();
+        GenerationOutputs outputs;
+        while (!try_read(outputs)) {
+            std::unique_lock<std::mutex> lock(m_read_mutex);
+            m_consumer_waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            m_read_cv.wait(lock, [this] { return can_read(); });
+            m_consumer_waiting.store(false, std::memory_order_relaxed);
+        }
+        return outputs;
+    }
+
+    // Consumer: appends outputs of all pending generation steps to `outputs` without waiting. Outputs stay
+    // in the ring, so the producer reuses their storage. Returns number of read generation steps.
+    size_t read_available(GenerationOutputs& outputs) {
+        size_t num_steps = 0;
+        while (m_outputs.try_pop([&outputs](const GenerationOutputs& slot) { append_outputs(outputs, slot); }))
+            ++num_steps;
+        if (m_has_overflow.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(m_overflow_mutex);
+            for (const GenerationOutputs& iteration_outputs : m_overflow)
+                append_outputs(outputs, iteration_outputs);
+            num_steps += m_overflow.size();
+            m_overflow.clear();
+            m_has_overflow.store(false, std::memory_order_relaxed);
+        }
+        return num_steps;
     }
 
     bool can_read() {
-        return !m_output_queue.empty();
+        return !m_outputs.empty() || m_has_overflow.load(std::memory_order_acquire);
     }
 
     void set_generation_status(GenerationStatus status) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_status = status;
+        m_status.store(status);
+        notify_completion_queue();
+    }
+
+    void set_completion_queue(std::shared_ptr<GenerationCompletionQueue> completion_queue, uint64_t request_id) {
+        OPENVINO_ASSERT(!m_completion_queue, "Completion queue can be set only once");
+        m_completion_queue = std::move(completion_queue);
+        m_request_id = request_id;
+        // sequentially consistent store, so that outputs pushed before it are seen by the caller or the producer
+        // sees the queue and notifies it
+        m_completion_queue_ptr.store(m_completion_queue.get());
+        std::atomic_thread_fence(std::memory_order_seq_cst);
     }
 
     GenerationStatus get_status() {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        return m_status;
+        return m_status.load();
     }
 
     void stop() {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_status = GenerationStatus::STOP;
+        m_status.store(GenerationStatus::STOP);
     }
 
     void cancel() {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_status = GenerationStatus::CANCEL;
+        m_status.store(GenerationStatus::CANCEL);
     }
 };
 }
@@ -3,6 +3,30 @@
 
 #include "icontinuous_batching.hpp"
 
+#include <algorithm>
+#include <numeric>
+
+namespace {
+// Number of prompts tokenized by a single tokenizer call in generate()
+constexpr size_t TOKENIZATION_BATCH_SIZE = 16;
+
+// Waits for all tasks before rethrowing the first exception, since the tasks reference caller's local state
+void wait_for_all(std::vector<std::future<void>>& futures) {
+    std::exception_ptr exception = nullptr;
+    for (auto& future : futures) {
+        try {
+            future.get();
+        } catch (...) {
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+    futures.clear();
+    if (exception)
+        std::rethrow_exception(exception);
+}
+}  // namespace
+
 namespace ov::genai {
 
 GenerationConfig ContinuousBatchingPipeline::IContinuousBatchingPipeline::get_config() const {
@@ -22,11 +46,13 @@ void ContinuousBatchingPipeline::IContinuousBatchingPipeline::start_chat(const s
         m_history.push_back({{"role", "system"}, {"content", system_message}});
     }
     m_is_chat_conversation = true;
+    m_chat_encoder.reset();
 };
 
 void ContinuousBatchingPipeline::IContinuousBatchingPipeline::finish_chat() {
     m_is_chat_conversation = false;
     m_history.clear();
+    m_chat_encoder.reset();
 };
 
 std::vector<GenerationResult>
@@ -42,38 +68,17 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
     if (m_is_chat_conversation) {
         OPENVINO_ASSERT(1 == prompts.size(), "Can't chat with multiple prompts");
         m_history.push_back({{"role", "user"}, {"content", prompts.at(0)}});
-        constexpr bool add_generation_prompt = true;
-        std::string history = m_tokenizer.apply_chat_template(m_history, add_generation_prompt);
         timer.start();
         const auto encode_start = std::chrono::steady_clock::now();
-        // ov::genai::add_special_tokens(false) is aligned with stateful pipeline
-        input_ids.push_back(m_tokenizer.encode(history, ov::genai::add_special_tokens(false)).input_ids);
+        // only messages appended since the previous turn are tokenized
+        input_ids.push_back(m_chat_encoder.encode(m_tokenizer, m_history));
         tokenization_durations.emplace_back(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - encode_start));
         timer.end();
-    } else {
-        input_ids.reserve(prompts.size());
-        timer.start();
-        for (size_t i = 0; i < prompts.size(); i++) {
-            const std::string& prompt = prompts.at(i);
-            const auto encode_start = std::chrono::steady_clock::now();
-            ov::Tensor encoded_inputs;
-            if (sampling_params.at(i).apply_chat_template && !m_tokenizer.get_chat_template().empty()) {
-                ChatHistory history({{{"role", "user"}, {"content", prompt}}});
-                constexpr bool add_generation_prompt = true;
-                auto templated_prompt = m_tokenizer.apply_chat_template(history, add_generation_prompt);
-                encoded_inputs = m_tokenizer.encode(templated_prompt, ov::genai::add_special_tokens(false)).input_ids;
-            } else {
-                // in case when chat_template was not found in tokenizer_config.json or set
-                std::string input_str(prompt);
-                encoded_inputs = m_tokenizer.encode(input_str, ov::genai::add_special_tokens(true)).input_ids;
-            }
-            input_ids.push_back(encoded_inputs);
-            tokenization_durations.emplace_back(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - encode_start));
-        }
-        timer.end();
     }
 
-    std::vector<EncodedGenerationResult> encoded = generate(input_ids, sampling_params, streamer);
+    std::vector<EncodedGenerationResult> encoded = m_is_chat_conversation ?
+        generate(input_ids, sampling_params, streamer) :
+        tokenize_and_generate(prompts, sampling_params, streamer, tokenization_durations);
 
     std::vector<GenerationResult> decoded;
     decoded.reserve(encoded.size());
@@ -117,6 +122,117 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
     return decoded;
 }
 
+std::vector<EncodedGenerationResult>
+ContinuousBatchingPipeline::IContinuousBatchingPipeline::tokenize_and_generate(
+    const std::vector<std::string>& prompts,
+    const std::vector<GenerationConfig>& sampling_params,
+    const StreamerVariant& streamer,
+    std::vector<MicroSeconds>& tokenization_durations) {
+    static ManualTimer timer("tokenize");
+    timer.start();
+    std::vector<ov::Tensor> input_ids = tokenize_prompts(prompts, sampling_params, tokenization_durations);
+    timer.end();
+
+    return generate(input_ids, sampling_params, streamer);
+}
+
+std::vector<ov::Tensor> ContinuousBatchingPipeline::IContinuousBatchingPipeline::tokenize_prompts(
+    const std::vector<std::string>& prompts,
+    const std::vector<GenerationConfig>& sampling_params,
+    std::vector<MicroSeconds>& tokenization_durations) {
+    // each prompt is tokenized once, so concurrent callbacks write distinct elements
+    std::vector<ov::Tensor> input_ids(prompts.size());
+    tokenize_prompts(prompts, sampling_params, tokenization_durations, [&input_ids](size_t prompt_idx, const ov::Tensor& prompt_ids) {
+        input_ids[prompt_idx] = prompt_ids;
+    });
+    return input_ids;
+}
+
+void ContinuousBatchingPipeline::IContinuousBatchingPipeline::tokenize_prompts(
+    const std::vector<std::string>& prompts,
+    const std::vector<GenerationConfig>& sampling_params,
+    std::vector<MicroSeconds>& tokenization_durations,
+    const TokenizedPromptCallback& on_tokenized) {
+    OPENVINO_ASSERT(prompts.size() == sampling_params.size());
+    const size_t num_prompts = prompts.size();
+    tokenization_durations.assign(num_prompts, MicroSeconds(0.0f));
+    if (num_prompts == 0)
+        return;
+
+    const bool has_chat_template = !m_tokenizer.get_chat_template().empty();
+    std::vector<std::string> texts(num_prompts);
+    std::vector<uint8_t> is_templated(num_prompts);
+    std::vector<size_t> order(num_prompts);
+    std::vector<std::future<void>> futures;
+
+    // Tokenizer takes a free infer request from its queue for every call, so batches are tokenized concurrently.
+    // The pool is declared after the state its tasks reference, so the state outlives the tasks.
+    const size_t num_batches = (num_prompts + TOKENIZATION_BATCH_SIZE - 1) / TOKENIZATION_BATCH_SIZE;
+    ThreadPool thread_pool(std::max<size_t>(1, std::min<size_t>(num_batches, std::thread::hardware_concurrency())));
+    for (size_t begin = 0; begin < num_prompts; begin += TOKENIZATION_BATCH_SIZE) {
+        futures.push_back(thread_pool.submit([&, begin]() {
+            for (size_t i = begin; i < std::min(begin + TOKENIZATION_BATCH_SIZE, num_prompts); ++i) {
+                const auto template_start = std::chrono::steady_clock::now();
+                is_templated[i] = sampling_params[i].apply_chat_template && has_chat_template;
+                if (is_templated[i]) {
+                    ChatHistory history({{{"role", "user"}, {"content", prompts[i]}}});
+                    constexpr bool add_generation_prompt = true;
+                    texts[i] = m_tokenizer.apply_chat_template(history, add_generation_prompt);
+                } else {
+                    // in case when chat_template was not found in tokenizer_config.json or set
+                    texts[i] = prompts[i];
+                }
+                tokenization_durations[i] = MicroSeconds(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - template_start));
+            }
+        }));
+    }
+    wait_for_all(futures);
+
+    // Prompts with chat template applied are tokenized without special tokens, so they are batched separately.
+    // Sorting by text length keeps padding of batched tokenization small.
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return std::make_pair(is_templated[lhs], texts[lhs].size()) < std::make_pair(is_templated[rhs], texts[rhs].size());
+    });
+
+    for (size_t begin = 0; begin < num_prompts;) {
+        size_t end = begin + 1;
+        while (end < num_prompts && end - begin < TOKENIZATION_BATCH_SIZE && is_templated[order[end]] == is_templated[order[begin]])
+            ++end;
+        futures.push_back(thread_pool.submit([&, begin, end]() {
+            const auto encode_start = std::chrono::steady_clock::now();
+            std::vector<std::string> batch;
+            batch.reserve(end - begin);
+            for (size_t i = begin; i < end; ++i)
+                batch.push_back(texts[order[i]]);
+            // ov::genai::add_special_tokens(false) is aligned with stateful pipeline
+            TokenizedInputs encoded = m_tokenizer.encode(batch, ov::genai::add_special_tokens(!is_templated[order[begin]]));
+            const auto encode_duration = MicroSeconds(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - encode_start));
+
+            // remove padding of the batch using attention mask
+            const size_t max_length = encoded.input_ids.get_shape().at(1);
+            const int64_t* batch_input_ids = encoded.input_ids.data<int64_t>();
+            const int64_t* batch_attention_mask = encoded.attention_mask.data<int64_t>();
+            for (size_t row = 0; row < end - begin; ++row) {
+                const int64_t* row_input_ids = batch_input_ids + row * max_length;
+                const int64_t* row_attention_mask = batch_attention_mask + row * max_length;
+                const size_t length = std::count_if(row_attention_mask, row_attention_mask + max_length, [](int64_t mask) { return mask != 0; });
+                ov::Tensor prompt_ids(ov::element::i64, {1, length});
+                int64_t* prompt_ids_data = prompt_ids.data<int64_t>();
+                for (size_t position = 0; position < max_length; ++position) {
+                    if (row_attention_mask[position] != 0)
+                        *prompt_ids_data++ = row_input_ids[position];
+                }
+                const size_t prompt_idx = order[begin + row];
+                tokenization_durations[prompt_idx] += encode_duration;
+                on_tokenized(prompt_idx, prompt_ids);
+            }
+        }));
+        begin = end;
+    }
+    wait_for_all(futures);
+}
+
 void ContinuousBatchingPipeline::IContinuousBatchingPipeline::stream_tokens(
     const std::shared_ptr<ThreadedStreamerWrapper>& streamer_ptr,
     const GenerationHandle& handle
@@ -137,7 +253,8 @@ void ContinuousBatchingPipeline::IContinuousBatchingPipeline::stream_tokens(
         return;
     }
 
-    std::unordered_map<uint64_t, GenerationOutput> generation_outputs = handle->read();
+    // tokens of all steps since the previous call are streamed at once
+    std::unordered_map<uint64_t, GenerationOutput> generation_outputs = handle->read_available();
     OPENVINO_ASSERT(generation_outputs.size() <= 1);
     if (generation_outputs.empty()) {
         return;
@@ -146,4 +263,49 @@ void ContinuousBatchingPipeline::IContinuousBatchingPipeline::stream_tokens(
     const auto tokens = generation_outputs.begin()->second.generated_ids;
     streamer_ptr->write(tokens);
 }
+
+StreamingStatus ContinuousBatchingPipeline::IContinuousBatchingPipeline::stream_batch_tokens(
+    const std::shared_ptr<BatchStreamerBase>& streamer,
+    const std::vector<GenerationHandle>& handles,
+    std::vector<uint8_t>& finished
+) {
+    std::vector<BatchStreamingUpdate> updates;
+    for (size_t request_index = 0; request_index < handles.size(); ++request_index) {
+        if (finished[request_index] || !handles[request_index]) {
+            continue;
+        }
+        const GenerationHandle& handle = handles[request_index];
+        BatchStreamingUpdate update;
+        update.request_index = request_index;
+        if (handle->can_read()) {
+            GenerationOutputs generation_outputs = handle->read_available();
+            // requests with several sequences (beam search) push outputs once finished, the best sequence is streamed
+            auto best_output = std::max_element(generation_outputs.begin(), generation_outputs.end(),
+                [](const auto& lhs, const auto& rhs) { return lhs.second.score < rhs.second.score; });
+            if (best_output != generation_outputs.end()) {
+                update.tokens = std::move(best_output->second.generated_ids);
+            }
+        }
+        update.finished = handle->get_status() != GenerationStatus::RUNNING && !handle->can_read();
+        finished[request_index] = update.finished;
+        if (!update.tokens.empty() || update.finished) {
+            updates.push_back(std::move(update));
+        }
+    }
+
+    if (updates.empty()) {
+        return StreamingStatus::RUNNING;
+    }
+
+    const StreamingStatus streaming_status = streamer->write(updates);
+    if (streaming_status == StreamingStatus::RUNNING) {
+        return streaming_status;
+    }
+    for (size_t request_index = 0; request_index < handles.size(); ++request_index) {
+        if (!finished[request_index] && handles[request_index]) {
+            streaming_status == StreamingStatus::CANCEL ? handles[request_index]->cancel() : handles[request_index]->stop();
+        }
+    }
+    return streaming_status;
+}
 }
@@ -10,6 +10,7 @@
 #include "model_runner.hpp"
 #include "scheduler.hpp"
 #include "threaded_streamer.hpp"
+#include "incremental_chat_encoder.hpp"
 
 namespace ov::genai {
 
@@ -42,12 +43,49 @@ protected:
 
     bool m_is_chat_conversation = false;
     ChatHistory m_history;
+    IncrementalChatEncoder m_chat_encoder;
 
     float m_load_time_ms = 0.0f;
-    // to access m_load_time_ms
+    // Handles of requests added via ContinuousBatchingPipeline::add_request report to the queue if it's set
+    std::shared_ptr<GenerationCompletionQueue> m_completion_queue;
+    // to access m_load_time_ms and m_completion_queue
     friend class ContinuousBatchingPipeline;
 
     void stream_tokens(const std::shared_ptr<ThreadedStreamerWrapper>& streamer_ptr, const GenerationHandle& handle);
+
+    /**
+     * Writes new tokens of all requests of a batch to streamer at once, finished requests are marked in `finished`
+     * Requests without handles are not added to the pipeline yet and are skipped
+     */
+    StreamingStatus stream_batch_tokens(const std::shared_ptr<BatchStreamerBase>& streamer,
+                                        const std::vector<GenerationHandle>& handles,
+                                        std::vector<uint8_t>& finished);
+
+    // Receives index of a prompt and its token ids, may be called from several threads at once
+    using TokenizedPromptCallback = std::function<void(size_t prompt_idx, const ov::Tensor& input_ids)>;
+
+    /**
+     * Tokenizes prompts by batches of similar length in parallel, applying chat template if it's requested
+     * `on_tokenized` is called for each prompt as soon as its batch is tokenized
+     */
+    void tokenize_prompts(const std::vector<std::string>& prompts,
+                          const std::vector<GenerationConfig>& sampling_params,
+                          std::vector<MicroSeconds>& tokenization_durations,
+                          const TokenizedPromptCallback& on_tokenized);
+
+    std::vector<ov::Tensor> tokenize_prompts(const std::vector<std::string>& prompts,
+                                             const std::vector<GenerationConfig>& sampling_params,
+                                             std::vector<MicroSeconds>& tokenization_durations);
+
+    /**
+     * Tokenizes text prompts and generates results for them
+     * By default generation starts once all prompts are tokenized, pipelines may start it earlier
+     */
+    virtual std::vector<EncodedGenerationResult>
+    tokenize_and_generate(const std::vector<std::string>& prompts,
+                          const std::vector<GenerationConfig>& sampling_params,
+                          const StreamerVariant& streamer,
+                          std::vector<MicroSeconds>& tokenization_durations);
 public:
     GenerationConfig get_config() const;
     PipelineMetrics get_metrics() const;
@@ -67,7 +105,31 @@ public:
     virtual GenerationHandle add_request(uint64_t request_id,
                                          const std::string& prompt,
                                          GenerationConfig sampling_params) = 0;
-    
+
+    /**
+     * Adds request which restores KV cache of its prompt prefix from a host snapshot
+     */
+    virtual GenerationHandle add_request(uint64_t request_id,
+                                         const ov::Tensor& input_ids,
+                                         GenerationConfig sampling_params,
+                                         const KVCacheSnapshot& snapshot) {
+        OPENVINO_THROW("KV cache snapshots are not supported by the current pipeline");
+    }
+
+    /**
+     * Marks request to copy its KV cache to host memory once it's finished
+     */
+    virtual void park_kv_cache(uint64_t request_id) {
+        OPENVINO_THROW("KV cache snapshots are not supported by the current pipeline");
+    }
+
+    /**
+     * Returns KV cache snapshot of a parked request
+     */
+    virtual KVCacheSnapshot take_kv_cache_snapshot(uint64_t request_id) {
+        OPENVINO_THROW("KV cache snapshots are not supported by the current pipeline");
+    }
+
     /**
      * Checks whether server (pipeline) has non-finished requests and step() should be called within a loop
      */
@@ -0,0 +1,69 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "incremental_chat_encoder.hpp"
+
+namespace {
+
+// Length of the tail of previously templated history which is tokenized together with appended text to check the boundary
+constexpr size_t BOUNDARY_CONTEXT_LENGTH = 64;
+
+std::vector<int64_t> encode_without_special_tokens(ov::genai::Tokenizer& tokenizer, const std::string& text) {
+    // ov::genai::add_special_tokens(false) is aligned with stateful pipeline
+    ov::Tensor input_ids = tokenizer.encode(text, ov::genai::add_special_tokens(false)).input_ids;
+    return std::vector<int64_t>(input_ids.data<int64_t>(), input_ids.data<int64_t>() + input_ids.get_size());
+}
+
+}  // namespace
+
+namespace ov::genai {
+
+ov::Tensor IncrementalChatEncoder::encode(Tokenizer& tokenizer, const ChatHistory& history) {
+    constexpr bool add_generation_prompt = true;
+    return encode(tokenizer.apply_chat_template(history, add_generation_prompt), [&tokenizer](const std::string& text) {
+        return encode_without_special_tokens(tokenizer, text);
+    });
+}
+
+ov::Tensor IncrementalChatEncoder::encode(const std::string& templated_history, const EncodeFunction& encode_text) {
+    const bool is_appended = !m_templated_history.empty() && templated_history.size() > m_templated_history.size() &&
+        templated_history.compare(0, m_templated_history.size(), m_templated_history) == 0;
+    std::vector<int64_t> appended_ids;
+    if (is_appended) {
+        std::string appended_text = templated_history.substr(m_templated_history.size());
+        appended_ids = encode_text(appended_text);
+        if (!is_boundary_stable(encode_text, appended_text, appended_ids))
+            appended_ids.clear();
+    }
+
+    if (!appended_ids.empty()) {
+        m_history_ids.insert(m_history_ids.end(), appended_ids.begin(), appended_ids.end());
+    } else {
+        m_history_ids = encode_text(templated_history);
+    }
+    m_templated_history = templated_history;
+
+    ov::Tensor input_ids(ov::element::i64, {1, m_history_ids.size()});
+    std::copy(m_history_ids.begin(), m_history_ids.end(), input_ids.data<int64_t>());
+    return input_ids;
+}
+
+bool IncrementalChatEncoder::is_boundary_stable(const EncodeFunction& encode_text, const std::string& appended_text, const std::vector<int64_t>& appended_ids) {
+    // tokens might be merged across the boundary or tokenizer might add a prefix to the separately tokenized text
+    // (e.g. SentencePiece dummy prefix), such boundaries are detected on a short context before the boundary
+    size_t context_begin = m_templated_history.size() - std::min(m_templated_history.size(), BOUNDARY_CONTEXT_LENGTH);
+    while (context_begin < m_templated_history.size() && (static_cast<uint8_t>(m_templated_history[context_begin]) & 0xC0) == 0x80)
+        ++context_begin;
+    const std::string context = m_templated_history.substr(context_begin);
+
+    std::vector<int64_t> separate_ids = encode_text(context);
+    separate_ids.insert(separate_ids.end(), appended_ids.begin(), appended_ids.end());
+    return encode_text(context + appended_text) == separate_ids;
+}
+
+void IncrementalChatEncoder::reset() {
+    m_templated_history.clear();
+    m_history_ids.clear();
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,45 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "openvino/genai/tokenizer.hpp"
+
+namespace ov::genai {
+
+/**
+ * Encodes chat history with chat template applied, tokenizing only the text appended since the previous call.
+ * Previously templated history has to be a prefix of the new one and tokens at the boundary have to be stable,
+ * i.e. text around the boundary is tokenized the same way separately and as a whole. Otherwise the whole history
+ * is tokenized again, e.g. for templates which are not append-only or messages removed from history.
+ */
+class IncrementalChatEncoder {
+public:
+    using EncodeFunction = std::function<std::vector<int64_t>(const std::string& text)>;
+
+    /**
+     * @return Token ids of the whole templated history with generation prompt, tensor of shape [1, num_tokens]
+     */
+    ov::Tensor encode(Tokenizer& tokenizer, const ChatHistory& history);
+
+    /**
+     * @param templated_history history with chat template applied
+     * @param encode_text tokenizes text without special tokens
+     * @return Token ids of the whole templated history, tensor of shape [1, num_tokens]
+     */
+    ov::Tensor encode(const std::string& templated_history, const EncodeFunction& encode_text);
+
+    void reset();
+
+private:
+    bool is_boundary_stable(const EncodeFunction& encode_text, const std::string& appended_text, const std::vector<int64_t>& appended_ids);
+
+    std::string m_templated_history;
+    std::vector<int64_t> m_history_ids;
+};
+
+}  // namespace ov::genai
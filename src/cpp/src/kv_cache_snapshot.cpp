@@ -0,0 +1,115 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <fstream>
+
+#include "openvino/genai/kv_cache_snapshot.hpp"
+
+namespace {
+
+constexpr char snapshot_magic[4] = {'O', 'V', 'K', 'V'};
+constexpr uint32_t snapshot_version = 1;
+
+template <typename T>
+void write_value(std::ofstream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T read_value(std::ifstream& stream) {
+    T value{};
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    OPENVINO_ASSERT(stream.good(), "KV cache snapshot file is truncated");
+    return value;
+}
+
+void write_tensor(std::ofstream& stream, const ov::Tensor& tensor) {
+    const std::string type_name = tensor.get_element_type().get_type_name();
+    write_value<uint64_t>(stream, type_name.size());
+    stream.write(type_name.data(), type_name.size());
+
+    const ov::Shape& shape = tensor.get_shape();
+    write_value<uint64_t>(stream, shape.size());
+    for (size_t dim : shape) {
+        write_value<uint64_t>(stream, dim);
+    }
+
+    // ROI tensors are not continuous, so make a dense copy before writing
+    ov::Tensor dense = tensor.is_continuous() ? tensor : ov::Tensor(tensor.get_element_type(), shape);
+    if (!tensor.is_continuous()) {
+        tensor.copy_to(dense);
+    }
+    stream.write(static_cast<const char*>(dense.data()), dense.get_byte_size());
+}
+
+ov::Tensor read_tensor(std::ifstream& stream) {
+    std::string type_name(read_value<uint64_t>(stream), '\0');
+    stream.read(type_name.data(), type_name.size());
+
+    ov::Shape shape(read_value<uint64_t>(stream));
+    for (size_t& dim : shape) {
+        dim = read_value<uint64_t>(stream);
+    }
+
+    ov::Tensor tensor(ov::element::Type(type_name), shape);
+    stream.read(static_cast<char*>(tensor.data()), tensor.get_byte_size());
+    OPENVINO_ASSERT(stream.good(), "KV cache snapshot file is truncated");
+    return tensor;
+}
+
+}  // namespace
+
+namespace ov::genai {
+
+void KVCacheSnapshot::save(const std::filesystem::path& path) const {
+    OPENVINO_ASSERT(key_cache.size() == value_cache.size(), "KV cache snapshot must have equal number of key and value layers");
+
+    std::ofstream stream(path, std::ios::binary);
+    OPENVINO_ASSERT(stream.is_open(), "Cannot open file ", path, " to save KV cache snapshot");
+
+    stream.write(snapshot_magic, sizeof(snapshot_magic));
+    write_value(stream, snapshot_version);
+    write_value<uint64_t>(stream, block_size);
+
+    write_value<uint64_t>(stream, token_ids.size());
+    stream.write(reinterpret_cast<const char*>(token_ids.data()), token_ids.size() * sizeof(int64_t));
+
+    write_value<uint64_t>(stream, key_cache.size());
+    for (size_t layer_idx = 0; layer_idx < key_cache.size(); ++layer_idx) {
+        write_tensor(stream, key_cache[layer_idx]);
+        write_tensor(stream, value_cache[layer_idx]);
+    }
+
+    OPENVINO_ASSERT(stream.good(), "Failed to write KV cache snapshot to ", path);
+}
+
+KVCacheSnapshot KVCacheSnapshot::load(const std::filesystem::path& path) {
+    std::ifstream stream(path, std::ios::binary);
+    OPENVINO_ASSERT(stream.is_open(), "Cannot open KV cache snapshot file ", path);
+
+    char magic[sizeof(snapshot_magic)] = {};
+    stream.read(magic, sizeof(magic));
+    OPENVINO_ASSERT(stream.good() && std::equal(std::begin(magic), std::end(magic), std::begin(snapshot_magic)),
+                    path, " is not a KV cache snapshot file");
+    const auto version = read_value<uint32_t>(stream);
+    OPENVINO_ASSERT(version == snapshot_version, "Unsupported KV cache snapshot version ", version);
+
+    KVCacheSnapshot snapshot;
+    snapshot.block_size = read_value<uint64_t>(stream);
+
+    snapshot.token_ids.resize(read_value<uint64_t>(stream));
+    stream.read(reinterpret_cast<char*>(snapshot.token_ids.data()), snapshot.token_ids.size() * sizeof(int64_t));
+
+    const size_t num_layers = read_value<uint64_t>(stream);
+    snapshot.key_cache.reserve(num_layers);
+    snapshot.value_cache.reserve(num_layers);
+    for (size_t layer_idx = 0; layer_idx < num_layers; ++layer_idx) {
+        snapshot.key_cache.push_back(read_tensor(stream));
+        snapshot.value_cache.push_back(read_tensor(stream));
+    }
+
+    return snapshot;
+}
+
+}  // namespace ov::genai
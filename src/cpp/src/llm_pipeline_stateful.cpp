@@ -59,8 +59,6 @@ StatefulLLMPipeline::StatefulLLMPipeline(
     // If eos_token_id was not provided, take value
     if (m_generation_config.eos_token_id == -1)
         m_generation_config.set_eos_token_id(m_tokenizer.get_eos_token_id());
-
-    m_sampler.set_seed(m_generation_config.rng_seed);
 }
 
 StatefulLLMPipeline::StatefulLLMPipeline(
@@ -73,6 +71,8 @@ DecodedResults StatefulLLMPipeline::generate(
     StringInputs inputs,
     OptionalGenerationConfig generation_config,
     StreamerVariant streamer) {
+    utils::assert_no_batch_streamer(streamer, "LLMPipeline");
+
     if (is_chat_conversation && m_chat_input_type == ov::genai::utils::GenerationChatInputsType::UNDEF)
         m_chat_input_type = ov::genai::utils::GenerationChatInputsType::STRING;
 
@@ -309,10 +309,6 @@ EncodedResults StatefulLLMPipeline::generate(
         requests.push_back(sequence_group);
     }
 
-    if (m_sampler.get_seed() != config.rng_seed) {
-        m_sampler.set_seed(config.rng_seed);
-    }
-
     ov::genai::utils::GenerationFinishInfo finish_info = get_lm_encoded_results(m_model_runner, input_ids, concatenated_attention_mask, streamer_ptr, m_sampler,
                                                                                 requests, position_ids, m_kv_cache_state, std::nullopt, std::nullopt);
     ov::genai::EncodedResults& result = finish_info.results;
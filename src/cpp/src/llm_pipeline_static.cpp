@@ -715,7 +715,6 @@ StatefulLLMPipeline::StatefulLLMPipeline(
             compiled->export_model(fout);
         }
         m_request = compiled->create_infer_request();
-        m_sampler.set_seed(m_generation_config.rng_seed);
     }
 }
 
@@ -731,7 +730,6 @@ StatefulLLMPipeline::StatefulLLMPipeline(
     ov::AnyMap properties_copy = properties;
     auto compiled = setupAndCompileModel(model, properties_copy);
     m_request = compiled->create_infer_request();
-    m_sampler.set_seed(m_generation_config.rng_seed);
 }
 
 void StatefulLLMPipeline::updateStatefulConfig(ov::AnyMap& pipeline_config,
@@ -781,6 +779,7 @@ DecodedResults StatefulLLMPipeline::generate(
     OptionalGenerationConfig generation_config,
     StreamerVariant streamer
 ) {
+    utils::assert_no_batch_streamer(streamer, "LLMPipeline");
     auto start_time = std::chrono::steady_clock::now();
 
     GenerationConfig config = (generation_config.has_value()) ? *generation_config : m_generation_config;
@@ -922,6 +921,8 @@ EncodedResults StatefulLLMPipeline::generate(
 
     auto sequence_group = std::make_shared<SequenceGroup>(
         0 /* request_id */, input_ids, config, 1 /* block_size */);
+    m_sampler.prepare_structured_output(sequence_group->get_request_id(), config);
+    m_sampler.start_generation();
     sequence_group->schedule_tokens(sequence_group->get_prompt_len());
     sequence_group->set_output_seq_len(output_sequence_len);
 
@@ -87,7 +87,9 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
     std::optional<int64_t> rope_delta
 ) {
     std::vector<GenerationHandle> generations;
+    sampler.start_generation();
     for (SequenceGroup::Ptr sequence_group : sequence_groups) {
+        sampler.prepare_structured_output(sequence_group->get_request_id(), sequence_group->get_sampling_parameters());
         generations.push_back(std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(), sequence_group->get_sampling_parameters()));
     }
 
@@ -96,7 +98,7 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
     auto stream_generated_tokens = [&streamer_ptr, &generations, &active_sequence_groups]() {
         GenerationHandle& handle = generations.at(0);
         if (streamer_ptr && handle->can_read()) {
-            std::unordered_map<uint64_t, GenerationOutput> generation_outputs = handle->read();
+            std::unordered_map<uint64_t, GenerationOutput> generation_outputs = handle->read_available();
             OPENVINO_ASSERT(generation_outputs.size() <= 1);
             if (!generation_outputs.empty()) {
                 for (const auto& generated_token_id : generation_outputs.begin()->second.generated_ids) {
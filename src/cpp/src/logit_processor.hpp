@@ -4,9 +4,16 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstring>
 
 #include "openvino/genai/generation_config.hpp"
+#include "sampler_kernels.hpp"
+
+namespace ov::genai {
+class StructuredOutputTransform;
+}  // namespace ov::genai
 
 struct Token {
     float m_log_prob = 0.;
@@ -19,17 +26,37 @@ struct Token {
 struct Logits {
     float * m_data = nullptr;
     size_t m_size;
+    // Token ids of m_data elements when logits are computed only for a subset of vocabulary (e.g. model-side TopK),
+    // nullptr means that element index is a token id
+    const int64_t * m_token_ids = nullptr;
     // Late initialized for top_p or top_k transforms
     std::vector<Token> m_vector;
 
-    Logits(float* data, size_t size): m_data(data), m_size(size) {}
+    Logits(float* data, size_t size, const int64_t* token_ids = nullptr): m_data(data), m_size(size), m_token_ids(token_ids) {}
 
+    int64_t get_token_id(size_t idx) const {
+        return m_token_ids ? m_token_ids[idx] : static_cast<int64_t>(idx);
+    }
 
     void initialize_vector() {
         OPENVINO_ASSERT(m_vector.size() == 0, "Logits vector already initialized");
         m_vector.reserve(m_size);
         for (size_t i = 0; i < m_size; i++)
-            m_vector.emplace_back(m_data[i], i);   
+            m_vector.emplace_back(m_data[i], get_token_id(i));
+    }
+
+    /**
+     * Initializes vector only with elements satisfying the predicate, logits size is updated accordingly
+     * @param num_selected Expected number of selected elements
+     */
+    template <typename Predicate>
+    void initialize_vector(size_t num_selected, Predicate&& is_selected) {
+        OPENVINO_ASSERT(m_vector.size() == 0, "Logits vector already initialized");
+        m_vector.reserve(num_selected);
+        for (size_t i = 0; i < m_size; i++)
+            if (is_selected(m_data[i]))
+                m_vector.emplace_back(m_data[i], get_token_id(i));
+        m_size = m_vector.size();
     }
 
     bool is_vector_initialized() const {
@@ -54,50 +81,75 @@ public:
     }
 };
 
+// Logits are split into buckets by the highest bits of order preserving integer representation of their values,
+// which allows to find top elements with a couple of linear passes over raw logits and to materialize
+// only candidates, which may be kept by top_p / top_k filters
+constexpr size_t NUM_SELECTION_BUCKETS = 2048;
+
+inline size_t get_selection_bucket(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    return bits >> 21;
+}
+
+inline bool greater_probability(const Token& lhs, const Token& rhs) {
+    return lhs.m_log_prob > rhs.m_log_prob;
+}
+
 class TopPFilter : public ILogitTransformer {
 public:
     TopPFilter(double top_p) : m_top_p(top_p) {}
 
-    bool partial_sort_and_resize(Logits& logits) {
-        // Since most of the time huge part of logits vector contains minimal values 
-        // expensive sorting of entire vector might be unnecessary, especially for low values of top_p. 
-        // This method partially sorts vector finding M top elements and stops when top_p condition is met.
-        // It iterates a few times starting with M = 16 and multiplying it by 2 each iteration until M = 1024.
-        // If top_p is found in considered scope it resizes logits vector and returns true. Otherwise it returns false.
-        // Note that it can we less performant than standard approach if logits value are more evenly distributed across the vector.
-        for (size_t step = 16; step <= 1024; step *= 2) {
-            if (logits.m_vector.size() <= step)
-                break;
-            std::partial_sort(logits.m_vector.begin(), logits.m_vector.begin() + step, logits.m_vector.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
-            float sum = 0.0;
-            for (int i = 0; i < step; i++) {
-                sum += logits.m_vector[i].m_log_prob;
-                if (sum > m_top_p) {
-                    logits.resize(i+1);
-                    return true;
-                }
+    // Resizes sorted logits vector to the smallest prefix whose probabilities sum exceeds top_p.
+    // Returns false if top_p is not exceeded within the vector.
+    bool resize_to_nucleus(Logits& logits) {
+        float probability_sum = 0.0f;
+        for (size_t i = 0; i < logits.m_vector.size(); i++) {
+            probability_sum += logits.m_vector[i].m_log_prob;
+            if (probability_sum > m_top_p) {
+                logits.resize(i + 1);
+                return true;
             }
         }
         return false;
     }
 
-    void full_sort_and_resize(Logits& logits) {
-        std::sort(logits.m_vector.begin(), logits.m_vector.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
-        float probability_sum = 0.0f;
-        size_t nucleus_size = 0;
-        for (const auto& logit : logits.m_vector) {
-            probability_sum += logit.m_log_prob;
-            nucleus_size += 1;
-            if (probability_sum > m_top_p) break;
+    void apply(Logits& logits) override {
+        // Logits contain probabilities at this point. Probability mass per bucket gives the bucket where cumulative
+        // probability exceeds top_p, so only elements of this and higher buckets are materialized and sorted.
+        std::array<size_t, NUM_SELECTION_BUCKETS> counts{};
+        std::array<double, NUM_SELECTION_BUCKETS> masses{};
+        for (size_t i = 0; i < logits.m_size; i++) {
+            size_t bucket = get_selection_bucket(logits.m_data[i]);
+            counts[bucket]++;
+            masses[bucket] += logits.m_data[i];
+        }
+
+        size_t boundary_bucket = NUM_SELECTION_BUCKETS, num_candidates = 0;
+        double cumulative_mass = 0.0;
+        while (boundary_bucket > 0 && cumulative_mass <= m_top_p) {
+            --boundary_bucket;
+            cumulative_mass += masses[boundary_bucket];
+            num_candidates += counts[boundary_bucket];
+        }
+
+        const size_t size = logits.m_size;
+        if (cumulative_mass > m_top_p && num_candidates < size) {
+            logits.initialize_vector(num_candidates, [boundary_bucket](float value) {
+                return get_selection_bucket(value) >= boundary_bucket;
+            });
+            std::sort(logits.m_vector.begin(), logits.m_vector.end(), greater_probability);
+            if (resize_to_nucleus(logits))
+                return;
+            // rounding errors of the accumulated probability moved the nucleus border outside of selected candidates
+            logits.m_vector.clear();
+            logits.m_size = size;
         }
-        logits.resize(nucleus_size);
-    }
 
-    void apply(Logits& logits) override {
-        // Initialize and sort vector. Try partial sorting first and if it's not enough, sort entire vector.
         logits.initialize_vector();
-        if(!partial_sort_and_resize(logits))
-            full_sort_and_resize(logits);
+        std::sort(logits.m_vector.begin(), logits.m_vector.end(), greater_probability);
+        resize_to_nucleus(logits);
     }
 
 protected:
@@ -116,9 +168,19 @@ public:
         
         // If top_p is also used vector is already initialized and sorted
         if (!logits.is_vector_initialized()) {
-            // Initialize and partially sort vector
-            logits.initialize_vector();
-            std::partial_sort(logits.m_vector.begin(), logits.m_vector.begin() + m_top_k, logits.m_vector.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
+            // Find the bucket containing k-th largest element and materialize only elements of this and higher buckets
+            std::array<size_t, NUM_SELECTION_BUCKETS> counts{};
+            for (size_t i = 0; i < logits.m_size; i++)
+                counts[get_selection_bucket(logits.m_data[i])]++;
+
+            size_t boundary_bucket = NUM_SELECTION_BUCKETS, num_candidates = 0;
+            while (boundary_bucket > 0 && num_candidates < m_top_k)
+                num_candidates += counts[--boundary_bucket];
+
+            logits.initialize_vector(num_candidates, [boundary_bucket](float value) {
+                return get_selection_bucket(value) >= boundary_bucket;
+            });
+            std::partial_sort(logits.m_vector.begin(), logits.m_vector.begin() + m_top_k, logits.m_vector.end(), greater_probability);
         }
         logits.resize(m_top_k);
     }
@@ -132,22 +194,9 @@ public:
     TemperatureLogitTransform(double temperature) : m_temperature(temperature) {};
 
     void apply(Logits& logits) override {
-        float max_logit = -std::numeric_limits<float>::infinity();
-        for (size_t i = 0; i < logits.m_size; i++) {
-            if (logits.m_data[i] > max_logit) {
-                max_logit = logits.m_data[i];
-            }
-        }
-
-        float norm_sum = 0.0;
-        for (size_t i = 0; i < logits.m_size; i++) {
-            logits.m_data[i] = expf((logits.m_data[i] - max_logit) / this->m_temperature);
-            norm_sum += logits.m_data[i];
-        }
-
-        for (size_t i = 0; i < logits.m_size; i++) {
-            logits.m_data[i] /= norm_sum;
-        }
+        float max_logit = ov::genai::kernels::reduce_max(logits.m_data, logits.m_size);
+        float norm_sum = ov::genai::kernels::exp_inplace(logits.m_data, logits.m_size, max_logit, 1.0f / m_temperature);
+        ov::genai::kernels::scale_inplace(logits.m_data, logits.m_size, 1.0f / norm_sum);
     }
 
 protected:
@@ -155,81 +204,139 @@ protected:
 };
 
 
-class IPenaltyTransformer : public ILogitTransformer {
+/**
+ * Occurrences of prompt and generated tokens stored in a flat open addressing hash table.
+ * Entries are kept in a contiguous vector, so penalties visit only tokens occurred in prompt or generated text
+ * without pointer chasing. Counters are updated incrementally as tokens are generated or removed.
+ */
+class TokenOccurrences {
 public:
-    void set_unique_generated_token_ids(const std::shared_ptr<std::map<int64_t, size_t>>& unique_generated_token_ids) {
-        if (unique_generated_token_ids != nullptr) {
-            m_unique_generated_token_ids = unique_generated_token_ids;
-        } else {
-            m_unique_generated_token_ids = std::shared_ptr<std::map<int64_t, size_t>>(new std::map<int64_t, size_t>);
-        }
+    struct Entry {
+        int64_t token_id;
+        size_t generated_count = 0;
+        bool in_prompt = false;
+    };
+
+    void add_prompt_token(int64_t token_id) {
+        _find_or_insert(token_id).in_prompt = true;
     }
 
-    void extract_generated_tokens(const TokenIds& input_ids) {
-        set_unique_generated_token_ids(m_unique_generated_token_ids);
+    void add_generated_token(int64_t token_id) {
+        _find_or_insert(token_id).generated_count++;
+    }
 
-        for (const auto& input_id : input_ids) {
-            if (m_unique_generated_token_ids->count(input_id)) {
-                m_unique_generated_token_ids->at(input_id)++;
-            } else {
-                m_unique_generated_token_ids->insert({input_id, 1});
-            }
+    void remove_generated_token(int64_t token_id) {
+        size_t slot = m_slots.empty() ? 0 : _find_slot(token_id);
+        OPENVINO_ASSERT(!m_slots.empty() && m_slots[slot] != EMPTY_SLOT && m_entries[m_slots[slot]].generated_count > 0,
+                        "Token ", token_id, " was not generated");
+        m_entries[m_slots[slot]].generated_count--;
+    }
+
+    size_t get_generated_count(int64_t token_id) const {
+        if (m_slots.empty())
+            return 0;
+        size_t slot = _find_slot(token_id);
+        return m_slots[slot] == EMPTY_SLOT ? 0 : m_entries[m_slots[slot]].generated_count;
+    }
+
+    const std::vector<Entry>& get_entries() const {
+        return m_entries;
+    }
+
+private:
+    static constexpr uint32_t EMPTY_SLOT = std::numeric_limits<uint32_t>::max();
+
+    size_t _find_slot(int64_t token_id) const {
+        const size_t mask = m_slots.size() - 1;
+        uint64_t hash = static_cast<uint64_t>(token_id) * 0x9E3779B97F4A7C15ull;
+        size_t slot = static_cast<size_t>(hash ^ (hash >> 32)) & mask;
+        while (m_slots[slot] != EMPTY_SLOT && m_entries[m_slots[slot]].token_id != token_id)
+            slot = (slot + 1) & mask;
+        return slot;
+    }
+
+    Entry& _find_or_insert(int64_t token_id) {
+        OPENVINO_ASSERT(token_id >= 0, "input_ids token out of bounds");
+        // keep load factor below 0.5
+        if (2 * (m_entries.size() + 1) > m_slots.size()) {
+            m_slots.assign(std::max(size_t(16), 2 * m_slots.size()), EMPTY_SLOT);
+            for (size_t entry_idx = 0; entry_idx < m_entries.size(); ++entry_idx)
+                m_slots[_find_slot(m_entries[entry_idx].token_id)] = static_cast<uint32_t>(entry_idx);
+        }
+        size_t slot = _find_slot(token_id);
+        if (m_slots[slot] == EMPTY_SLOT) {
+            m_slots[slot] = static_cast<uint32_t>(m_entries.size());
+            m_entries.push_back({token_id});
         }
+        return m_entries[m_slots[slot]];
     }
 
-protected:
-    std::shared_ptr<std::map<int64_t, size_t>> m_unique_generated_token_ids = nullptr;
-    double m_penalty = 0.f;
+    std::vector<uint32_t> m_slots;
+    std::vector<Entry> m_entries;
 };
 
-class RepetitionPenaltyTransform : public IPenaltyTransformer {
+/**
+ * Applies repetition, presence and frequency penalties within a single pass over occurred tokens.
+ * Penalty with neutral value (1 for repetition, 0 for presence and frequency) is not applied.
+ * Penalties are applied to a logit one after another in this order, and each of them checks the sign
+ * of the logit left by the previous one, as separate transforms did.
+ */
+class PenaltyTransform : public ILogitTransformer {
 public:
-    RepetitionPenaltyTransform(double repetition_penalty) {
-        m_penalty = repetition_penalty;
-    };
+    PenaltyTransform(double repetition_penalty, double presence_penalty, double frequency_penalty) :
+        m_repetition_penalty(repetition_penalty), m_presence_penalty(presence_penalty), m_frequency_penalty(frequency_penalty) {}
+
+    void set_token_occurrences(const std::shared_ptr<TokenOccurrences>& token_occurrences) {
+        m_token_occurrences = token_occurrences;
+    }
 
     void apply(Logits& logits) override {
-        size_t vocab_size = logits.m_size;
-        for (const auto& prompt_id : *m_unique_prompt_token_ids) {
-            OPENVINO_ASSERT((prompt_id >= 0) && (prompt_id < vocab_size), "input_ids token out of bounds");
-            if (logits.m_data[prompt_id] >= 0) {
-                logits.m_data[prompt_id] /= m_penalty;
-            } else {
-                logits.m_data[prompt_id] *= m_penalty;
-            };
-        }
-        for (const auto& input_id_pair : *m_unique_generated_token_ids) {
-            const auto& input_id = input_id_pair.first;
-            if (1 == m_unique_prompt_token_ids->count(input_id)) {
-                // repetition_penalty was already accounted by the for
-                // loop above.
+        const size_t vocab_size = logits.m_size;
+        const bool apply_repetition_penalty = m_repetition_penalty != 1.0;
+        for (const auto& entry : m_token_occurrences->get_entries()) {
+            const bool is_generated = entry.generated_count > 0;
+            if (!is_generated && !(apply_repetition_penalty && entry.in_prompt))
                 continue;
+            OPENVINO_ASSERT(entry.token_id < vocab_size, "input_ids token out of bounds");
+
+            float& logit = logits.m_data[entry.token_id];
+            if (apply_repetition_penalty) {
+                logit = logit >= 0 ? logit / m_repetition_penalty : logit * m_repetition_penalty;
+            }
+            if (is_generated && m_presence_penalty != 0.0) {
+                logit = logit >= 0 ? logit - m_presence_penalty : logit + m_presence_penalty;
+            }
+            if (is_generated && m_frequency_penalty != 0.0) {
+                const double penalty = m_frequency_penalty * entry.generated_count;
+                logit = logit >= 0 ? logit - penalty : logit + penalty;
             }
-            OPENVINO_ASSERT((input_id >= 0) && (input_id < vocab_size), "input_ids token out of bounds");
-            if (logits.m_data[input_id] >= 0) {
-                logits.m_data[input_id] /= m_penalty;
-            } else {
-                logits.m_data[input_id] *= m_penalty;
-            };
         }
     }
 
     void apply(Logits& logits, const TokenIds& input_ids) {
-        set_unique_prompt_token_ids(nullptr);
-        extract_generated_tokens(input_ids);
+        for (const auto& input_id : input_ids)
+            m_token_occurrences->add_generated_token(input_id);
         apply(logits);
     }
 
-    void set_unique_prompt_token_ids(const std::shared_ptr<std::set<int64_t>>& unique_prompt_token_ids) {
-        if (unique_prompt_token_ids != nullptr) {
-            m_unique_prompt_token_ids = unique_prompt_token_ids;
-        } else {
-            m_unique_prompt_token_ids = std::shared_ptr<std::set<int64_t>>(new std::set<int64_t>);
-        }
-    }
-
 protected:
-    std::shared_ptr<std::set<int64_t>> m_unique_prompt_token_ids = nullptr;
+    double m_repetition_penalty = 1.0, m_presence_penalty = 0.0, m_frequency_penalty = 0.0;
+    std::shared_ptr<TokenOccurrences> m_token_occurrences = std::make_shared<TokenOccurrences>();
+};
+
+class RepetitionPenaltyTransform : public PenaltyTransform {
+public:
+    RepetitionPenaltyTransform(double repetition_penalty) : PenaltyTransform(repetition_penalty, 0.0, 0.0) {}
+};
+
+class FrequencyPenaltyTransform : public PenaltyTransform {
+public:
+    FrequencyPenaltyTransform(double value) : PenaltyTransform(1.0, 0.0, value) {}
+};
+
+class PresencePenaltyTransform : public PenaltyTransform {
+public:
+    PresencePenaltyTransform(double value) : PenaltyTransform(1.0, value, 0.0) {}
 };
 
 class EOSPenaltyTransform : public ILogitTransformer {
@@ -254,67 +361,18 @@ protected:
     std::set<int64_t> m_stop_token_ids;
 };
 
-class FrequencyPenaltyTransform : public IPenaltyTransformer {
-public:
-    FrequencyPenaltyTransform(double value) {
-        m_penalty = value;
-    };
-
-    void apply(Logits& logits) override {
-        size_t vocab_size = logits.m_size;
-        for (const auto& input_id_pair : *m_unique_generated_token_ids) {
-            const auto& input_id = input_id_pair.first;
-            OPENVINO_ASSERT((input_id >= 0) && (input_id < vocab_size), "input_ids token out of bounds");
-            if (logits.m_data[input_id] >= 0) {
-                logits.m_data[input_id] -= m_penalty * input_id_pair.second;
-            } else {
-                logits.m_data[input_id] += m_penalty * input_id_pair.second;
-            };
-        }
-    }
-
-    void apply(Logits& logits, const TokenIds& input_ids) {
-        extract_generated_tokens(input_ids);
-        apply(logits);
-    }
-};
-
-class PresencePenaltyTransform : public IPenaltyTransformer {
-public:
-    PresencePenaltyTransform(double value) {
-        m_penalty = value;
-    };
-
-    void apply(Logits& logits) override {
-        size_t vocab_size = logits.m_size;
-        for (const auto& input_id_pair : *m_unique_generated_token_ids) {
-            const auto& input_id = input_id_pair.first;
-            OPENVINO_ASSERT((input_id >= 0) && (input_id < vocab_size), "input_ids token out of bounds");
-            if (logits.m_data[input_id] >= 0) {
-                logits.m_data[input_id] -= m_penalty;
-            } else {
-                logits.m_data[input_id] += m_penalty;
-            };
-        }
-    }
-
-    void apply(Logits& logits, const TokenIds& input_ids) {
-        extract_generated_tokens(input_ids);
-        apply(logits);
-    }
-};
-
-
 } // namespace LogitTransformers
 
 class LogitProcessor {
 protected:
     std::vector<std::shared_ptr<LogitTransformers::ILogitTransformer>> m_logit_transformers;
     
-    std::shared_ptr<std::map<int64_t, size_t>> m_unique_generated_token_ids = std::shared_ptr<std::map<int64_t, size_t>>(new std::map<int64_t, size_t>);
-    std::shared_ptr<std::set<int64_t>> m_unique_prompt_token_ids = std::shared_ptr<std::set<int64_t>>(new std::set<int64_t>);
+    std::shared_ptr<LogitTransformers::TokenOccurrences> m_token_occurrences = std::make_shared<LogitTransformers::TokenOccurrences>();
     size_t m_generated_tokens = 0;
 
+    // masks tokens which do not match structured output config, depends on tokens generated by a sequence
+    std::shared_ptr<ov::genai::StructuredOutputTransform> m_structured_output;
+
     // speculative decoding parameters
     float m_assistant_confidence_threshold = 0.f;
 
@@ -322,8 +380,11 @@ protected:
 public:
     LogitProcessor(const ov::genai::GenerationConfig& sampling_params,
                    const LogitTransformers::TokenIds& input_ids) {
-        for (const auto& input_id : input_ids) {
-            m_unique_prompt_token_ids->insert(input_id);
+        // prompt tokens are penalized only by repetition penalty
+        if (sampling_params.repetition_penalty != 1.0f) {
+            for (const auto& input_id : input_ids) {
+                m_token_occurrences->add_prompt_token(input_id);
+            }
         }
 
         if (sampling_params.min_new_tokens > 0) {
@@ -333,24 +394,10 @@ public:
         }
 
         if (sampling_params.is_multinomial() || sampling_params.is_greedy_decoding()) {
-            if (sampling_params.repetition_penalty != 1.0f) {
-                std::shared_ptr<LogitTransformers::RepetitionPenaltyTransform> transformer = 
-                    std::shared_ptr<LogitTransformers::RepetitionPenaltyTransform>(new LogitTransformers::RepetitionPenaltyTransform(sampling_params.repetition_penalty));
-                transformer->set_unique_prompt_token_ids(m_unique_prompt_token_ids);
-                transformer->set_unique_generated_token_ids(m_unique_generated_token_ids);
-                m_logit_transformers.push_back(transformer);
-            }
-            if (sampling_params.presence_penalty != 0.0f) {
-                std::shared_ptr<LogitTransformers::PresencePenaltyTransform> transformer = 
-                    std::shared_ptr<LogitTransformers::PresencePenaltyTransform>(new LogitTransformers::PresencePenaltyTransform(sampling_params.presence_penalty)); 
-                transformer->set_unique_generated_token_ids(m_unique_generated_token_ids);
-                m_logit_transformers.push_back(transformer);
-                
-            }
-            if (sampling_params.frequency_penalty != 0.0f) {
-                std::shared_ptr<LogitTransformers::FrequencyPenaltyTransform> transformer = 
-                    std::shared_ptr<LogitTransformers::FrequencyPenaltyTransform>(new LogitTransformers::FrequencyPenaltyTransform(sampling_params.frequency_penalty));
-                transformer->set_unique_generated_token_ids(m_unique_generated_token_ids);
+            if (sampling_params.repetition_penalty != 1.0f || sampling_params.presence_penalty != 0.0f || sampling_params.frequency_penalty != 0.0f) {
+                auto transformer = std::make_shared<LogitTransformers::PenaltyTransform>(
+                    sampling_params.repetition_penalty, sampling_params.presence_penalty, sampling_params.frequency_penalty);
+                transformer->set_token_occurrences(m_token_occurrences);
                 m_logit_transformers.push_back(transformer);
             }
 
@@ -373,6 +420,14 @@ public:
         return m_assistant_confidence_threshold;
     }
 
+    void set_structured_output(std::shared_ptr<ov::genai::StructuredOutputTransform> structured_output) {
+        m_structured_output = std::move(structured_output);
+    }
+
+    const std::shared_ptr<ov::genai::StructuredOutputTransform>& get_structured_output() const {
+        return m_structured_output;
+    }
+
     void apply(Logits& logits) {
         for (const auto& transformer : m_logit_transformers) {
             if (transformer->is_applicable(m_generated_tokens)) {
@@ -390,17 +445,11 @@ public:
     }
 
     void register_new_generated_token(int64_t new_token_id) {
-        auto it = m_unique_generated_token_ids->find(new_token_id);
-        if (it == m_unique_generated_token_ids->end()) {
-            m_unique_generated_token_ids->insert({new_token_id, 1});
-        } else {
-            it->second++;
-        }
+        m_token_occurrences->add_generated_token(new_token_id);
     }
 
     void decrease_generated_token_occurance(int64_t token_id) {
-        OPENVINO_ASSERT(m_unique_generated_token_ids->count(token_id) > 0);
-        m_unique_generated_token_ids->at(token_id)--;
+        m_token_occurrences->remove_generated_token(token_id);
     }
 
 };
@@ -0,0 +1,90 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace ov::genai {
+
+/**
+ * Size-bounded cache which evicts the least recently used entry. Only hashes of keys are indexed, so a key is stored once
+ * even if it's large (e.g. a prompt text). Thread safe.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class LRUCache {
+public:
+    explicit LRUCache(size_t capacity) : m_capacity(capacity) {}
+
+    std::optional<Value> get(const Key& key) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto entry_it = find(key);
+        if (entry_it == m_entries.end())
+            return std::nullopt;
+        m_entries.splice(m_entries.begin(), m_entries, entry_it);
+        return entry_it->second;
+    }
+
+    void put(const Key& key, Value value) {
+        if (m_capacity == 0)
+            return;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto entry_it = find(key);
+        if (entry_it != m_entries.end()) {
+            entry_it->second = std::move(value);
+            m_entries.splice(m_entries.begin(), m_entries, entry_it);
+            return;
+        }
+
+        if (m_entries.size() == m_capacity) {
+            erase_from_index(std::prev(m_entries.end()));
+            m_entries.pop_back();
+        }
+        m_entries.emplace_front(key, std::move(value));
+        m_index.emplace(m_hash(key), m_entries.begin());
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_entries.size();
+    }
+
+    size_t capacity() const {
+        return m_capacity;
+    }
+
+private:
+    using Entries = std::list<std::pair<Key, Value>>;
+
+    typename Entries::iterator find(const Key& key) {
+        auto [begin, end] = m_index.equal_range(m_hash(key));
+        for (auto it = begin; it != end; ++it) {
+            if (it->second->first == key)
+                return it->second;
+        }
+        return m_entries.end();
+    }
+
+    void erase_from_index(typename Entries::iterator entry_it) {
+        auto [begin, end] = m_index.equal_range(m_hash(entry_it->first));
+        for (auto it = begin; it != end; ++it) {
+            if (it->second == entry_it) {
+                m_index.erase(it);
+                return;
+            }
+        }
+    }
+
+    size_t m_capacity;
+    Hash m_hash;
+    Entries m_entries;
+    std::unordered_multimap<size_t, typename Entries::iterator> m_index;
+    mutable std::mutex m_mutex;
+};
+
+}  // namespace ov::genai
@@ -28,7 +28,9 @@ inline std::string get_paged_attention_score_output_for_decoder_layer(size_t dec
  * KV cache block indices etc.) and returning the logit scores for the next token to be generated for each of the currently scheduled sequences.
  */
 class ModelRunner {
-    ov::InferRequest m_request;
+    // the first request is used for single stream execution,
+    // all requests are used to infer sub-batches concurrently in data parallel mode
+    std::vector<ov::InferRequest> m_requests;
     AttentionScoresForEachSubsequence m_last_attention_scores;
     size_t m_block_size;
     size_t m_num_decoder_layers;
@@ -40,6 +42,11 @@ class ModelRunner {
     std::vector<ov::Tensor> m_cache_rotation_deltas_for_each_layer;
     ov::Tensor m_cache_rotation_trig_lut;
 
+    // number of candidate logits produced by model-side TopK (see utils::apply_topk_logits_transformation), 0 if not available
+    size_t m_num_logits_candidates = 0;
+    // token ids of logits returned by the last `forward` call, empty if logits are computed for the whole vocabulary
+    ov::Tensor m_logits_token_ids;
+
 public:
     /**
      * Constructs the ModelRunner.
@@ -57,7 +64,27 @@ public:
                 bool collect_attention_scores = false,
                 bool is_use_per_layer_cache_control = false,
                 bool is_use_rotation_inputs = false)
-        : m_request(std::move(request)),
+        : ModelRunner(std::vector<ov::InferRequest>{std::move(request)},
+                      block_size,
+                      num_decoder_layers,
+                      collect_attention_scores,
+                      is_use_per_layer_cache_control,
+                      is_use_rotation_inputs) {}
+
+    /**
+     * Constructs the ModelRunner in data parallel mode.
+     * @param requests ov::InferRequest objects created from the same compiled model and bound to the same KV cache tensors.
+     * Scheduled sequence groups are split into up to requests.size() sub-batches, which are inferred concurrently, and
+     * the resulting logits are merged in the scheduling order. Attention scores collection and cache rotation are supported
+     * only with a single request.
+     */
+    ModelRunner(std::vector<ov::InferRequest> requests,
+                size_t block_size,
+                size_t num_decoder_layers = 1,
+                bool collect_attention_scores = false,
+                bool is_use_per_layer_cache_control = false,
+                bool is_use_rotation_inputs = false)
+        : m_requests(std::move(requests)),
           m_block_size(block_size),
           m_num_decoder_layers(num_decoder_layers),
           m_collect_attention_scores(collect_attention_scores),
@@ -65,6 +92,15 @@ public:
           m_is_use_rotation_inputs(is_use_rotation_inputs),
           m_rotated_block_logical_indices_per_sequence_for_each_layer(num_decoder_layers) {
         OPENVINO_ASSERT(m_num_decoder_layers != 0, "num_decoder_layers must be non-zero");
+        OPENVINO_ASSERT(!m_requests.empty(), "ModelRunner requires at least one infer request");
+        OPENVINO_ASSERT(m_requests.size() == 1 || !m_collect_attention_scores && !m_is_use_rotation_inputs,
+                        "Data parallel execution over multiple infer requests is not supported together with cache eviction");
+        for (const auto& output : m_requests.front().get_compiled_model().outputs()) {
+            const ov::PartialShape& pshape = output.get_partial_shape();
+            if (output.get_names().count("logits_candidates") > 0 && pshape.rank().is_static() && pshape[pshape.size() - 1].is_static()) {
+                m_num_logits_candidates = pshape[pshape.size() - 1].get_length();
+            }
+        }
         _reset_cache_rotation_coefficients();
     }
 
@@ -72,7 +108,22 @@ public:
      * @return The ov::InferRequest this ModelRunner is handling.
      */
     ov::InferRequest get_infer_request() {
-        return m_request;
+        return m_requests.front();
+    }
+
+    /**
+     * @return All ov::InferRequest objects this ModelRunner is handling.
+     */
+    const std::vector<ov::InferRequest>& get_infer_requests() const {
+        return m_requests;
+    }
+
+    /**
+     * @return Token ids of logits returned by the last `forward` call with shape equal to the logits shape,
+     * or an empty tensor if logits were computed for the whole vocabulary.
+     */
+    const ov::Tensor& get_logits_token_ids() const {
+        return m_logits_token_ids;
     }
 
     /**
@@ -104,14 +155,202 @@ public:
      * @return An ov::Tensor with next-token logit scores for each sequence processed during this `forward` call.
      */
     ov::Tensor forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
-        size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
+        const auto& scheduled_sequence_groups_ids = scheduler_output.m_scheduled_sequence_groups_ids;
+        const bool use_logits_candidates = _can_use_logits_candidates(sequence_groups, scheduled_sequence_groups_ids);
+        m_logits_token_ids = ov::Tensor();
+        if (m_requests.size() == 1 || scheduled_sequence_groups_ids.size() < 2) {
+            ov::InferRequest& request = m_requests.front();
+            _set_inputs(request, sequence_groups, scheduler_output, scheduled_sequence_groups_ids);
+
+            if (m_is_use_rotation_inputs) {
+                request.set_tensor("rotation_trig_lut", m_cache_rotation_trig_lut);
+                _set_cache_rotation_coefficients(sequence_groups, scheduler_output);
+            }
+
+            {
+                static ManualTimer timer("pure generate inference");
+                timer.start();
+                request.infer();
+                timer.end();
+            }
+
+            if (m_collect_attention_scores) {
+                _collect_attention_scores(sequence_groups, scheduler_output);
+            }
+
+            _reset_cache_rotation_coefficients();
+
+            if (use_logits_candidates) {
+                m_logits_token_ids = request.get_tensor("logits_candidates_token_ids");
+                return request.get_tensor("logits_candidates");
+            }
+
+            // return logits
+            return request.get_tensor("logits");
+        }
+
+        std::vector<std::vector<uint64_t>> sub_batches = split_into_sub_batches(sequence_groups, scheduled_sequence_groups_ids, m_requests.size());
+        for (size_t i = 0; i < sub_batches.size(); ++i) {
+            _set_inputs(m_requests[i], sequence_groups, scheduler_output, sub_batches[i]);
+        }
+
+        {
+            static ManualTimer timer("pure generate inference");
+            timer.start();
+            // sub-batches use disjoint KV cache blocks, so they can be inferred concurrently
+            std::exception_ptr exception = nullptr;
+            size_t num_started_requests = 1;
+            try {
+                for (; num_started_requests < sub_batches.size(); ++num_started_requests) {
+                    m_requests[num_started_requests].start_async();
+                }
+                m_requests[0].infer();
+            } catch (...) {
+                exception = std::current_exception();
+            }
+            // started requests use inputs and KV cache of this step, so all of them complete before an error is propagated
+            for (size_t i = 1; i < num_started_requests; ++i) {
+                try {
+                    m_requests[i].wait();
+                } catch (...) {
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+            timer.end();
+        }
+
+        _reset_cache_rotation_coefficients();
+
+        if (use_logits_candidates) {
+            m_logits_token_ids = _merge_outputs("logits_candidates_token_ids", sub_batches.size());
+            return _merge_outputs("logits_candidates", sub_batches.size());
+        }
+        return _merge_outputs("logits", sub_batches.size());
+    }
+
+    /**
+     * Splits scheduled sequence groups into at most max_num_sub_batches contiguous sub-batches with approximately equal
+     * number of tokens, so that concatenation of sub-batch logits preserves the order expected by the sampler.
+     */
+    static std::vector<std::vector<uint64_t>> split_into_sub_batches(const std::vector<SequenceGroup::Ptr>& sequence_groups,
+                                                                     const std::vector<uint64_t>& scheduled_sequence_groups_ids,
+                                                                     size_t max_num_sub_batches) {
+        const size_t num_sub_batches = std::min(max_num_sub_batches, scheduled_sequence_groups_ids.size());
+
+        std::vector<size_t> num_tokens_per_group;
+        num_tokens_per_group.reserve(scheduled_sequence_groups_ids.size());
+        size_t total_num_tokens = 0;
+        for (uint64_t seq_group_id : scheduled_sequence_groups_ids) {
+            SequenceGroup::CPtr sequence_group = sequence_groups[seq_group_id];
+            num_tokens_per_group.push_back(sequence_group->get_num_scheduled_tokens() * sequence_group->num_running_seqs());
+            total_num_tokens += num_tokens_per_group.back();
+        }
+
+        std::vector<std::vector<uint64_t>> sub_batches(1);
+        size_t num_tokens_in_closed_sub_batches = 0, num_tokens_in_current_sub_batch = 0;
+        for (size_t i = 0; i < scheduled_sequence_groups_ids.size(); ++i) {
+            const size_t num_groups_left = scheduled_sequence_groups_ids.size() - i;
+            const size_t num_sub_batches_left = num_sub_batches - sub_batches.size();
+            // close current sub-batch once it reaches its share of the remaining tokens, but keep at least one group per sub-batch
+            const size_t target_num_tokens = (total_num_tokens - num_tokens_in_closed_sub_batches) / (num_sub_batches_left + 1);
+            if (!sub_batches.back().empty() && num_sub_batches_left > 0 &&
+                (num_tokens_in_current_sub_batch >= target_num_tokens || num_groups_left == num_sub_batches_left)) {
+                num_tokens_in_closed_sub_batches += num_tokens_in_current_sub_batch;
+                num_tokens_in_current_sub_batch = 0;
+                sub_batches.emplace_back();
+            }
+            sub_batches.back().push_back(scheduled_sequence_groups_ids[i]);
+            num_tokens_in_current_sub_batch += num_tokens_per_group[i];
+        }
+
+        return sub_batches;
+    }
+
+    /**
+     * Concatenates outputs of sub-batches into a single tensor of shape [num_tokens, 1, N],
+     * where N is the last dimension of the outputs (e.g. vocabulary size for logits).
+     */
+    static ov::Tensor merge_outputs(const std::vector<ov::Tensor>& sub_batch_outputs) {
+        OPENVINO_ASSERT(!sub_batch_outputs.empty());
+        size_t total_num_elements = 0;
+        for (const auto& sub_output : sub_batch_outputs) {
+            total_num_elements += sub_output.get_size();
+        }
+
+        const ov::element::Type element_type = sub_batch_outputs.front().get_element_type();
+        const size_t last_dim = sub_batch_outputs.front().get_shape().back();
+        ov::Tensor merged(element_type, {total_num_elements / last_dim, 1, last_dim});
+        auto merged_data = static_cast<uint8_t*>(merged.data());
+        for (const auto& sub_output : sub_batch_outputs) {
+            OPENVINO_ASSERT(sub_output.get_element_type() == element_type && sub_output.is_continuous());
+            std::memcpy(merged_data, sub_output.data(), sub_output.get_byte_size());
+            merged_data += sub_output.get_byte_size();
+        }
+        return merged;
+    }
+
+private:
+    /**
+     * Concatenates given output of the first num_sub_batches requests, see merge_outputs()
+     */
+    ov::Tensor _merge_outputs(const std::string& output_name, size_t num_sub_batches) {
+        std::vector<ov::Tensor> sub_batch_outputs;
+        sub_batch_outputs.reserve(num_sub_batches);
+        for (size_t i = 0; i < num_sub_batches; ++i) {
+            sub_batch_outputs.push_back(m_requests[i].get_tensor(output_name));
+        }
+        return merge_outputs(sub_batch_outputs);
+    }
+
+    /**
+     * Checks whether candidate logits produced by model-side TopK are enough to sample all scheduled sequence groups:
+     * greedy or top-k multinomial sampling with 0 < top_k <= number of candidates (top_k = 0 disables top-k filtering) and
+     * without logit transformations which require the whole vocabulary (penalties, min_new_tokens, top_p, log probs, echo,
+     * structured output).
+     */
+    bool _can_use_logits_candidates(const std::vector<SequenceGroup::Ptr>& sequence_groups,
+                                    const std::vector<uint64_t>& scheduled_sequence_groups_ids) const {
+        if (m_num_logits_candidates == 0) {
+            return false;
+        }
+
+        for (uint64_t seq_group_id : scheduled_sequence_groups_ids) {
+            SequenceGroup::CPtr sequence_group = sequence_groups[seq_group_id];
+            const auto& sampling_params = sequence_group->get_sampling_parameters();
+            const bool is_supported_sampling = sampling_params.is_greedy_decoding() ||
+                (sampling_params.is_multinomial() && sampling_params.top_k > 0 && sampling_params.top_k <= m_num_logits_candidates &&
+                 sampling_params.top_p == 1.0f);
+            if (!is_supported_sampling || sampling_params.echo || sampling_params.logprobs > 0 ||
+                sampling_params.min_new_tokens > 0 || sampling_params.repetition_penalty != 1.0f ||
+                sampling_params.presence_penalty != 0.0f || sampling_params.frequency_penalty != 0.0f ||
+                sampling_params.structured_output_config.has_value() ||
+                sequence_group->get_num_tokens_to_validate() > 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Fills inputs of the given infer request to process the given scheduled sequence groups.
+     */
+    void _set_inputs(ov::InferRequest& request,
+                     const std::vector<SequenceGroup::Ptr>& sequence_groups,
+                     const Scheduler::Output& scheduler_output,
+                     const std::vector<uint64_t>& scheduled_sequence_groups_ids) {
+        size_t num_sequence_groups = scheduled_sequence_groups_ids.size();
         size_t batch_size_in_sequences = 0;
         size_t total_num_tokens = 0, total_num_blocks = 0;
         size_t max_context_len_val = 0;
 
         // compute aggregated values
         for (size_t i = 0; i < num_sequence_groups; ++i) {
-            size_t seq_group_id = scheduler_output.m_scheduled_sequence_groups_ids[i];
+            size_t seq_group_id = scheduled_sequence_groups_ids[i];
             SequenceGroup::CPtr sequence_group = sequence_groups[seq_group_id];
             size_t num_sequences = sequence_group->num_running_seqs();
             batch_size_in_sequences += num_sequences;
@@ -149,13 +388,13 @@ public:
         size_t gathering_current_index = 0;
         std::vector<int64_t> gather_indices_values;
         try {
-            std::ignore = m_request.get_tensor("sampled_tokens_indices");
+            std::ignore = request.get_tensor("sampled_tokens_indices");
             matmul_gathering_is_available = true;
         } catch (const ov::Exception&) {}
 
 
         for (size_t i = 0; i < num_sequence_groups; ++i) {
-            size_t seq_group_id = scheduler_output.m_scheduled_sequence_groups_ids[i];
+            size_t seq_group_id = scheduled_sequence_groups_ids[i];
             SequenceGroup::Ptr sequence_group = sequence_groups[seq_group_id];
             std::vector<Sequence::Ptr> running_sequences = sequence_group->get_running_sequences();
             size_t num_running_sequences = running_sequences.size();
@@ -214,26 +453,21 @@ public:
         }
 
         // typical LLM parameters
-        m_request.set_tensor("input_ids", input_ids);
-        m_request.set_tensor("position_ids", position_ids);
+        request.set_tensor("input_ids", input_ids);
+        request.set_tensor("position_ids", position_ids);
 
         // PA specific parameters
-        m_request.set_tensor("past_lens", past_lens);
-        m_request.set_tensor("subsequence_begins", subsequence_begins);
+        request.set_tensor("past_lens", past_lens);
+        request.set_tensor("subsequence_begins", subsequence_begins);
 
-        _set_block_indices(sequence_groups, scheduler_output, total_num_blocks);
-        m_request.set_tensor("block_indices_begins", block_indices_begins);
-        m_request.set_tensor("max_context_len", max_context_len);
-
-        if (m_is_use_rotation_inputs) {
-            m_request.set_tensor("rotation_trig_lut", m_cache_rotation_trig_lut);
-            _set_cache_rotation_coefficients(sequence_groups, scheduler_output);
-        }
+        _set_block_indices(request, sequence_groups, scheduler_output, scheduled_sequence_groups_ids, total_num_blocks);
+        request.set_tensor("block_indices_begins", block_indices_begins);
+        request.set_tensor("max_context_len", max_context_len);
 
         if (matmul_gathering_is_available) {
             ov::Tensor gather_indices(ov::element::i64, {gather_indices_values.size()});
             std::memcpy(gather_indices.data(), gather_indices_values.data(), gather_indices_values.size() * sizeof(int64_t));
-            m_request.set_tensor("sampled_tokens_indices", gather_indices);
+            request.set_tensor("sampled_tokens_indices", gather_indices);
         }
 
         // print_tensor("input_ids", input_ids);
@@ -244,43 +478,28 @@ public:
         // print_tensor("block_indices", block_indices);
         // print_tensor("block_indices_begins", block_indices_begins);
         // print_tensor("max_context_len", max_context_len);
-
-        {
-            static ManualTimer timer("pure generate inference");
-            timer.start();
-            m_request.infer();
-            timer.end();
-        }
-
-        if (m_collect_attention_scores) {
-            _collect_attention_scores(sequence_groups, scheduler_output);
-        }
-
-        _reset_cache_rotation_coefficients();
-
-        // return logits
-        return m_request.get_tensor("logits");
     }
 
-private:
     void _fill_indices_from_block_tables(
+        ov::InferRequest& request,
         const std::vector<std::string>& dst_tensor_names,
         const std::vector<SequenceGroup::Ptr>& sequence_groups,
         const Scheduler::Output& scheduler_output,
+        const std::vector<uint64_t>& scheduled_sequence_groups_ids,
         const std::vector<std::map<size_t, std::vector<size_t>>>& seq_id_to_select_logical_idx_maps) {
         OPENVINO_ASSERT(seq_id_to_select_logical_idx_maps.size() == dst_tensor_names.size() ||
                         seq_id_to_select_logical_idx_maps.empty());
         bool is_fill_all = seq_id_to_select_logical_idx_maps.empty();
-        size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
+        size_t num_sequence_groups = scheduled_sequence_groups_ids.size();
         std::vector<size_t> filled_blocks_per_layer(dst_tensor_names.size(), 0);
 
 
         for (size_t layer_idx = 0; layer_idx < dst_tensor_names.size(); layer_idx++) {
-            auto input_tensor = m_request.get_tensor(dst_tensor_names[layer_idx]);
+            auto input_tensor = request.get_tensor(dst_tensor_names[layer_idx]);
             auto block_indices_data = input_tensor.data<int32_t>();
             if (is_fill_all) {
                 for (size_t i = 0; i < num_sequence_groups; ++i) {
-                    size_t seq_group_id = scheduler_output.m_scheduled_sequence_groups_ids[i];
+                    size_t seq_group_id = scheduled_sequence_groups_ids[i];
                     SequenceGroup::CPtr sequence_group = sequence_groups[seq_group_id];
                     std::vector<Sequence::CPtr> running_sequences = sequence_group->get_running_sequences();
                     size_t num_running_sequences = running_sequences.size();
@@ -325,14 +544,16 @@ private:
         }
         for (size_t layer_idx = 0; layer_idx < dst_tensor_names.size(); layer_idx++) {
             const auto& target_tensor_name = dst_tensor_names[layer_idx];
-            size_t tensor_size = m_request.get_tensor(target_tensor_name).get_size();
+            size_t tensor_size = request.get_tensor(target_tensor_name).get_size();
             size_t last_filled_element_idx = filled_blocks_per_layer[layer_idx];
             OPENVINO_ASSERT(tensor_size == last_filled_element_idx, "did not fill tensor ", target_tensor_name, " completely, tensor size in elements ", tensor_size, ", last filled idx ", last_filled_element_idx);
         }
     }
 
-    void _set_block_indices(const std::vector<SequenceGroup::Ptr>& sequence_groups,
+    void _set_block_indices(ov::InferRequest& request,
+                            const std::vector<SequenceGroup::Ptr>& sequence_groups,
                             const Scheduler::Output& scheduler_output,
+                            const std::vector<uint64_t>& scheduled_sequence_groups_ids,
                             size_t total_num_blocks) {
         std::vector<std::string> tensor_names = {"block_indices"};
 
@@ -344,14 +565,16 @@ private:
         }
 
         for (auto& name : tensor_names) {
-            m_request.get_tensor(name).set_shape({total_num_blocks});
+            request.get_tensor(name).set_shape({total_num_blocks});
         }
 
-        _fill_indices_from_block_tables(tensor_names, sequence_groups, scheduler_output, {});
+        _fill_indices_from_block_tables(request, tensor_names, sequence_groups, scheduler_output, scheduled_sequence_groups_ids, {});
     }
 
     void _set_cache_rotation_coefficients(const std::vector<SequenceGroup::Ptr>& sequence_groups,
                                           const Scheduler::Output& scheduler_output) {
+        // cache rotation is supported only in single request mode
+        ov::InferRequest& request = m_requests.front();
         std::vector<std::string> rotation_indices_tensor_names(m_num_decoder_layers);
         for (size_t i = 0; i < m_num_decoder_layers; i++) {
             auto tensor_name = std::string("rotated_block_indices.") + std::to_string(i);
@@ -360,21 +583,23 @@ private:
             for (const auto& entry : m_rotated_block_logical_indices_per_sequence_for_each_layer[i]) {
                 num_indices += entry.second.size();
             }
-            auto rotated_block_indices_tensor = m_request.get_tensor(tensor_name);
+            auto rotated_block_indices_tensor = request.get_tensor(tensor_name);
             rotated_block_indices_tensor.set_shape({num_indices});
         }
 
         for (size_t i = 0; i < m_num_decoder_layers; i++) {
             auto tensor_name = std::string("rotation_deltas.") + std::to_string(i);
-            m_request.set_tensor(tensor_name, m_cache_rotation_deltas_for_each_layer[i]);
+            request.set_tensor(tensor_name, m_cache_rotation_deltas_for_each_layer[i]);
         }
 
 
         // NB: the order of per-sequence index filling in the function below must be the same
         // as the order of `seq_id`s in which the "rotation_coefficients.N" inputs are filled
-        _fill_indices_from_block_tables(rotation_indices_tensor_names,
+        _fill_indices_from_block_tables(request,
+                                        rotation_indices_tensor_names,
                                         sequence_groups,
                                         scheduler_output,
+                                        scheduler_output.m_scheduled_sequence_groups_ids,
                                         m_rotated_block_logical_indices_per_sequence_for_each_layer);
     }
 
@@ -411,7 +636,7 @@ private:
             size_t global_sequence_id = seq_id_and_score_span.first;
             IndexSpan span = seq_id_and_score_span.second;
             for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; decoder_layer_id++) {
-                auto attention_score = m_request.get_tensor(get_paged_attention_score_output_for_decoder_layer(decoder_layer_id));
+                auto attention_score = m_requests.front().get_tensor(get_paged_attention_score_output_for_decoder_layer(decoder_layer_id));
                 auto scores_for_cache_of_current_sequence_group = ov::Tensor(attention_score, ov::Coordinate{span.first}, ov::Coordinate{span.second});
                 auto copied_tensor = ov::Tensor(scores_for_cache_of_current_sequence_group.get_element_type(), ov::Shape{span.second - span.first});
                 scores_for_cache_of_current_sequence_group.copy_to(copied_tensor);
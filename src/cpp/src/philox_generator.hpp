@@ -0,0 +1,84 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace ov::genai {
+
+/**
+ * Counter-based random number generator (Philox4x32-10).
+ * Random stream is fully defined by a key and a counter, so it does not hold any state shared between requests.
+ * Sampler creates a separate stream for every sequence and token position, keyed by rng_seed of the request and
+ * generation id of the pipeline, which makes sampling results independent of batch composition, order of processing
+ * and number of threads.
+ */
+class PhiloxGenerator {
+public:
+    using result_type = uint32_t;
+    using Counter = std::array<uint32_t, 4>;
+    using Key = std::array<uint32_t, 2>;
+
+    PhiloxGenerator(uint64_t seed, uint64_t generation_id, uint64_t request_id, uint64_t sequence_id, uint64_t position) {
+        const uint64_t key = splitmix64(seed ^ splitmix64(sequence_id ^ splitmix64(generation_id)));
+        m_key = {static_cast<uint32_t>(key), static_cast<uint32_t>(key >> 32)};
+        m_counter = {0, static_cast<uint32_t>(position), static_cast<uint32_t>(request_id), static_cast<uint32_t>(request_id >> 32)};
+    }
+
+    static constexpr result_type min() {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() {
+        if (m_output_idx == m_output.size()) {
+            m_output = philox4x32_10(m_counter, m_key);
+            ++m_counter[0];
+            m_output_idx = 0;
+        }
+        return m_output[m_output_idx++];
+    }
+
+    /**
+     * @return Uniformly distributed value in [0, 1) with 53 bits of precision, identical on all platforms
+     */
+    double uniform() {
+        const uint64_t high = (*this)() >> 5, low = (*this)() >> 6;
+        return static_cast<double>((high << 26) | low) * (1.0 / static_cast<double>(uint64_t(1) << 53));
+    }
+
+    static Counter philox4x32_10(Counter counter, Key key) {
+        constexpr uint32_t multiplier_0 = 0xD2511F53, multiplier_1 = 0xCD9E8D57;
+        constexpr uint32_t weyl_0 = 0x9E3779B9, weyl_1 = 0xBB67AE85;
+        for (size_t round = 0; round < 10; ++round) {
+            const uint64_t product_0 = static_cast<uint64_t>(multiplier_0) * counter[0];
+            const uint64_t product_1 = static_cast<uint64_t>(multiplier_1) * counter[2];
+            counter = {static_cast<uint32_t>(product_1 >> 32) ^ counter[1] ^ key[0], static_cast<uint32_t>(product_1),
+                       static_cast<uint32_t>(product_0 >> 32) ^ counter[3] ^ key[1], static_cast<uint32_t>(product_0)};
+            key[0] += weyl_0;
+            key[1] += weyl_1;
+        }
+        return counter;
+    }
+
+private:
+    static uint64_t splitmix64(uint64_t value) {
+        value += 0x9E3779B97F4A7C15ull;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
+    Counter m_counter;
+    Key m_key;
+    Counter m_output{};
+    size_t m_output_idx = m_output.size();
+};
+
+}  // namespace ov::genai
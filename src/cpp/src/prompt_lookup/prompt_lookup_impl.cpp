@@ -99,6 +99,7 @@ ContinuousBatchingPipeline::PromptLookupImpl::generate(const std::vector<ov::Ten
 
     OPENVINO_ASSERT(!has_non_finished_requests(), "Generate cannot be called while ContinuousBatchingPipeline is already in running state. Use ContinuousBatchingPipeline::add_request");
     OPENVINO_ASSERT(input_ids.size() == sampling_params.size());
+    utils::assert_no_batch_streamer(streamer, "Prompt lookup");
 
     ManualTimer generate_timer("speculative_decoding: generate()");
     generate_timer.start();
@@ -109,6 +110,7 @@ ContinuousBatchingPipeline::PromptLookupImpl::generate(const std::vector<ov::Ten
             "LoRA adapters value must be the same for all requests");
     }
     m_pipeline->set_adapters(sampling_params[0].adapters);
+    m_pipeline->start_generation();
 
     const auto streamer_ptr = std::make_shared<ThreadedStreamerWrapper>(streamer, m_tokenizer);
 
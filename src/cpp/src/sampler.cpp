@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <future>
+#include <numeric>
 #include "sampler.hpp"
+#include "sampler_kernels.hpp"
+#include "openvino/core/parallel.hpp"
 
 namespace ov::genai {
 // Modified Knuth–Morris–Pratt algorithm which returns tokens following after every needle occurrence in haystack
@@ -54,20 +57,53 @@ std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx) {
 
     size_t batch_offset = batch_idx * seq_len * vocab_size, sequence_offset = (seq_len - 1) * vocab_size;
     const float* beam_logits = logits.data<const float>() + batch_offset + sequence_offset;
-    float max_logit = *std::max_element(beam_logits, beam_logits + vocab_size);
-    float log_sum = std::log(std::accumulate(
-        beam_logits, beam_logits + vocab_size, 0.0f, [max_logit](float accumulated, float to_add) {
-            return accumulated + std::exp(to_add - max_logit);
-    }));
+    float log_sum = kernels::log_sum_exp(beam_logits, vocab_size);
 
     std::vector<Token> tokens;
     tokens.reserve(vocab_size);
     for (size_t idx = 0; idx < vocab_size; ++idx)
-        tokens.push_back({beam_logits[idx] - max_logit - log_sum, int64_t(idx)});
+        tokens.push_back({beam_logits[idx] - log_sum, int64_t(idx)});
 
     return tokens;
 }
 
+std::vector<Token> log_softmax_top_k(const ov::Tensor& logits, size_t batch_idx, size_t top_k,
+                                     const std::unordered_map<int64_t, float>& log_prob_offsets) {
+    ov::Shape shape = logits.get_shape();
+    OPENVINO_ASSERT(shape.size() == 3);
+    size_t batch = shape[0], seq_len = shape[1], vocab_size = shape[2];
+    OPENVINO_ASSERT(batch_idx < batch, "Logits batch size doesn't match the number of beams");
+
+    size_t batch_offset = batch_idx * seq_len * vocab_size, sequence_offset = (seq_len - 1) * vocab_size;
+    const float* beam_logits = logits.data<const float>() + batch_offset + sequence_offset;
+    float log_sum = kernels::log_sum_exp(beam_logits, vocab_size);
+
+    // Tokens with offsets are evaluated explicitly, while the rest of top_k tokens belongs to
+    // top (top_k + number of offsets) tokens of unmodified logits
+    size_t num_selected = std::min(vocab_size, top_k + log_prob_offsets.size());
+    std::vector<float> top_values(num_selected, -std::numeric_limits<float>::infinity());
+    std::vector<size_t> top_indexes(num_selected, 0);
+    kernels::top_m(beam_logits, vocab_size, num_selected, top_values.data(), top_indexes.data());
+
+    std::vector<Token> tokens;
+    tokens.reserve(num_selected + log_prob_offsets.size());
+    for (size_t i = 0; i < num_selected; ++i) {
+        if (log_prob_offsets.count(static_cast<int64_t>(top_indexes[i])) == 0)
+            tokens.emplace_back(top_values[i] - log_sum, static_cast<int64_t>(top_indexes[i]));
+    }
+    for (const auto& [token_id, offset] : log_prob_offsets) {
+        OPENVINO_ASSERT(token_id >= 0 && static_cast<size_t>(token_id) < vocab_size, "Token id ", token_id, " is out of vocabulary");
+        tokens.emplace_back(beam_logits[token_id] - log_sum + offset, token_id);
+    }
+
+    size_t num_tokens = std::min(top_k, tokens.size());
+    std::partial_sort(tokens.begin(), tokens.begin() + num_tokens, tokens.end(), [](const Token& left, const Token& right) {
+        return left.m_log_prob > right.m_log_prob;  // Most probable tokens in front
+    });
+    tokens.resize(num_tokens);
+    return tokens;
+}
+
 std::vector<int64_t> wrap_tokens(const std::vector<int64_t>& tokens, const std::vector<int64_t>& prefix_tokens, const std::vector<int64_t>& suffix_tokens) {
     std::vector<int64_t> all_tokens = prefix_tokens;
     all_tokens.insert(all_tokens.end(), tokens.begin(), tokens.end());
@@ -96,13 +132,6 @@ std::vector<int64_t> encode_and_process_string(const std::string& stop_string, o
     return encoded_stop_string;
 }
 
-struct MatchStopStringResult {
-    size_t to_remove = 0;
-    // int64_t last_token_id = 0;
-    // bool is_to_update_last_token = false;
-    bool is_matched = false;
-};
-
 // Return number of last tokens that match one of the stop_strings. If there's no match 0 is returned.
 MatchStopStringResult match_stop_string(Tokenizer& tokenizer,
                       const TokenIds& generated_tokens,
@@ -321,17 +350,19 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
         if (group.done)
             continue;
 
-        std::vector<Beam> candidates;
-        candidates.reserve(group_size * 2 * group_size);
-        for (const Beam& beam : group.ongoing) {
-            std::vector<Token> tokens = log_softmax(logits, beam.m_global_beam_idx);
-
-            // apply diversity penalty
-            for (auto prev_group_id = 0; prev_group_id < group_id; ++prev_group_id) {
-                for (const Beam& prev_beam : child_beams_per_group[prev_group_id]) {
-                    tokens[prev_beam.m_token_id].m_log_prob -= m_parameters.diversity_penalty;
-                }
+        // diversity penalty for tokens selected by previous groups
+        std::unordered_map<int64_t, float> diversity_offsets;
+        for (auto prev_group_id = 0; prev_group_id < group_id; ++prev_group_id) {
+            for (const Beam& prev_beam : child_beams_per_group[prev_group_id]) {
+                diversity_offsets[prev_beam.m_token_id] -= m_parameters.diversity_penalty;
             }
+        }
+
+        // Expand beams of a group in parallel, since they depend only on child beams of previous groups
+        std::vector<std::vector<Token>> tokens_per_beam(group.ongoing.size());
+        ov::parallel_for(group.ongoing.size(), [&](size_t beam_idx) {
+            const Beam& beam = group.ongoing[beam_idx];
+            std::unordered_map<int64_t, float> log_prob_offsets = diversity_offsets;
 
             // apply n_gramm
             std::vector<int64_t> full_text{m_sequence_group->get_prompt_ids()};
@@ -339,17 +370,19 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
             if (full_text.size() > 1 && full_text.size() >= m_parameters.no_repeat_ngram_size) {
                 auto tail_start = full_text.end() - ptrdiff_t(m_parameters.no_repeat_ngram_size) + 1;
                 for (int64_t banned_token : kmp_search(full_text, {tail_start, full_text.end()})) {
-                    tokens[banned_token].m_log_prob = -std::numeric_limits<float>::infinity();
+                    log_prob_offsets[banned_token] = -std::numeric_limits<float>::infinity();
                 }
             }
 
-            // sort tokens
-            std::sort(tokens.begin(), tokens.end(), [](Token left, Token right) {
-                return left.m_log_prob > right.m_log_prob;  // Most probable tokens in front
-            });
+            // only 2 * group_size most probable tokens of each beam can become candidates
+            tokens_per_beam[beam_idx] = log_softmax_top_k(logits, beam.m_global_beam_idx, 2 * group_size, log_prob_offsets);
+        });
 
-            size_t add_count = 0;
-            for (Token token : tokens) {
+        std::vector<Beam> candidates;
+        candidates.reserve(group_size * 2 * group_size);
+        for (size_t beam_idx = 0; beam_idx < group.ongoing.size(); ++beam_idx) {
+            const Beam& beam = group.ongoing[beam_idx];
+            for (const Token& token : tokens_per_beam[beam_idx]) {
                 Beam new_candidate = beam;
                 new_candidate.m_score += new_candidate.m_log_prob = token.m_log_prob;
                 new_candidate.m_token_id = token.m_index;
@@ -360,9 +393,6 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
                     try_to_finish_candidate(group, new_candidate);
                 } else {
                     candidates.push_back(new_candidate);
-                    if (++add_count == 2 * group_size) {
-                        break;
-                    }
                 }
             }
         }
@@ -476,7 +506,7 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
     }
 }
 
-Logits Sampler::_get_logit_vector(ov::Tensor logits, size_t batch_idx, size_t token_idx) {
+Logits Sampler::_get_logit_vector(ov::Tensor logits, size_t batch_idx, size_t token_idx, const ov::Tensor& logits_token_ids) {
     ov::Shape logits_shape = logits.get_shape();
     size_t batch_size = logits_shape[0], seq_len = logits_shape[1], vocab_size = logits_shape[2];
     OPENVINO_ASSERT(batch_idx <= batch_size);
@@ -484,69 +514,85 @@ Logits Sampler::_get_logit_vector(ov::Tensor logits, size_t batch_idx, size_t to
     size_t batch_offset = batch_idx * seq_len * vocab_size;
     size_t sequence_offset = (seq_len - token_idx - 1) * vocab_size;
     float* logits_data = logits.data<float>() + batch_offset + sequence_offset;
+    const int64_t* token_ids_data = logits_token_ids ? logits_token_ids.data<const int64_t>() + batch_offset + sequence_offset : nullptr;
 
-    return Logits{logits_data, vocab_size};
+    return Logits{logits_data, vocab_size, token_ids_data};
 }
 
 Token Sampler::_greedy_sample(const Logits& logits, size_t top_logprobs) const {
     // For greedy sampling we do not expect sorting or shrinking considered tokens
     // so we can operate directly on the data buffer
-    size_t m = std::max(size_t(1), top_logprobs); // ensure m is at least 1
-    std::vector<float> top_values(m, -std::numeric_limits<float>::infinity());
-    std::vector<size_t> top_indexes(m, 0);
-
-    for (size_t i = 0; i < logits.m_size; ++i) {
-        if (logits.m_data[i] > top_values.back()) {
-            top_values.back() = logits.m_data[i];
-            top_indexes.back() = i;
-
-            for (size_t j = top_values.size() - 1; j > 0 && top_values[j] > top_values[j - 1]; --j) {
-                std::swap(top_values[j], top_values[j - 1]);
-                std::swap(top_indexes[j], top_indexes[j - 1]);
-            }
-        }
+    size_t max_index = 0;
+    if (top_logprobs > 1) {
+        std::vector<float> top_values(top_logprobs, -std::numeric_limits<float>::infinity());
+        std::vector<size_t> top_indexes(top_logprobs, 0);
+        kernels::top_m(logits.m_data, logits.m_size, top_logprobs, top_values.data(), top_indexes.data());
+        max_index = top_indexes.front();
+    } else {
+        max_index = kernels::argmax(logits.m_data, logits.m_size);
     }
 
-    size_t max_index = top_indexes.front();
     float max_value = 0.0;
 
     if (top_logprobs) {
         // apply log softmax to max value
-        max_value = top_values.front();
-        float log_sum = std::log(std::accumulate(
-            logits.m_data, logits.m_data + logits.m_size, 0.0f, [max_value](float accumulated, float to_add) {
-                return accumulated + std::exp(to_add - max_value);
-        }));
-        max_value = -log_sum;
+        max_value = -std::log(kernels::exp_sum(logits.m_data, logits.m_size, logits.m_data[max_index]));
     }
 
-    return Token(max_value, max_index);
+    return Token(max_value, logits.get_token_id(max_index));
 }
 
-std::vector<Token> Sampler::_multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence) {
+std::vector<Token> Sampler::_multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence, PhiloxGenerator& rng) {
     // If top_p or top_k was applied we use sorted vector, if not we go with original buffer.
-    std::vector<float> multinomial_weights;
-    multinomial_weights.reserve(logits.m_size);
-    if (logits.is_vector_initialized())
-        for (auto& logit: logits.m_vector) multinomial_weights.emplace_back(logit.m_log_prob);
-    else
-        multinomial_weights.assign(logits.m_data, logits.m_data + logits.m_size);
-
-    // std::discrete_distribution returns corrupted results when applied to log probabilities
-    // which result returning NAN only logprobs.
-    // so log() is applied after this line
-    auto dist = std::discrete_distribution<size_t>(multinomial_weights.begin(), multinomial_weights.end()); // equivalent to multinomial with number of trials == 1
+    // Weights are probabilities, which are not necessarily normalized after top_p / top_k filtering.
+    const bool is_vector_initialized = logits.is_vector_initialized();
+    const size_t num_candidates = is_vector_initialized ? logits.m_vector.size() : logits.m_size;
+    auto get_weight = [&logits, is_vector_initialized](size_t idx) {
+        return is_vector_initialized ? logits.m_vector[idx].m_log_prob : logits.m_data[idx];
+    };
+
+    double total_weight = 0.0;
+    for (size_t idx = 0; idx < num_candidates; ++idx)
+        total_weight += get_weight(idx);
+
+    // Inverse CDF sampling: all draws are resolved within a single pass over candidates by visiting
+    // uniform thresholds in ascending order. Scratch buffers are reused by sampling threads to avoid allocations.
+    thread_local std::vector<std::pair<double, size_t>> thresholds;
+    thresholds.clear();
+    for (size_t token_idx = 0; token_idx < num_tokens_per_sequence; ++token_idx)
+        thresholds.emplace_back(rng.uniform() * total_weight, token_idx);
+    if (num_tokens_per_sequence > 1)
+        std::sort(thresholds.begin(), thresholds.end());
+
+    thread_local std::vector<size_t> elements_to_pick;
+    elements_to_pick.assign(num_tokens_per_sequence, 0);
+
+    double cumulative_weight = 0.0;
+    size_t last_positive_idx = 0, threshold_idx = 0;
+    for (size_t idx = 0; idx < num_candidates && threshold_idx < thresholds.size(); ++idx) {
+        const float weight = get_weight(idx);
+        if (!(weight > 0.0f))
+            continue;
+        cumulative_weight += weight;
+        last_positive_idx = idx;
+        for (; threshold_idx < thresholds.size() && thresholds[threshold_idx].first < cumulative_weight; ++threshold_idx)
+            elements_to_pick[thresholds[threshold_idx].second] = idx;
+    }
+    // thresholds which were not reached due to rounding errors are assigned to the last non-zero candidate
+    for (; threshold_idx < thresholds.size(); ++threshold_idx)
+        elements_to_pick[thresholds[threshold_idx].second] = last_positive_idx;
 
+    // std::log is applied to sampled probabilities only
     std::vector<Token> out_tokens;
-    for (size_t token_idx = 0; token_idx < num_tokens_per_sequence; ++token_idx) {
-        size_t element_to_pick = dist(rng_engine);
-        if (logits.is_vector_initialized()) {
+    out_tokens.reserve(num_tokens_per_sequence);
+    for (size_t element_to_pick : elements_to_pick) {
+        if (is_vector_initialized) {
             auto logit = logits.m_vector[element_to_pick];
             logit.m_log_prob = std::log(logit.m_log_prob);
             out_tokens.push_back(logit);
         }
         else
-            out_tokens.emplace_back(std::log(logits.m_data[element_to_pick]), element_to_pick);
+            out_tokens.emplace_back(std::log(logits.m_data[element_to_pick]), logits.get_token_id(element_to_pick));
     }
     return out_tokens;
 }
@@ -572,9 +618,10 @@ std::vector<int64_t> Sampler::_try_finish_generation(SequenceGroup::Ptr & sequen
         }
 
         if (!sampling_params.stop_strings.empty()) {
-            auto& stop_strings = m_stop_strings.at(sequence_group->get_request_id());
-            auto match_result = match_stop_string(m_tokenizer, running_sequence->get_generated_ids(), stop_strings,
-                                                  sampling_params.include_stop_str_in_output, sequence_group->get_num_tokens_to_validate());
+            auto& stop_string_matcher = m_stop_string_matchers.at(sequence_group->get_request_id());
+            auto match_result = stop_string_matcher.match(running_sequence->get_id(), running_sequence->get_generated_ids(), m_tokenizer,
+                                                          m_token_text_cache, sampling_params.include_stop_str_in_output,
+                                                          sequence_group->get_num_tokens_to_validate());
             if (match_result.is_matched) {
                 running_sequence->remove_last_tokens(match_result.to_remove);
 
@@ -665,13 +712,64 @@ align_all_sequence_len(SequenceGroup::Ptr& sequence_group,
     logit_processor.update_generated_len(min_generated_tokens);
 }
 
+// Whether each running sequence of a group is sampled from its last logits row independently of other rows and sequences
+bool is_plain_sampling(const SequenceGroup::Ptr& sequence_group, const LogitProcessor& logit_processor, bool is_validation_mode_enabled) {
+    const ov::genai::GenerationConfig& sampling_params = sequence_group->get_sampling_parameters();
+    if (!sampling_params.is_greedy_decoding() && !sampling_params.is_multinomial())
+        return false;
+    // the first multinomial step forks num_return_sequences sequences
+    if (sampling_params.is_multinomial() && sequence_group->num_total_seqs() == 1 && sampling_params.num_return_sequences > 1)
+        return false;
+    // penalties depend on tokens sampled for other sequences of the group
+    if (sampling_params.repetition_penalty != 1.0f || sampling_params.presence_penalty != 0.0f || sampling_params.frequency_penalty != 0.0f)
+        return false;
+    return sampling_params.stop_strings.empty() && !logit_processor.get_structured_output() &&
+           !is_validation_mode_enabled && sequence_group->get_num_tokens_to_validate() == 0;
+}
+
+// Splits [0, size) into at most num_ranges contiguous ranges of approximately equal size
+std::vector<size_t> even_ranges(size_t size, size_t num_ranges) {
+    num_ranges = std::max<size_t>(std::min(num_ranges, size), 1);
+    std::vector<size_t> range_bounds;
+    for (size_t range_id = 0; range_id <= num_ranges; ++range_id)
+        range_bounds.push_back(size * range_id / num_ranges);
+    return range_bounds;
+}
+
+// Calls function for every range defined by bounds, the first range is processed by the calling thread
+template <typename Function>
+void run_in_ranges(ThreadPool& thread_pool, const std::vector<size_t>& range_bounds, Function& function) {
+    std::vector<std::future<void>> range_futures;
+    for (size_t range_id = 1; range_id + 1 < range_bounds.size(); ++range_id) {
+        range_futures.push_back(thread_pool.submit(function, range_bounds[range_id], range_bounds[range_id + 1]));
+    }
+    // all workers have to finish before state of the caller is destroyed, so the first exception is rethrown afterwards
+    std::exception_ptr exception = nullptr;
+    try {
+        function(range_bounds[0], range_bounds[1]);
+    } catch (...) {
+        exception = std::current_exception();
+    }
+    for (auto& range_future : range_futures) {
+        try {
+            range_future.get();
+        } catch (...) {
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
 bool Sampler::validate_candidate(
     Sequence::Ptr running_sequence,
     size_t& token_idx,
     Token& sampled_token,
     bool& is_extend_sequence,
     size_t& max_removed_tokens,
-    bool do_sample) {
+    bool do_sample,
+    PhiloxGenerator& rng) {
     OPENVINO_ASSERT(token_idx > 0);
     const auto& generated_tokens = running_sequence->get_generated_ids();
     auto it_token_id = generated_tokens.rbegin();
@@ -689,9 +787,7 @@ bool Sampler::validate_candidate(
                 q_i = std::exp(sampled_token.m_log_prob),
                 probability_ratio = p_i / q_i;
         
-        auto dist = std::uniform_int_distribution<>(0, 100); // equivalent to multinomial with number of trials == 1
-        float r_i = dist(rng_engine);
-        r_i /= 100;
+        float r_i = rng.uniform();
         is_candidate_accepted = r_i <= probability_ratio;
     } else {
         is_candidate_accepted = *it_token_id == sampled_token.m_index;
@@ -753,6 +849,7 @@ process_stop_strings(const std::set<std::string>& stop_strings, Tokenizer& token
 }
 
 SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr sequence_group, ov::Tensor sequence_group_logits, 
+                                                              ov::Tensor sequence_group_logits_token_ids,
                                                               LogitProcessor& logit_processor, const std::pair<size_t, std::set<std::string>>& stop_strings, 
                                                               bool is_validation_mode_enabled) {
     SequenceGroupSamplingInfo sg_sampling_info;
@@ -778,6 +875,10 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
         for (size_t running_sequence_id = 0; running_sequence_id < num_running_sequences; ++running_sequence_id) {
             auto& running_sequence = running_sequences[running_sequence_id];
             bool is_validation_passed = true;
+            // random stream is defined by position of the first token to be validated / generated
+            // and does not depend on other sequence groups in a batch
+            PhiloxGenerator rng(sampling_params.rng_seed, m_generation_id, sequence_group->get_request_id(), running_sequence->get_grouped_id(),
+                                sequence_group->get_prompt_len() + running_sequence->get_generated_len() - num_tokens_to_process);
             // make `num_tokens_to_process` iteration to validate a candidate generated by `draft_model` + 1 iteration to generate one more token by `main_model`
             for (size_t i = 0; i <= num_tokens_to_process; ++i) {
                 sg_sampling_info.sampler_output.num_generated_tokens++;
@@ -800,7 +901,10 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
                     continue;
                 }
 
-                auto logit_vector = _get_logit_vector(sequence_group_logits, running_sequence_id, token_offset);
+                auto logit_vector = _get_logit_vector(sequence_group_logits, running_sequence_id, token_offset, sequence_group_logits_token_ids);
+                if (const auto& structured_output = logit_processor.get_structured_output()) {
+                    structured_output->apply(logit_vector, running_sequence->get_id(), running_sequence->get_generated_ids(), generated_and_verified_len);
+                }
                 logit_processor.apply(logit_vector);
 
                 Token sampled_token;
@@ -812,7 +916,7 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
                     is_generate_n_tokens = sequence_group->num_total_seqs() == 1;
                     const size_t num_tokens_per_sequence = is_generate_n_tokens ? sampling_params.num_return_sequences : 1;
                     is_generate_n_tokens &= (num_tokens_per_sequence > 1);
-                    auto sampled_token_ids = _multinomial_sample(logit_vector, num_tokens_per_sequence);
+                    auto sampled_token_ids = _multinomial_sample(logit_vector, num_tokens_per_sequence, rng);
                     OPENVINO_ASSERT(sampled_token_ids.size(), num_tokens_per_sequence);
                     // to create n sequence just in case of `sequence_group->num_total_seqs() == 1` and `sampling_params.num_return_sequences > 1`
                     if (is_generate_n_tokens) {
@@ -836,7 +940,7 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
                 bool is_extend_sequence = token_offset == 0 || is_generate_n_tokens || !is_validation_passed;
                 if (is_validation_mode_enabled && !is_extend_sequence) {
                     is_validation_passed = validate_candidate(running_sequences[running_sequence_id], token_offset, sampled_token,
-                                                                is_extend_sequence, assisting_pipeline_info.max_removed_tokens_per_request, sampling_params.do_sample);
+                                                                is_extend_sequence, assisting_pipeline_info.max_removed_tokens_per_request, sampling_params.do_sample, rng);
                     // doing resample in case of non accepted tokens in specualtive sampling
                     if (!is_validation_passed && sampling_params.do_sample) {
                         continue;
@@ -859,7 +963,13 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
         for (const auto& dropped_seq_id : _try_finish_generation(sequence_group)) {
             sg_sampling_info.sampler_output.m_dropped_sequences.push_back(dropped_seq_id);
         }
+        // compute masks for the next step while model inference is running
+        if (const auto& structured_output = logit_processor.get_structured_output()) {
+            for (const auto& sequence : sequence_group->get_running_sequences())
+                structured_output->prefetch(sequence->get_id(), sequence->get_generated_ids(), m_thread_pool);
+        }
     } else if (sampling_params.is_beam_search()) {
+        OPENVINO_ASSERT(!sequence_group_logits_token_ids, "Beam search requires logits for the whole vocabulary");
         uint64_t request_id = sequence_group->get_request_id();
 
         // create beam search info if we are on the first generate
@@ -892,14 +1002,44 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
 
 SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_groups,
                               ov::Tensor logits,
-                              bool is_validation_mode_enabled) {
+                              bool is_validation_mode_enabled,
+                              ov::Tensor logits_token_ids) {
     const float * logits_data = logits.data<float>();
     ov::Shape logits_shape = logits.get_shape();
     OPENVINO_ASSERT(logits_shape.size() == 3);
     size_t vocab_size = logits_shape[2];
+    OPENVINO_ASSERT(!logits_token_ids || logits_token_ids.get_shape() == logits_shape, "Logits token ids must have the same shape as logits");
+
+    // sequence groups which require sampling together with their logits
+    struct SamplingTask {
+        SequenceGroup::Ptr sequence_group;
+        ov::Tensor logits, logits_token_ids;
+        LogitProcessor* logit_processor;
+        const std::pair<size_t, std::set<std::string>>* stop_strings;
+    };
+    std::vector<SamplingTask> sampling_tasks;
+    std::vector<size_t> sampling_task_ids(sequence_groups.size(), std::numeric_limits<size_t>::max());
+
+    // Plain greedy and multinomial requests (without penalties, stop strings, structured output or candidates validation)
+    // sample each running sequence from a single logits row independently of other rows. Such rows are collected from
+    // the whole batch and sampled in one strided pass over the logits matrix, sampled tokens are registered afterwards.
+    struct PlainSamplingGroup {
+        SequenceGroup::Ptr sequence_group;
+        LogitProcessor* logit_processor;
+        size_t first_row;
+    };
+    struct PlainSamplingRow {
+        size_t plain_group_id;
+        Sequence::Ptr sequence;
+        float* logits_data;
+        const int64_t* logits_token_ids_data;
+        Token sampled_token;
+        bool is_sampled = false;
+    };
+    std::vector<PlainSamplingGroup> plain_groups;
+    std::vector<PlainSamplingRow> plain_rows;
+    std::vector<size_t> plain_group_ids(sequence_groups.size(), std::numeric_limits<size_t>::max());
 
-    SamplerOutput sampler_output;
-    std::unordered_map<uint64_t, std::future<SequenceGroupSamplingInfo>> sg_sampling_future_map;
     for (size_t sequence_group_id = 0, currently_processed_tokens = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
         SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
         if (!sequence_group->is_scheduled())
@@ -917,15 +1057,37 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
             auto processed_stop_string = process_stop_strings(sampling_params.stop_strings, m_tokenizer);
             m_stop_strings.insert({request_id, processed_stop_string});
             sequence_group->set_stream_window_size(processed_stop_string.first);
+            if (!sampling_params.stop_strings.empty() && !sampling_params.is_beam_search()) {
+                m_stop_string_matchers.emplace(request_id, StopStringMatcher(sampling_params.stop_strings));
+            }
         }
         const auto& stop_strings = m_stop_strings.at(request_id);
         auto& logit_processor = m_logit_processors.at(request_id);
+        if (sampling_params.structured_output_config.has_value() && !logit_processor.get_structured_output()) {
+            OPENVINO_ASSERT(!logits_token_ids, "Structured output requires logits for the whole vocabulary");
+            logit_processor.set_structured_output(std::make_shared<StructuredOutputTransform>(
+                get_token_automaton(request_id, vocab_size), sampling_params.stop_token_ids));
+        }
         const void * sequence_group_logits_data = logits_data + vocab_size * currently_processed_tokens;
         ov::Tensor sequence_group_logits(ov::element::f32, ov::Shape{num_running_sequences, output_seq_len, vocab_size}, (void *)sequence_group_logits_data);
-        if (sequence_group->requires_sampling()) {
-            // Call sample_from_sequence_group asynchronously
-            sg_sampling_future_map[request_id] = m_thread_pool.submit(&Sampler::sample_from_sequence_group, this, sequence_group, sequence_group_logits,
-                                                                      logit_processor, stop_strings, is_validation_mode_enabled);
+        ov::Tensor sequence_group_logits_token_ids;
+        if (logits_token_ids) {
+            int64_t * sequence_group_token_ids_data = logits_token_ids.data<int64_t>() + vocab_size * currently_processed_tokens;
+            sequence_group_logits_token_ids = ov::Tensor(ov::element::i64, ov::Shape{num_running_sequences, output_seq_len, vocab_size}, sequence_group_token_ids_data);
+        }
+        if (sequence_group->requires_sampling() && is_plain_sampling(sequence_group, logit_processor, is_validation_mode_enabled)) {
+            plain_group_ids[sequence_group_id] = plain_groups.size();
+            plain_groups.push_back({sequence_group, &logit_processor, plain_rows.size()});
+            // the last logits row of every running sequence is sampled
+            std::vector<Sequence::Ptr> running_sequences = sequence_group->get_running_sequences();
+            for (size_t running_sequence_id = 0; running_sequence_id < num_running_sequences; ++running_sequence_id) {
+                const size_t row_offset = vocab_size * (currently_processed_tokens + (running_sequence_id + 1) * output_seq_len - 1);
+                plain_rows.push_back({plain_groups.size() - 1, running_sequences[running_sequence_id], logits.data<float>() + row_offset,
+                                      logits_token_ids ? logits_token_ids.data<const int64_t>() + row_offset : nullptr});
+            }
+        } else if (sequence_group->requires_sampling()) {
+            sampling_task_ids[sequence_group_id] = sampling_tasks.size();
+            sampling_tasks.push_back({sequence_group, sequence_group_logits, sequence_group_logits_token_ids, &logit_processor, &stop_strings});
         } else {
             // we are in prompt processing phase when prompt is split into chunks and processed step by step
         }
@@ -933,15 +1095,90 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
         currently_processed_tokens += output_seq_len * num_running_sequences;
     }
 
+    auto sample_plain_rows = [&](size_t begin, size_t end) {
+        for (size_t row_id = begin; row_id < end; ++row_id) {
+            auto& row = plain_rows[row_id];
+            const auto& plain_group = plain_groups[row.plain_group_id];
+            const auto& sequence_group = plain_group.sequence_group;
+            const ov::genai::GenerationConfig& sampling_params = sequence_group->get_sampling_parameters();
+            // sequences which reached max_new_tokens are finished without sampling
+            if (row.sequence->get_generated_len() >= sequence_group->get_max_new_tokens())
+                continue;
+
+            Logits logit_vector(row.logits_data, vocab_size, row.logits_token_ids_data);
+            plain_group.logit_processor->apply(logit_vector);
+            if (sampling_params.is_greedy_decoding()) {
+                row.sampled_token = _greedy_sample(logit_vector, sampling_params.logprobs);
+            } else {
+                PhiloxGenerator rng(sampling_params.rng_seed, m_generation_id, sequence_group->get_request_id(), row.sequence->get_grouped_id(),
+                                    sequence_group->get_prompt_len() + row.sequence->get_generated_len());
+                row.sampled_token = _multinomial_sample(logit_vector, 1, rng).front();
+            }
+            row.is_sampled = true;
+        }
+    };
+    run_in_ranges(m_thread_pool, even_ranges(plain_rows.size(), m_num_threads + 1), sample_plain_rows);
+
+    auto register_plain_sampled_tokens = [&](size_t plain_group_id) {
+        SequenceGroupSamplingInfo sg_sampling_info;
+        AssistingPipelineInfo& assisting_pipeline_info = sg_sampling_info.get_assisting_pipeline_info();
+        auto sequence_group = plain_groups[plain_group_id].sequence_group;
+        LogitProcessor& logit_processor = *plain_groups[plain_group_id].logit_processor;
+        const size_t end_row = plain_group_id + 1 < plain_groups.size() ? plain_groups[plain_group_id + 1].first_row : plain_rows.size();
+        for (size_t row_id = plain_groups[plain_group_id].first_row; row_id < end_row; ++row_id) {
+            const auto& row = plain_rows[row_id];
+            sg_sampling_info.sampler_output.num_generated_tokens++;
+            if (row.is_sampled)
+                register_new_token(row.sampled_token, row.sequence, logit_processor, true, false);
+            assisting_pipeline_info.min_generated_len = std::min(assisting_pipeline_info.min_generated_len, row.sequence->get_generated_len());
+        }
+        align_all_sequence_len(sequence_group, assisting_pipeline_info.min_generated_len, logit_processor);
+        for (const auto& dropped_seq_id : _try_finish_generation(sequence_group)) {
+            sg_sampling_info.sampler_output.m_dropped_sequences.push_back(dropped_seq_id);
+        }
+        sequence_group->notify_handle();
+        return sg_sampling_info;
+    };
+
+    // Sampling tasks are split into contiguous ranges with approximately equal number of logits rows.
+    // Each range is processed by a single worker, the first one is processed by the calling thread.
+    std::vector<SequenceGroupSamplingInfo> sampling_infos(sampling_tasks.size());
+    auto sample_range = [&](size_t begin, size_t end) {
+        for (size_t task_id = begin; task_id < end; ++task_id) {
+            auto& task = sampling_tasks[task_id];
+            sampling_infos[task_id] = sample_from_sequence_group(task.sequence_group, task.logits, task.logits_token_ids,
+                                                                 *task.logit_processor, *task.stop_strings, is_validation_mode_enabled);
+        }
+    };
+
+    size_t total_rows = 0;
+    for (const auto& task : sampling_tasks)
+        total_rows += task.logits.get_shape()[0] * task.logits.get_shape()[1];
+    const size_t num_ranges = std::min(m_num_threads + 1, sampling_tasks.size());
+    std::vector<size_t> range_bounds{0};
+    for (size_t task_id = 0, rows = 0; task_id < sampling_tasks.size() && range_bounds.size() < num_ranges; ++task_id) {
+        rows += sampling_tasks[task_id].logits.get_shape()[0] * sampling_tasks[task_id].logits.get_shape()[1];
+        if (rows * num_ranges >= total_rows * range_bounds.size())
+            range_bounds.push_back(task_id + 1);
+    }
+    range_bounds.push_back(sampling_tasks.size());
+    run_in_ranges(m_thread_pool, range_bounds, sample_range);
+
+    SamplerOutput sampler_output;
     // Update sequence groups internal states after sampling is done
-    for (auto& sequence_group : sequence_groups) {
+    for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
+        const auto& sequence_group = sequence_groups[sequence_group_id];
         if (!sequence_group->is_scheduled())
             continue;
         SequenceGroupSamplingInfo sg_sampling_info;
-        const auto request_id = sequence_group->get_request_id();
-        if (sg_sampling_future_map.find(request_id) != sg_sampling_future_map.end()) {
-            // If there is a future assigned to a sequence group we read it's result (blocking if results not available yet)
-            sg_sampling_info = sg_sampling_future_map[request_id].get();
+        const size_t sampling_task_id = sampling_task_ids[sequence_group_id];
+        const size_t plain_group_id = plain_group_ids[sequence_group_id];
+        if (sampling_task_id < sampling_infos.size() || plain_group_id < plain_groups.size()) {
+            if (plain_group_id < plain_groups.size()) {
+                sg_sampling_info = register_plain_sampled_tokens(plain_group_id);
+            } else {
+                sg_sampling_info = std::move(sampling_infos[sampling_task_id]);
+            }
             sampler_output.num_generated_tokens += sg_sampling_info.sampler_output.num_generated_tokens;
 
             // Merge sampler output from sequence group to the main one
@@ -983,6 +1220,63 @@ LogitProcessor& Sampler::get_logit_processor(uint64_t request_id) {
 }
 
 
+void Sampler::prepare_structured_output(uint64_t request_id, const GenerationConfig& sampling_params) {
+    if (!sampling_params.structured_output_config.has_value())
+        return;
+    const std::string regex = get_structured_output_regex(*sampling_params.structured_output_config);
+
+    std::shared_ptr<const ByteDFA> dfa;
+    {
+        std::lock_guard<std::mutex> lock(m_structured_output_mutex);
+        auto it = m_compiled_dfas.find(regex);
+        if (it != m_compiled_dfas.end())
+            dfa = it->second;
+    }
+    if (!dfa) {
+        // compiled without the lock, so that sampling of running requests is not blocked
+        dfa = std::make_shared<const ByteDFA>(regex);
+    }
+
+    // DFAs are kept by requests and automatons, so cache is simply dropped when it grows too large
+    constexpr size_t MAX_CACHED_DFAS = 32;
+    std::lock_guard<std::mutex> lock(m_structured_output_mutex);
+    if (m_compiled_dfas.size() >= MAX_CACHED_DFAS && !m_compiled_dfas.count(regex))
+        m_compiled_dfas.clear();
+    m_compiled_dfas.emplace(regex, dfa);
+    m_request_dfas[request_id] = std::move(dfa);
+}
+
+std::shared_ptr<TokenAutomaton> Sampler::get_token_automaton(uint64_t request_id, size_t vocab_size) {
+    std::shared_ptr<const ByteDFA> dfa;
+    {
+        std::lock_guard<std::mutex> lock(m_structured_output_mutex);
+        auto it = m_request_dfas.find(request_id);
+        OPENVINO_ASSERT(it != m_request_dfas.end(), "Internal error: structured output of request ", request_id, " is not prepared");
+        dfa = std::move(it->second);
+        m_request_dfas.erase(it);
+    }
+
+    if (!m_token_vocabulary || m_token_vocabulary->size() != vocab_size) {
+        std::vector<int64_t> token_ids(vocab_size);
+        std::iota(token_ids.begin(), token_ids.end(), 0);
+        std::vector<std::string> token_texts;
+        token_texts.reserve(vocab_size);
+        for (const std::string* token_text : m_token_text_cache.get_texts(m_tokenizer, token_ids))
+            token_texts.push_back(*token_text);
+        m_token_vocabulary = std::make_shared<const TokenVocabulary>(std::move(token_texts));
+        m_token_automatons.clear();
+    }
+
+    // automatons are kept by logit processors of running requests, so cache is simply dropped when it grows too large
+    constexpr size_t MAX_CACHED_TOKEN_AUTOMATONS = 32;
+    if (m_token_automatons.size() >= MAX_CACHED_TOKEN_AUTOMATONS && !m_token_automatons.count(dfa.get()))
+        m_token_automatons.clear();
+    auto& automaton = m_token_automatons[dfa.get()];
+    if (!automaton)
+        automaton = std::make_shared<TokenAutomaton>(m_token_vocabulary, dfa);
+    return automaton;
+}
+
 void Sampler::create_logit_processor(uint64_t request_id, const GenerationConfig& sampling_params, const TokenIds& prompt) {
     m_logit_processors.insert({request_id, LogitProcessor(sampling_params, prompt)});
 }
@@ -991,6 +1285,9 @@ void Sampler::clear_request_info(uint64_t request_id) {
     m_beam_search_info.erase(request_id);
     m_logit_processors.erase(request_id);
     m_stop_strings.erase(request_id);
+    m_stop_string_matchers.erase(request_id);
+    std::lock_guard<std::mutex> lock(m_structured_output_mutex);
+    m_request_dfas.erase(request_id);
 }
 
 int64_t Sampler::GroupBeamSearcher::Group::finish(Beam beam, const ov::genai::GenerationConfig& sampling_params) {
@@ -10,15 +10,20 @@
 #include <limits>
 #include <map>
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <random>
 #include <set>
+#include <unordered_map>
 
 #include "openvino/runtime/tensor.hpp"
 
 #include "logit_processor.hpp"
+#include "philox_generator.hpp"
 #include "scheduler.hpp"
 #include "sequence_group.hpp"
+#include "stop_string_matcher.hpp"
+#include "structured_output.hpp"
 #include "threadpool.hpp"
 
 namespace ov::genai {
@@ -33,6 +38,14 @@ inline bool is_stop_token_id_hit(int64_t generated_token, const std::set<int64_t
 
 std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx);
 
+/**
+ * Fused log softmax and selection of top_k most probable tokens, sorted by log probability in descending order.
+ * @param log_prob_offsets Sparse offsets added to log probabilities of particular tokens before selection,
+ * e.g. diversity penalty or -infinity for banned tokens
+ */
+std::vector<Token> log_softmax_top_k(const ov::Tensor& logits, size_t batch_idx, size_t top_k,
+                                     const std::unordered_map<int64_t, float>& log_prob_offsets = {});
+
 struct SamplerOutput {
     // IDs of sequences that need to be dropped
     std::vector<uint64_t> m_dropped_sequences;
@@ -61,15 +74,16 @@ struct SequenceGroupSamplingInfo {
 class Sampler {
     class GroupBeamSearcher;
 
-    Logits _get_logit_vector(ov::Tensor logits, size_t batch_idx, size_t token_idx);
+    Logits _get_logit_vector(ov::Tensor logits, size_t batch_idx, size_t token_idx, const ov::Tensor& logits_token_ids = {});
     Token _greedy_sample(const Logits& logits, size_t top_logprobs) const;
-    std::vector<Token> _multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence);
+    std::vector<Token> _multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence, PhiloxGenerator& rng);
     std::vector<int64_t> _try_finish_generation(SequenceGroup::Ptr & sequence_group);
 
     bool validate_candidate(Sequence::Ptr running_sequence, size_t& token_idx, Token& sampled_token,
-                            bool& is_extend_sequence, size_t& max_removed_tokens, bool do_sample);
+                            bool& is_extend_sequence, size_t& max_removed_tokens, bool do_sample, PhiloxGenerator& rng);
 
     SequenceGroupSamplingInfo sample_from_sequence_group(SequenceGroup::Ptr sequence_group, ov::Tensor sequence_group_logits,
+                                                        ov::Tensor sequence_group_logits_token_ids,
                                                         LogitProcessor& logit_processor, const std::pair<size_t, std::set<std::string>>& stop_strings,
                                                         bool is_validation_mode_enabled);
 
@@ -77,32 +91,68 @@ class Sampler {
     std::map<uint64_t, GroupBeamSearcher> m_beam_search_info;
     std::mutex m_beam_search_info_mutex;
 
-    std::mt19937 rng_engine;
-    size_t seed = rng_engine.default_seed;
     // { request_id, logit_processor }
     std::map<uint64_t, LogitProcessor> m_logit_processors;
     // { request_id, { max_encoded_len, { stop_strings }}}
     std::map<int64_t, std::pair<size_t, std::set<std::string>>> m_stop_strings;
+    // { request_id, incremental stop strings matcher }, beam search matches stop strings by match_stop_string
+    std::map<int64_t, StopStringMatcher> m_stop_string_matchers;
 
     Tokenizer m_tokenizer;
+    TokenTextCache m_token_text_cache;
+
+    // vocabulary and automatons shared by requests with structured output
+    std::shared_ptr<const TokenVocabulary> m_token_vocabulary;
+    std::map<const ByteDFA*, std::shared_ptr<TokenAutomaton>> m_token_automatons;
+
+    // DFAs compiled by prepare_structured_output(), which is called from threads adding requests
+    std::mutex m_structured_output_mutex;
+    std::map<std::string, std::shared_ptr<const ByteDFA>> m_compiled_dfas;
+    std::map<uint64_t, std::shared_ptr<const ByteDFA>> m_request_dfas;
+
+    std::shared_ptr<TokenAutomaton> get_token_automaton(uint64_t request_id, size_t vocab_size);
 
     ThreadPool m_thread_pool;
+    size_t m_num_threads = 1;
+
+    // number of generations started by the pipeline, request ids are reused by consecutive generations
+    std::atomic<uint64_t> m_generation_id{0};
 
 public:
     Sampler(const Sampler& rhs) = delete;
     Sampler(Sampler&& rhs) = delete;
-    Sampler(size_t num_threads = 1): m_thread_pool(num_threads) {};
-    explicit Sampler(const Tokenizer & tokenizer, size_t num_threads = 1) : m_tokenizer(tokenizer), m_thread_pool(num_threads) {};
-
-    SamplerOutput sample(const std::vector<SequenceGroup::Ptr> & sequence_groups, ov::Tensor logits, bool is_validation_mode_enabled = false);
-    void set_seed(size_t new_seed) {
-        rng_engine.seed(new_seed);
-        seed = new_seed;
-    }
-    size_t get_seed() { return seed; }
-
+    Sampler(size_t num_threads = 1): m_thread_pool(num_threads), m_num_threads(num_threads) {};
+    explicit Sampler(const Tokenizer & tokenizer, size_t num_threads = 1) : m_tokenizer(tokenizer), m_thread_pool(num_threads), m_num_threads(num_threads) {};
+
+    /**
+     * Samples next tokens for scheduled sequence groups.
+     * @param logits Logits of shape [num_tokens, 1, N], where N is vocabulary size or number of candidate tokens
+     * @param is_validation_mode_enabled Whether candidates generated by a draft model are validated
+     * @param logits_token_ids Token ids of logits elements of shape [num_tokens, 1, N], if logits are computed only for
+     * candidate tokens (e.g. by model-side TopK). Only greedy and top-k multinomial sampling without penalties are supported in this case.
+     */
+    SamplerOutput sample(const std::vector<SequenceGroup::Ptr> & sequence_groups, ov::Tensor logits, bool is_validation_mode_enabled = false,
+                         ov::Tensor logits_token_ids = {});
     void set_tokenizer(const Tokenizer& tokenizer) {
         m_tokenizer = tokenizer;
+        m_token_text_cache.reset();
+        m_token_vocabulary.reset();
+        m_token_automatons.clear();
+    }
+
+    /**
+     * Converts structured output description of a request to regular expression and compiles it, so that invalid
+     * descriptions are rejected and DFA construction is not done during sampling. Must be called before the request
+     * is sampled, does nothing for requests without structured output. Thread safe.
+     */
+    void prepare_structured_output(uint64_t request_id, const GenerationConfig& sampling_params);
+
+    /**
+     * Switches random streams of subsequently sampled requests to new ones. Called by pipelines when a new
+     * generation starts, so that consecutive generate() calls with the same rng_seed produce different samples.
+     */
+    void start_generation() {
+        ++m_generation_id;
     }
 
     void clear_request_info(uint64_t request_id);
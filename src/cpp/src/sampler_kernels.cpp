@@ -0,0 +1,453 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sampler_kernels.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "openvino/runtime/system_conf.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#    define SAMPLER_KERNELS_X86
+#    include <immintrin.h>
+#    ifdef _MSC_VER
+#        include <intrin.h>
+#    endif
+#    if defined(__GNUC__) || defined(__clang__)
+#        define TARGET_AVX2 __attribute__((target("avx2,fma")))
+#        define TARGET_AVX512 __attribute__((target("avx512f")))
+#    else
+#        define TARGET_AVX2
+#        define TARGET_AVX512
+#    endif
+#endif
+
+namespace {
+
+enum class Isa { SCALAR, AVX2, AVX512 };
+
+Isa get_isa() {
+    static const Isa isa = [] {
+#ifdef SAMPLER_KERNELS_X86
+        if (ov::with_cpu_x86_avx512f())
+            return Isa::AVX512;
+        if (ov::with_cpu_x86_avx2())
+            return Isa::AVX2;
+#endif
+        return Isa::SCALAR;
+    }();
+    return isa;
+}
+
+// Scalar kernels, also used to process tails of vectorized kernels
+
+float reduce_max_scalar(const float* data, size_t size, float max_value = -std::numeric_limits<float>::infinity()) {
+    for (size_t i = 0; i < size; ++i) {
+        if (data[i] > max_value)
+            max_value = data[i];
+    }
+    return max_value;
+}
+
+size_t find_first_scalar(const float* data, size_t begin, size_t size, float value) {
+    for (size_t i = begin; i < size; ++i) {
+        if (data[i] == value)
+            return i;
+    }
+    return 0;
+}
+
+void top_m_scalar(const float* data, size_t begin, size_t size, size_t m, float* top_values, size_t* top_indices) {
+    for (size_t i = begin; i < size; ++i) {
+        if (data[i] > top_values[m - 1]) {
+            top_values[m - 1] = data[i];
+            top_indices[m - 1] = i;
+
+            for (size_t j = m - 1; j > 0 && top_values[j] > top_values[j - 1]; --j) {
+                std::swap(top_values[j], top_values[j - 1]);
+                std::swap(top_indices[j], top_indices[j - 1]);
+            }
+        }
+    }
+}
+
+float exp_sum_scalar(const float* data, size_t size, float shift) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < size; ++i)
+        sum += std::exp(data[i] - shift);
+    return sum;
+}
+
+float exp_inplace_scalar(float* data, size_t size, float shift, float scale) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = std::exp((data[i] - shift) * scale);
+        sum += data[i];
+    }
+    return sum;
+}
+
+void mask_inplace_scalar(float* data, size_t begin, size_t size, const uint32_t* bitmask, float value) {
+    for (size_t i = begin; i < size; ++i) {
+        if (!((bitmask[i / 32] >> (i % 32)) & 1u))
+            data[i] = value;
+    }
+}
+
+void scale_inplace_scalar(float* data, size_t size, float scale) {
+    for (size_t i = 0; i < size; ++i)
+        data[i] *= scale;
+}
+
+#ifdef SAMPLER_KERNELS_X86
+
+// exp approximation from Cephes library, relative error is within 2 ulp on [-87.3, 88.3];
+// inputs below ln(FLT_MIN) are flushed to 0, so that exp(-inf) == 0
+constexpr float exp_hi = 88.3762626647949f, exp_lo = -87.3365447504f;
+constexpr float exp_log2e = 1.44269504088896341f, exp_c1 = 0.693359375f, exp_c2 = -2.12194440e-4f;
+constexpr float exp_p0 = 1.9875691500E-4f, exp_p1 = 1.3981999507E-3f, exp_p2 = 8.3334519073E-3f,
+                exp_p3 = 4.1665795894E-2f, exp_p4 = 1.6666665459E-1f, exp_p5 = 5.0000001201E-1f;
+
+inline size_t count_trailing_zeros(uint32_t mask) {
+#ifdef _MSC_VER
+    unsigned long index = 0;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+// AVX2 kernels
+
+TARGET_AVX2 inline __m256 exp_avx2(__m256 x) {
+    const __m256 is_not_underflow = _mm256_cmp_ps(x, _mm256_set1_ps(exp_lo), _CMP_GE_OQ);
+    x = _mm256_min_ps(x, _mm256_set1_ps(exp_hi));
+    x = _mm256_max_ps(x, _mm256_set1_ps(exp_lo));
+
+    __m256 fx = _mm256_floor_ps(_mm256_fmadd_ps(x, _mm256_set1_ps(exp_log2e), _mm256_set1_ps(0.5f)));
+    x = _mm256_fnmadd_ps(fx, _mm256_set1_ps(exp_c1), x);
+    x = _mm256_fnmadd_ps(fx, _mm256_set1_ps(exp_c2), x);
+
+    const __m256 z = _mm256_mul_ps(x, x);
+    __m256 y = _mm256_set1_ps(exp_p0);
+    y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(exp_p1));
+    y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(exp_p2));
+    y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(exp_p3));
+    y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(exp_p4));
+    y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(exp_p5));
+    y = _mm256_fmadd_ps(y, z, _mm256_add_ps(x, _mm256_set1_ps(1.0f)));
+
+    const __m256i pow2n = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvttps_epi32(fx), _mm256_set1_epi32(127)), 23);
+    y = _mm256_mul_ps(y, _mm256_castsi256_ps(pow2n));
+    return _mm256_and_ps(y, is_not_underflow);
+}
+
+TARGET_AVX2 inline float hmax_avx2(__m256 v) {
+    __m128 m = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 0x55));
+    return _mm_cvtss_f32(m);
+}
+
+TARGET_AVX2 inline float hsum_avx2(__m256 v) {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x55));
+    return _mm_cvtss_f32(s);
+}
+
+TARGET_AVX2 float reduce_max_avx2(const float* data, size_t size) {
+    __m256 max0 = _mm256_set1_ps(-std::numeric_limits<float>::infinity()), max1 = max0;
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        max0 = _mm256_max_ps(max0, _mm256_loadu_ps(data + i));
+        max1 = _mm256_max_ps(max1, _mm256_loadu_ps(data + i + 8));
+    }
+    for (; i + 8 <= size; i += 8)
+        max0 = _mm256_max_ps(max0, _mm256_loadu_ps(data + i));
+    return reduce_max_scalar(data + i, size - i, hmax_avx2(_mm256_max_ps(max0, max1)));
+}
+
+TARGET_AVX2 size_t find_first_avx2(const float* data, size_t size, float value) {
+    const __m256 v_value = _mm256_set1_ps(value);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(data + i), v_value, _CMP_EQ_OQ));
+        if (mask)
+            return i + count_trailing_zeros(static_cast<uint32_t>(mask));
+    }
+    return find_first_scalar(data, i, size, value);
+}
+
+TARGET_AVX2 void top_m_avx2(const float* data, size_t size, size_t m, float* top_values, size_t* top_indices) {
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        // most of the blocks do not contain values exceeding the current threshold and are skipped
+        const __m256 threshold = _mm256_set1_ps(top_values[m - 1]);
+        if (_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(data + i), threshold, _CMP_GT_OQ)))
+            top_m_scalar(data, i, i + 8, m, top_values, top_indices);
+    }
+    top_m_scalar(data, i, size, m, top_values, top_indices);
+}
+
+TARGET_AVX2 float exp_sum_avx2(const float* data, size_t size, float shift) {
+    const __m256 v_shift = _mm256_set1_ps(shift);
+    __m256 sum = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+        sum = _mm256_add_ps(sum, exp_avx2(_mm256_sub_ps(_mm256_loadu_ps(data + i), v_shift)));
+    return hsum_avx2(sum) + exp_sum_scalar(data + i, size - i, shift);
+}
+
+TARGET_AVX2 float exp_inplace_avx2(float* data, size_t size, float shift, float scale) {
+    const __m256 v_shift = _mm256_set1_ps(shift), v_scale = _mm256_set1_ps(scale);
+    __m256 sum = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256 v = exp_avx2(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(data + i), v_shift), v_scale));
+        _mm256_storeu_ps(data + i, v);
+        sum = _mm256_add_ps(sum, v);
+    }
+    return hsum_avx2(sum) + exp_inplace_scalar(data + i, size - i, shift, scale);
+}
+
+TARGET_AVX2 void scale_inplace_avx2(float* data, size_t size, float scale) {
+    const __m256 v_scale = _mm256_set1_ps(scale);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm256_storeu_ps(data + i, _mm256_mul_ps(_mm256_loadu_ps(data + i), v_scale));
+    scale_inplace_scalar(data + i, size - i, scale);
+}
+
+TARGET_AVX2 void mask_inplace_avx2(float* data, size_t size, const uint32_t* bitmask, float value) {
+    const __m256 v_value = _mm256_set1_ps(value);
+    const __m256i bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        const uint32_t word = bitmask[i / 32];
+        // most of the words are either fully masked or fully allowed
+        if (word == 0xFFFFFFFFu)
+            continue;
+        for (size_t j = 0; j < 32; j += 8) {
+            const __m256i is_set = _mm256_and_si256(_mm256_set1_epi32(static_cast<int>(word >> j)), bits);
+            const __m256 is_masked = _mm256_castsi256_ps(_mm256_cmpeq_epi32(is_set, _mm256_setzero_si256()));
+            _mm256_storeu_ps(data + i + j, _mm256_blendv_ps(_mm256_loadu_ps(data + i + j), v_value, is_masked));
+        }
+    }
+    mask_inplace_scalar(data, i, size, bitmask, value);
+}
+
+// AVX-512 kernels
+
+TARGET_AVX512 inline __m512 exp_avx512(__m512 x) {
+    const __mmask16 is_not_underflow = _mm512_cmp_ps_mask(x, _mm512_set1_ps(exp_lo), _CMP_GE_OQ);
+    x = _mm512_min_ps(x, _mm512_set1_ps(exp_hi));
+    x = _mm512_max_ps(x, _mm512_set1_ps(exp_lo));
+
+    __m512 fx = _mm512_roundscale_ps(_mm512_fmadd_ps(x, _mm512_set1_ps(exp_log2e), _mm512_set1_ps(0.5f)),
+                                     _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    x = _mm512_fnmadd_ps(fx, _mm512_set1_ps(exp_c1), x);
+    x = _mm512_fnmadd_ps(fx, _mm512_set1_ps(exp_c2), x);
+
+    const __m512 z = _mm512_mul_ps(x, x);
+    __m512 y = _mm512_set1_ps(exp_p0);
+    y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(exp_p1));
+    y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(exp_p2));
+    y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(exp_p3));
+    y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(exp_p4));
+    y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(exp_p5));
+    y = _mm512_fmadd_ps(y, z, _mm512_add_ps(x, _mm512_set1_ps(1.0f)));
+
+    const __m512i pow2n = _mm512_slli_epi32(_mm512_add_epi32(_mm512_cvttps_epi32(fx), _mm512_set1_epi32(127)), 23);
+    y = _mm512_mul_ps(y, _mm512_castsi512_ps(pow2n));
+    return _mm512_maskz_mov_ps(is_not_underflow, y);
+}
+
+TARGET_AVX512 float reduce_max_avx512(const float* data, size_t size) {
+    __m512 max0 = _mm512_set1_ps(-std::numeric_limits<float>::infinity()), max1 = max0;
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        max0 = _mm512_max_ps(max0, _mm512_loadu_ps(data + i));
+        max1 = _mm512_max_ps(max1, _mm512_loadu_ps(data + i + 16));
+    }
+    for (; i + 16 <= size; i += 16)
+        max0 = _mm512_max_ps(max0, _mm512_loadu_ps(data + i));
+    return reduce_max_scalar(data + i, size - i, _mm512_reduce_max_ps(_mm512_max_ps(max0, max1)));
+}
+
+TARGET_AVX512 size_t find_first_avx512(const float* data, size_t size, float value) {
+    const __m512 v_value = _mm512_set1_ps(value);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __mmask16 mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(data + i), v_value, _CMP_EQ_OQ);
+        if (mask)
+            return i + count_trailing_zeros(static_cast<uint32_t>(mask));
+    }
+    return find_first_scalar(data, i, size, value);
+}
+
+TARGET_AVX512 void top_m_avx512(const float* data, size_t size, size_t m, float* top_values, size_t* top_indices) {
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        // most of the blocks do not contain values exceeding the current threshold and are skipped
+        const __m512 threshold = _mm512_set1_ps(top_values[m - 1]);
+        if (_mm512_cmp_ps_mask(_mm512_loadu_ps(data + i), threshold, _CMP_GT_OQ))
+            top_m_scalar(data, i, i + 16, m, top_values, top_indices);
+    }
+    top_m_scalar(data, i, size, m, top_values, top_indices);
+}
+
+TARGET_AVX512 float exp_sum_avx512(const float* data, size_t size, float shift) {
+    const __m512 v_shift = _mm512_set1_ps(shift);
+    __m512 sum = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+        sum = _mm512_add_ps(sum, exp_avx512(_mm512_sub_ps(_mm512_loadu_ps(data + i), v_shift)));
+    return _mm512_reduce_add_ps(sum) + exp_sum_scalar(data + i, size - i, shift);
+}
+
+TARGET_AVX512 float exp_inplace_avx512(float* data, size_t size, float shift, float scale) {
+    const __m512 v_shift = _mm512_set1_ps(shift), v_scale = _mm512_set1_ps(scale);
+    __m512 sum = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m512 v = exp_avx512(_mm512_mul_ps(_mm512_sub_ps(_mm512_loadu_ps(data + i), v_shift), v_scale));
+        _mm512_storeu_ps(data + i, v);
+        sum = _mm512_add_ps(sum, v);
+    }
+    return _mm512_reduce_add_ps(sum) + exp_inplace_scalar(data + i, size - i, shift, scale);
+}
+
+TARGET_AVX512 void scale_inplace_avx512(float* data, size_t size, float scale) {
+    const __m512 v_scale = _mm512_set1_ps(scale);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+        _mm512_storeu_ps(data + i, _mm512_mul_ps(_mm512_loadu_ps(data + i), v_scale));
+    scale_inplace_scalar(data + i, size - i, scale);
+}
+
+TARGET_AVX512 void mask_inplace_avx512(float* data, size_t size, const uint32_t* bitmask, float value) {
+    const __m512 v_value = _mm512_set1_ps(value);
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        const uint32_t word = bitmask[i / 32];
+        if (word == 0xFFFFFFFFu)
+            continue;
+        _mm512_mask_storeu_ps(data + i, static_cast<__mmask16>(~word), v_value);
+        _mm512_mask_storeu_ps(data + i + 16, static_cast<__mmask16>(~word >> 16), v_value);
+    }
+    mask_inplace_scalar(data, i, size, bitmask, value);
+}
+
+#endif  // SAMPLER_KERNELS_X86
+
+}  // namespace
+
+namespace ov::genai::kernels {
+
+float reduce_max(const float* data, size_t size) {
+    switch (get_isa()) {
+#ifdef SAMPLER_KERNELS_X86
+    case Isa::AVX512:
+        return reduce_max_avx512(data, size);
+    case Isa::AVX2:
+        return reduce_max_avx2(data, size);
+#endif
+    default:
+        return reduce_max_scalar(data, size);
+    }
+}
+
+size_t argmax(const float* data, size_t size) {
+    const float max_value = reduce_max(data, size);
+    switch (get_isa()) {
+#ifdef SAMPLER_KERNELS_X86
+    case Isa::AVX512:
+        return find_first_avx512(data, size, max_value);
+    case Isa::AVX2:
+        return find_first_avx2(data, size, max_value);
+#endif
+    default:
+        return find_first_scalar(data, 0, size, max_value);
+    }
+}
+
+void top_m(const float* data, size_t size, size_t m, float* top_values, size_t* top_indices) {
+    if (m == 0)
+        return;
+    switch (get_isa()) {
+#ifdef SAMPLER_KERNELS_X86
+    case Isa::AVX512:
+        return top_m_avx512(data, size, m, top_values, top_indices);
+    case Isa::AVX2:
+        return top_m_avx2(data, size, m, top_values, top_indices);
+#endif
+    default:
+        return top_m_scalar(data, 0, size, m, top_values, top_indices);
+    }
+}
+
+float exp_sum(const float* data, size_t size, float shift) {
+    switch (get_isa()) {
+#ifdef SAMPLER_KERNELS_X86
+    case Isa::AVX512:
+        return exp_sum_avx512(data, size, shift);
+    case Isa::AVX2:
+        return exp_sum_avx2(data, size, shift);
+#endif
+    default:
+        return exp_sum_scalar(data, size, shift);
+    }
+}
+
+float exp_inplace(float* data, size_t size, float shift, float scale) {
+    switch (get_isa()) {
+#ifdef SAMPLER_KERNELS_X86
+    case Isa::AVX512:
+        return exp_inplace_avx512(data, size, shift, scale);
+    case Isa::AVX2:
+        return exp_inplace_avx2(data, size, shift, scale);
+#endif
+    default:
+        return exp_inplace_scalar(data, size, shift, scale);
+    }
+}
+
+void scale_inplace(float* data, size_t size, float scale) {
+    switch (get_isa()) {
+#ifdef SAMPLER_KERNELS_X86
+    case Isa::AVX512:
+        return scale_inplace_avx512(data, size, scale);
+    case Isa::AVX2:
+        return scale_inplace_avx2(data, size, scale);
+#endif
+    default:
+        return scale_inplace_scalar(data, size, scale);
+    }
+}
+
+void mask_inplace(float* data, size_t size, const uint32_t* bitmask, float value) {
+    switch (get_isa()) {
+#ifdef SAMPLER_KERNELS_X86
+    case Isa::AVX512:
+        return mask_inplace_avx512(data, size, bitmask, value);
+    case Isa::AVX2:
+        return mask_inplace_avx2(data, size, bitmask, value);
+#endif
+    default:
+        return mask_inplace_scalar(data, 0, size, bitmask, value);
+    }
+}
+
+float log_sum_exp(const float* data, size_t size, float* max_value) {
+    const float max_logit = reduce_max(data, size);
+    if (max_value)
+        *max_value = max_logit;
+    return max_logit + std::log(exp_sum(data, size, max_logit));
+}
+
+}  // namespace ov::genai::kernels
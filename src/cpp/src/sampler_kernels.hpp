@@ -0,0 +1,62 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov::genai::kernels {
+
+/**
+ * Vectorized reductions over logits used by the sampler.
+ * Implementations for AVX-512 and AVX2 are selected at runtime depending on CPU capabilities,
+ * other platforms use scalar fallback.
+ */
+
+/**
+ * @return Maximum value of data, -infinity if size is 0
+ */
+float reduce_max(const float* data, size_t size);
+
+/**
+ * @return Index of the first occurrence of the maximum value of data, 0 if size is 0
+ */
+size_t argmax(const float* data, size_t size);
+
+/**
+ * Finds m largest values of data in descending order, ties are resolved in favour of smaller indices.
+ * @param top_values Output buffer of size m, must be filled with -infinity or current top values by the caller
+ * @param top_indices Output buffer of size m
+ */
+void top_m(const float* data, size_t size, size_t m, float* top_values, size_t* top_indices);
+
+/**
+ * @return sum(exp(data[i] - shift))
+ */
+float exp_sum(const float* data, size_t size, float shift);
+
+/**
+ * Replaces data[i] with exp((data[i] - shift) * scale).
+ * @return Sum of the computed values
+ */
+float exp_inplace(float* data, size_t size, float shift, float scale);
+
+/**
+ * Multiplies data by scale in place.
+ */
+void scale_inplace(float* data, size_t size, float scale);
+
+/**
+ * Fused max and exp-sum: computes log(sum(exp(data[i]))) in a numerically stable way.
+ * @param max_value If not nullptr, receives maximum value of data
+ */
+float log_sum_exp(const float* data, size_t size, float* max_value = nullptr);
+
+/**
+ * Replaces data[i] with value for every i whose bit is not set in bitmask.
+ * @param bitmask Bit i % 32 of bitmask[i / 32] corresponds to data[i]
+ */
+void mask_inplace(float* data, size_t size, const uint32_t* bitmask, float value);
+
+}  // namespace ov::genai::kernels
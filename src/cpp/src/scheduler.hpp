@@ -9,6 +9,7 @@
 
 #include "openvino/runtime/intel_gpu/properties.hpp"
 #include "openvino/genai/scheduler_config.hpp"
+#include "openvino/genai/kv_cache_snapshot.hpp"
 #include "block_manager.hpp"
 #include "sequence_group.hpp"
 #include "cache_manager.hpp"
@@ -144,6 +145,78 @@ public:
         m_block_manager->free_blocks_from_sequence(seq_id, per_layer_logical_block_indices_to_free);
     }
 
+    /**
+     * Copies KV cache blocks holding the first `num_tokens` tokens of a sequence to host memory.
+     * @param seq_id Identifier of a sequence with an allocated block table.
+     * @param num_tokens Number of tokens whose KV cache should be exported.
+     * @return Snapshot with per-layer host copies of the blocks; token ids are left to be filled by the caller.
+     */
+    KVCacheSnapshot export_kv_cache(uint64_t seq_id, size_t num_tokens) {
+        const size_t block_size = get_block_size();
+        const size_t num_blocks = (num_tokens + block_size - 1) / block_size;
+        const auto& block_tables = m_block_manager->get_block_tables(seq_id);
+
+        KVCacheSnapshot snapshot;
+        snapshot.block_size = block_size;
+        for (size_t layer_idx = 0; layer_idx < block_tables.size(); ++layer_idx) {
+            OPENVINO_ASSERT(block_tables[layer_idx].size() >= num_blocks, "Sequence ", seq_id, " does not hold KV cache for ", num_tokens, " tokens");
+            std::vector<size_t> block_ids;
+            block_ids.reserve(num_blocks);
+            for (size_t i = 0; i < num_blocks; ++i) {
+                block_ids.push_back(block_tables[layer_idx][i]->get_index());
+            }
+            auto [key_blocks, value_blocks] = m_cache_manager->export_blocks(layer_idx, block_ids);
+            snapshot.key_cache.push_back(key_blocks);
+            snapshot.value_cache.push_back(value_blocks);
+        }
+
+        return snapshot;
+    }
+
+    /**
+     * Allocates fresh KV cache blocks for the first `num_tokens` prompt tokens of a newly added sequence group
+     * and fills them with the content of the snapshot, so these tokens do not need to be recomputed.
+     * @param sequence_group A sequence group which has not been scheduled yet and has no blocks assigned.
+     * @param snapshot Snapshot holding at least `num_tokens` tokens.
+     * @param num_tokens Number of prompt tokens to take from the snapshot.
+     * @return Whether the blocks were imported. If the cache cannot fit the blocks, nothing is allocated and
+     * the prompt is processed as usual.
+     */
+    bool import_kv_cache(const SequenceGroup::Ptr& sequence_group, const KVCacheSnapshot& snapshot, size_t num_tokens) {
+        auto sequences = sequence_group->get_not_finished_sequences();
+        OPENVINO_ASSERT(sequences.size() == 1);
+        const auto& sequence = sequences[0];
+        OPENVINO_ASSERT(!m_block_manager->has_block_table(sequence->get_id()), "KV cache blocks are already assigned to sequence ", sequence->get_id());
+
+        const size_t block_size = get_block_size();
+        const size_t num_blocks = (num_tokens + block_size - 1) / block_size;
+        OPENVINO_ASSERT(num_blocks > 0);
+
+        if (m_block_manager->get_total_number_of_kv_blocks() == 0) {
+            _initialize_cache({sequence_group});
+        }
+        while (!m_block_manager->can_allocate_blocks(num_blocks)) {
+            if (!_try_increase_cache()) {
+                return false;
+            }
+        }
+
+        m_block_manager->allocate(sequence, num_blocks, sequence_group->get_prompt_ids());
+        m_cache_manager->allocate_cache_if_needed(m_block_manager->get_total_number_of_kv_blocks());
+
+        const auto& block_tables = m_block_manager->get_block_tables(sequence->get_id());
+        for (size_t layer_idx = 0; layer_idx < block_tables.size(); ++layer_idx) {
+            std::vector<size_t> block_ids;
+            block_ids.reserve(num_blocks);
+            for (const auto& block : block_tables[layer_idx]) {
+                block_ids.push_back(block->get_index());
+            }
+            m_cache_manager->import_blocks(layer_idx, block_ids, snapshot.key_cache[layer_idx], snapshot.value_cache[layer_idx]);
+        }
+
+        return true;
+    }
+
 private:
     static size_t _num_running_sequence_groups(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
         size_t num_running = 0;
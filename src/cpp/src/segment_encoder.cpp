@@ -0,0 +1,66 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "segment_encoder.hpp"
+
+#include <algorithm>
+
+namespace {
+
+// Length of texts around a segment boundary which are tokenized to check that the boundary is not crossed by tokens
+constexpr size_t SEGMENT_BOUNDARY_CONTEXT_LENGTH = 64;
+
+bool is_utf8_continuation_byte(char c) {
+    return (static_cast<uint8_t>(c) & 0xC0) == 0x80;
+}
+
+// Checks on short texts around the boundary that tokenizing segments separately gives the same tokens as
+// tokenizing their concatenation
+bool is_segment_boundary_stable(const std::string& left, const std::string& right, const ov::genai::EncodeIdsFunction& encode_ids) {
+    size_t left_begin = left.size() - std::min(left.size(), SEGMENT_BOUNDARY_CONTEXT_LENGTH);
+    while (left_begin < left.size() && is_utf8_continuation_byte(left[left_begin]))
+        ++left_begin;
+    size_t right_end = std::min(right.size(), SEGMENT_BOUNDARY_CONTEXT_LENGTH);
+    while (right_end < right.size() && right_end > 0 && is_utf8_continuation_byte(right[right_end]))
+        --right_end;
+    const std::string left_context = left.substr(left_begin), right_context = right.substr(0, right_end);
+    if (left_context.empty() || right_context.empty())
+        return true;
+
+    std::vector<int64_t> separate_ids = encode_ids(left_context, false), right_ids = encode_ids(right_context, false);
+    separate_ids.insert(separate_ids.end(), right_ids.begin(), right_ids.end());
+    return encode_ids(left_context + right_context, false) == separate_ids;
+}
+
+}  // namespace
+
+namespace ov::genai {
+
+std::optional<std::vector<int64_t>> encode_segments(const std::vector<std::string>& segments, bool add_special_tokens,
+                                                    const EncodeIdsFunction& encode_ids) {
+    std::vector<int64_t> input_ids, first_segment_ids;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        if (i > 0 && !is_segment_boundary_stable(segments[i - 1], segments[i], encode_ids))
+            return std::nullopt;
+        std::vector<int64_t> ids = encode_ids(segments[i], false);
+        if (i == 0)
+            first_segment_ids = ids;
+        input_ids.insert(input_ids.end(), ids.begin(), ids.end());
+    }
+    if (!add_special_tokens)
+        return input_ids;
+
+    // special tokens surround tokens of the text, position of the text is ambiguous for an empty segment
+    if (first_segment_ids.empty())
+        return std::nullopt;
+    const std::vector<int64_t> special_ids = encode_ids(segments.front(), true);
+    auto text_begin = std::search(special_ids.begin(), special_ids.end(), first_segment_ids.begin(), first_segment_ids.end());
+    if (text_begin == special_ids.end())
+        return std::nullopt;
+    auto text_end = text_begin + first_segment_ids.size();
+    input_ids.insert(input_ids.begin(), special_ids.begin(), text_begin);
+    input_ids.insert(input_ids.end(), text_end, special_ids.end());
+    return input_ids;
+}
+
+}  // namespace ov::genai
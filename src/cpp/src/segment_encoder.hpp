@@ -0,0 +1,27 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ov::genai {
+
+using EncodeIdsFunction = std::function<std::vector<int64_t>(const std::string& text, bool add_special_tokens)>;
+
+/**
+ * Tokenizes a prompt split into segments, so that tokens of repeated segments can be taken from tokenization cache.
+ * Segments are tokenized without special tokens. Special tokens which the tokenizer adds to a text (e.g. BOS prefix,
+ * EOS or [SEP] suffix) are taken from tokens of the first segment and added once around the whole sequence.
+ * @param encode_ids tokenizes text with or without special tokens
+ * @return Token ids of the concatenated segments, std::nullopt if segments can't be tokenized separately: tokens are
+ * merged across a boundary, the tokenizer adds a prefix to separately tokenized text (e.g. SentencePiece dummy prefix)
+ * or special tokens of the first segment can't be separated from its text.
+ */
+std::optional<std::vector<int64_t>> encode_segments(const std::vector<std::string>& segments, bool add_special_tokens,
+                                                    const EncodeIdsFunction& encode_ids);
+
+}  // namespace ov::genai
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 #include <cassert>
 #include <set>
@@ -130,27 +131,30 @@ public:
 
     GenerationOutput get_last_generation_output(size_t token_cnt = 1, size_t num_token_to_ignore = 0) {
         GenerationOutput output;
+        fill_last_generation_output(output, token_cnt, num_token_to_ignore);
+        return output;
+    }
+
+    // Overwrites output with the last generated tokens, allocated vectors of output are reused
+    void fill_last_generation_output(GenerationOutput& output, size_t token_cnt = 1, size_t num_token_to_ignore = 0) const {
+        output.generated_ids.clear();
+        output.generated_log_probs.clear();
+        output.score = 0.0f;
+        output.finish_reason = GenerationFinishReason::NONE;
         if (token_cnt > 0) {
             OPENVINO_ASSERT(m_generated_ids.size());
             output.score = get_cumulative_log_prob();
 
-            auto generated_token_id = get_generated_ids();
-            auto generated_log_probs = get_generated_log_probs();
-
             OPENVINO_ASSERT(get_generated_len() >= token_cnt);
             if (get_generated_len() > num_token_to_ignore) {
                 auto offset = get_generated_len() - token_cnt - num_token_to_ignore;
                 auto offset_back = get_generated_len() - num_token_to_ignore;
 
-                std::vector<int64_t> token_id(generated_token_id.begin() + offset, generated_token_id.begin() + offset_back);
-                std::vector<float> log_probs(generated_log_probs.begin() + offset, generated_log_probs.begin() + offset_back);
-
-                output.generated_ids = token_id;
-                output.generated_log_probs = log_probs;
+                output.generated_ids.assign(m_generated_ids.begin() + offset, m_generated_ids.begin() + offset_back);
+                output.generated_log_probs.assign(m_generated_log_probs.begin() + offset, m_generated_log_probs.begin() + offset_back);
                 output.finish_reason = get_finish_reason();
             }
         }
-        return output;
     }
 
     size_t get_generated_len() const {
@@ -619,19 +623,28 @@ public:
     }
 
     void push_partial_outputs(size_t token_cnt = 1) {
-        GenerationOutputs outputs;
-        for (auto& sequence : m_sequences) {
-            // todo: check seq.is_finished() to generate without several </s>
-            // or is it ok to use padding?
-            auto output = sequence->get_last_generation_output(token_cnt, m_stream_window_size);
-            if (m_sampling_params.echo && !m_has_echoed) {
-                output.generated_ids.insert(output.generated_ids.begin(), m_prompt_ids.begin(), m_prompt_ids.end());
-                output.generated_log_probs.insert(output.generated_log_probs.begin(), m_prompt_log_probs.begin(), m_prompt_log_probs.end());
+        // outputs already read by the handle are overwritten in place
+        m_generation_stream->push_with([this, token_cnt](GenerationOutputs& outputs) {
+            auto is_in_group = [this](uint64_t grouped_id) {
+                return std::any_of(m_sequences.begin(), m_sequences.end(), [grouped_id](const Sequence::Ptr& sequence) {
+                    return sequence->get_grouped_id() == grouped_id;
+                });
+            };
+            for (auto it = outputs.begin(); it != outputs.end();)
+                it = is_in_group(it->first) ? std::next(it) : outputs.erase(it);
+
+            for (auto& sequence : m_sequences) {
+                // todo: check seq.is_finished() to generate without several </s>
+                // or is it ok to use padding?
+                GenerationOutput& output = outputs[sequence->get_grouped_id()];
+                sequence->fill_last_generation_output(output, token_cnt, m_stream_window_size);
+                if (m_sampling_params.echo && !m_has_echoed) {
+                    output.generated_ids.insert(output.generated_ids.begin(), m_prompt_ids.begin(), m_prompt_ids.end());
+                    output.generated_log_probs.insert(output.generated_log_probs.begin(), m_prompt_log_probs.begin(), m_prompt_log_probs.end());
+                }
             }
-            outputs.emplace(sequence->get_grouped_id(), output);
-        }
+        });
         m_has_echoed = true;
-        m_generation_stream->push(std::move(outputs));
     }
 
     void notify_handle() {
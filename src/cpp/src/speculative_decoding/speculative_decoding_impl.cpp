@@ -1,6 +1,7 @@
 // Copyright (C) 2023-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <future>
 #include <thread>
 
 #include "openvino/genai/text_streamer.hpp"
@@ -83,12 +84,16 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::SpeculativeDecodingImpl(con
     m_tokenizer = main_model_tokenizer;
 
     // to create `main_pipeline` with enabled validation_mode and `draft_pipeline` with disabled validation mode
+    // draft model is compiled concurrently with main model
+    auto draft_pipeline_future = std::async(std::launch::async, [&]() {
+        return std::make_shared<ContinuousBatchingForSpeculativeDecodingImpl>(
+            draft_model, draft_model_tokenizer, draft_model_desc.generation_config,
+            draft_kv_cache_config, draft_scheduler_config, draft_device, draft_properties, false);
+    });
     m_main_pipeline = std::make_shared<ContinuousBatchingForSpeculativeDecodingImpl>(
         main_model, main_model_tokenizer, main_model_desc.generation_config,
         main_kv_cache_config, main_scheduler_config_updated, main_device, main_model_desc.properties, true);
-    m_draft_pipeline = std::make_shared<ContinuousBatchingForSpeculativeDecodingImpl>(
-        draft_model, draft_model_tokenizer, draft_model_desc.generation_config,
-        draft_kv_cache_config, draft_scheduler_config, draft_device, draft_properties, false);
+    m_draft_pipeline = draft_pipeline_future.get();
 
     m_perf_metrics = PerfMetrics();
     m_perf_metrics.raw_metrics.m_inference_durations =  {{ MicroSeconds(0.0f) }};
@@ -226,6 +231,7 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::generate(const std::vector<
 
     OPENVINO_ASSERT(!has_non_finished_requests(), "Generate cannot be called while ContinuousBatchingPipeline is already in running state. Use ContinuousBatchingPipeline::add_request");
     OPENVINO_ASSERT(input_ids.size() == sampling_params.size());
+    utils::assert_no_batch_streamer(streamer, "Speculative decoding");
 
     ManualTimer generate_timer("speculative_decoding: generate()");
     generate_timer.start();
@@ -237,6 +243,8 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::generate(const std::vector<
     }
     m_main_pipeline->set_adapters(sampling_params[0].adapters);
     m_draft_pipeline->set_adapters(sampling_params[0].adapters);
+    m_main_pipeline->start_generation();
+    m_draft_pipeline->start_generation();
 
     const auto streamer_ptr = std::make_shared<ThreadedStreamerWrapper>(streamer, m_tokenizer);
 
@@ -0,0 +1,68 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace ov::genai {
+
+// Bounded lock-free queue for a single producer thread and a single consumer thread. Elements are never destroyed:
+// producer overwrites a slot in place and consumer reads it in place, so allocated storage of elements (e.g. vectors)
+// is reused by the next push into the same slot.
+template <typename T>
+class SPSCRingBuffer {
+public:
+    explicit SPSCRingBuffer(size_t capacity) : m_slots(round_up_to_power_of_two(capacity)), m_mask(m_slots.size() - 1) {}
+
+    SPSCRingBuffer(const SPSCRingBuffer&) = delete;
+    SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
+
+    // Producer: calls fill(T& slot) to write an element, returns false without calling it if the buffer is full
+    template <typename Fill>
+    bool try_push(Fill&& fill) {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) == m_slots.size())
+            return false;
+        fill(m_slots[tail & m_mask]);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer: calls visit(T& slot) for the oldest element, returns false without calling it if the buffer is empty
+    template <typename Visit>
+    bool try_pop(Visit&& visit) {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire))
+            return false;
+        visit(m_slots[head & m_mask]);
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const {
+        return m_slots.size();
+    }
+
+private:
+    static size_t round_up_to_power_of_two(size_t value) {
+        size_t result = 1;
+        while (result < value)
+            result <<= 1;
+        return result;
+    }
+
+    std::vector<T> m_slots;
+    const size_t m_mask;
+    // head is written by consumer and tail by producer, they are kept in different cache lines
+    alignas(64) std::atomic<size_t> m_head{0};
+    alignas(64) std::atomic<size_t> m_tail{0};
+};
+
+}  // namespace ov::genai
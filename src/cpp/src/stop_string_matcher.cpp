@@ -0,0 +1,181 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "stop_string_matcher.hpp"
+
+#include <algorithm>
+#include <queue>
+
+#include "openvino/core/except.hpp"
+
+namespace {
+// Number of tail tokens of a sequence which are checked for replacement in addition to tokens to validate
+constexpr size_t NUM_TAIL_TOKENS_TO_VERIFY = 32;
+}  // namespace
+
+namespace ov::genai {
+
+std::vector<const std::string*> TokenTextCache::get_texts(Tokenizer& tokenizer, const std::vector<int64_t>& token_ids) {
+    const std::vector<std::string>& vocab = tokenizer.get_vocab_vector();
+    auto is_in_vocab = [&vocab](int64_t token_id) {
+        return token_id >= 0 && static_cast<size_t>(token_id) < vocab.size();
+    };
+    if (!vocab.empty() && std::all_of(token_ids.begin(), token_ids.end(), is_in_vocab)) {
+        const std::vector<bool>& is_special = tokenizer.get_special_tokens_mask();
+        std::vector<const std::string*> texts;
+        texts.reserve(token_ids.size());
+        for (int64_t token_id : token_ids)
+            texts.push_back(is_special[token_id] ? &m_empty_text : &vocab[token_id]);
+        return texts;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<int64_t> missing_tokens;
+    for (int64_t token_id : token_ids) {
+        if (m_texts.count(token_id) == 0 && std::find(missing_tokens.begin(), missing_tokens.end(), token_id) == missing_tokens.end())
+            missing_tokens.push_back(token_id);
+    }
+    if (!missing_tokens.empty()) {
+        // detokenizers might strip leading space of the first token (e.g. SentencePiece), so text of a token in the middle
+        // of generated text is found as a difference between decoded [token, token] and [token]
+        std::vector<std::vector<int64_t>> batch;
+        batch.reserve(missing_tokens.size() * 2);
+        for (int64_t token_id : missing_tokens) {
+            batch.push_back({token_id});
+            batch.push_back({token_id, token_id});
+        }
+        std::vector<std::string> decoded_texts = tokenizer.decode(batch);
+        OPENVINO_ASSERT(decoded_texts.size() == batch.size());
+        for (size_t i = 0; i < missing_tokens.size(); ++i) {
+            std::string& single_text = decoded_texts[2 * i];
+            std::string& double_text = decoded_texts[2 * i + 1];
+            bool is_prefix = double_text.size() >= single_text.size() && double_text.compare(0, single_text.size(), single_text) == 0;
+            m_texts.emplace(missing_tokens[i], is_prefix ? double_text.substr(single_text.size()) : std::move(single_text));
+        }
+    }
+
+    // references to unordered_map elements are not invalidated by rehashing
+    std::vector<const std::string*> texts;
+    texts.reserve(token_ids.size());
+    for (int64_t token_id : token_ids)
+        texts.push_back(&m_texts.at(token_id));
+    return texts;
+}
+
+void TokenTextCache::reset() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_texts.clear();
+}
+
+StopStringAutomaton::StopStringAutomaton(const std::set<std::string>& stop_strings) {
+    // build trie, transition to ROOT means no transition at this point
+    m_transitions.assign(ALPHABET_SIZE, ROOT);
+    m_match_lengths.assign(1, 0);
+    for (const auto& stop_string : stop_strings) {
+        State state = ROOT;
+        for (unsigned char byte : stop_string) {
+            State& next_state = m_transitions[static_cast<size_t>(state) * ALPHABET_SIZE + byte];
+            if (next_state == ROOT) {
+                next_state = static_cast<State>(m_match_lengths.size());
+                m_match_lengths.push_back(0);
+                m_transitions.resize(m_transitions.size() + ALPHABET_SIZE, ROOT);
+            }
+            state = m_transitions[static_cast<size_t>(state) * ALPHABET_SIZE + byte];
+        }
+        m_match_lengths[state] = std::max(m_match_lengths[state], stop_string.size());
+    }
+
+    // compute failure links in BFS order and turn trie into a complete automaton
+    std::vector<State> failure(m_match_lengths.size(), ROOT);
+    std::queue<State> states_queue;
+    for (size_t byte = 0; byte < ALPHABET_SIZE; ++byte) {
+        State child = m_transitions[byte];
+        if (child != ROOT)
+            states_queue.push(child);
+    }
+    while (!states_queue.empty()) {
+        State state = states_queue.front();
+        states_queue.pop();
+        // the longest stop string ending in a state might end in its failure state
+        m_match_lengths[state] = std::max(m_match_lengths[state], m_match_lengths[failure[state]]);
+        for (size_t byte = 0; byte < ALPHABET_SIZE; ++byte) {
+            State& child = m_transitions[static_cast<size_t>(state) * ALPHABET_SIZE + byte];
+            State failure_next = m_transitions[static_cast<size_t>(failure[state]) * ALPHABET_SIZE + byte];
+            if (child != ROOT) {
+                failure[child] = failure_next;
+                states_queue.push(child);
+            } else {
+                child = failure_next;
+            }
+        }
+    }
+}
+
+MatchStopStringResult StopStringMatcher::match(uint64_t sequence_id, const TokenIds& generated_tokens, const GetTokenTexts& get_token_texts,
+                                               bool is_include_to_output, size_t num_tokens_to_validate) {
+    MatchStopStringResult result;
+    SequenceState& sequence_state = m_sequence_states[sequence_id];
+
+    // find the number of already processed tokens which are still generated by sequence
+    size_t num_valid_tokens = std::min(sequence_state.token_ids.size(), generated_tokens.size());
+    size_t num_tail_tokens = std::min(num_valid_tokens, NUM_TAIL_TOKENS_TO_VERIFY + num_tokens_to_validate);
+    for (size_t i = num_valid_tokens - num_tail_tokens; i < num_valid_tokens; ++i) {
+        if (sequence_state.token_ids[i] != generated_tokens[i]) {
+            num_valid_tokens = i;
+            break;
+        }
+    }
+    sequence_state.token_ids.resize(num_valid_tokens);
+    sequence_state.states.resize(num_valid_tokens);
+    sequence_state.text_end_offsets.resize(num_valid_tokens);
+    sequence_state.text.resize(num_valid_tokens > 0 ? sequence_state.text_end_offsets.back() : 0);
+
+    if (num_valid_tokens == generated_tokens.size())
+        return result;
+
+    TokenIds new_tokens(generated_tokens.begin() + num_valid_tokens, generated_tokens.end());
+    auto texts = get_token_texts(new_tokens);
+    OPENVINO_ASSERT(texts.size() == new_tokens.size());
+
+    StopStringAutomaton::State state = num_valid_tokens > 0 ? sequence_state.states.back() : StopStringAutomaton::ROOT;
+    for (size_t i = 0; i < new_tokens.size(); ++i) {
+        const size_t text_offset = sequence_state.text.size();
+        sequence_state.text += *texts[i];
+        sequence_state.token_ids.push_back(new_tokens[i]);
+        sequence_state.text_end_offsets.push_back(sequence_state.text.size());
+
+        for (size_t byte_idx = text_offset; byte_idx < sequence_state.text.size(); ++byte_idx) {
+            state = m_automaton.next(state, static_cast<uint8_t>(sequence_state.text[byte_idx]));
+            size_t match_length = m_automaton.get_match_length(state);
+            if (match_length == 0)
+                continue;
+
+            // find text which is kept in the output and remove word splitting symbols from its tail
+            size_t kept_text_end = is_include_to_output ? byte_idx + 1 : byte_idx + 1 - match_length;
+            while (kept_text_end > 0 && (sequence_state.text[kept_text_end - 1] == ' ' || sequence_state.text[kept_text_end - 1] == '\n'))
+                --kept_text_end;
+
+            // keep the smallest number of tokens covering kept text
+            const auto& offsets = sequence_state.text_end_offsets;
+            size_t num_kept_tokens = kept_text_end == 0 ? 0 :
+                std::lower_bound(offsets.begin(), offsets.end(), kept_text_end) - offsets.begin() + 1;
+
+            result.is_matched = true;
+            result.to_remove = generated_tokens.size() - num_kept_tokens;
+            m_sequence_states.erase(sequence_id);
+            return result;
+        }
+        sequence_state.states.push_back(state);
+    }
+    return result;
+}
+
+MatchStopStringResult StopStringMatcher::match(uint64_t sequence_id, const TokenIds& generated_tokens, Tokenizer& tokenizer,
+                                               TokenTextCache& token_text_cache, bool is_include_to_output, size_t num_tokens_to_validate) {
+    return match(sequence_id, generated_tokens, [&tokenizer, &token_text_cache](const TokenIds& token_ids) {
+        return token_text_cache.get_texts(tokenizer, token_ids);
+    }, is_include_to_output, num_tokens_to_validate);
+}
+
+}  // namespace ov::genai
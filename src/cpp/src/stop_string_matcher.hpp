@@ -0,0 +1,116 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/genai/tokenizer.hpp"
+
+namespace ov::genai {
+
+using TokenIds = std::vector<int64_t>;
+
+/**
+ * Cache of decoded texts of individual tokens shared by all requests of a sampler.
+ * Tokens which are not in the cache yet are decoded by a single batched detokenizer call,
+ * so in a steady state no detokenizer inference is required. If tokenizer provides vocabulary table, raw bytes of tokens
+ * are used directly without decoding. Thread safe.
+ * Text of a token is decoded independently of its neighbours, so tokens which are merged by detokenizer
+ * (e.g. bytes of a single UTF-8 symbol) are matched by their separately decoded texts.
+ */
+class TokenTextCache {
+    std::unordered_map<int64_t, std::string> m_texts;
+    std::mutex m_mutex;
+    const std::string m_empty_text;
+
+public:
+    /**
+     * @return Pointers to texts of the given tokens, which stay valid until reset(). Texts are taken from vocabulary table
+     * of tokenizer if it is available, special tokens have empty texts as if they were decoded with skip_special_tokens(true).
+     */
+    std::vector<const std::string*> get_texts(Tokenizer& tokenizer, const std::vector<int64_t>& token_ids);
+
+    void reset();
+};
+
+/**
+ * Aho-Corasick automaton over bytes of stop strings of a request.
+ */
+class StopStringAutomaton {
+public:
+    using State = uint32_t;
+    static constexpr State ROOT = 0;
+
+    explicit StopStringAutomaton(const std::set<std::string>& stop_strings);
+
+    State next(State state, uint8_t byte) const {
+        return m_transitions[static_cast<size_t>(state) * ALPHABET_SIZE + byte];
+    }
+
+    /**
+     * @return Length of the longest stop string which ends in the state, 0 if there is no such stop string
+     */
+    size_t get_match_length(State state) const {
+        return m_match_lengths[state];
+    }
+
+private:
+    static constexpr size_t ALPHABET_SIZE = 256;
+    // dense transition table, ALPHABET_SIZE transitions per state
+    std::vector<State> m_transitions;
+    std::vector<size_t> m_match_lengths;
+};
+
+struct MatchStopStringResult {
+    size_t to_remove = 0;
+    bool is_matched = false;
+};
+
+/**
+ * Incremental stop strings matcher of a request.
+ * Every sequence keeps automaton states and text offsets after each of its generated tokens, so matching
+ * costs O(bytes of new tokens) per step. If tail tokens of a sequence are replaced (e.g. by speculative decoding),
+ * matching is resumed from the last unchanged token.
+ */
+class StopStringMatcher {
+    struct SequenceState {
+        TokenIds token_ids;
+        std::vector<StopStringAutomaton::State> states;
+        // offset of the end of each token text within generated text
+        std::vector<size_t> text_end_offsets;
+        std::string text;
+    };
+
+    StopStringAutomaton m_automaton;
+    std::unordered_map<uint64_t, SequenceState> m_sequence_states;
+
+public:
+    using GetTokenTexts = std::function<std::vector<const std::string*>(const TokenIds&)>;
+
+    explicit StopStringMatcher(const std::set<std::string>& stop_strings) : m_automaton(stop_strings) {}
+
+    /**
+     * Feeds tokens generated by a sequence since the previous call and checks whether any stop string is generated.
+     * @param is_include_to_output Whether stop string is kept in the output
+     * @param num_tokens_to_validate Number of tail tokens which might be replaced since the previous call
+     * @return Number of last tokens to be removed from sequence in case of match
+     */
+    MatchStopStringResult match(uint64_t sequence_id, const TokenIds& generated_tokens, const GetTokenTexts& get_token_texts,
+                                bool is_include_to_output, size_t num_tokens_to_validate = 0);
+
+    MatchStopStringResult match(uint64_t sequence_id, const TokenIds& generated_tokens, Tokenizer& tokenizer,
+                                TokenTextCache& token_text_cache, bool is_include_to_output, size_t num_tokens_to_validate = 0);
+
+    void clear_sequence(uint64_t sequence_id) {
+        m_sequence_states.erase(sequence_id);
+    }
+};
+
+}  // namespace ov::genai
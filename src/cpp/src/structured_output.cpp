@@ -0,0 +1,963 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "structured_output.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <cctype>
+#include <limits>
+#include <map>
+#include <numeric>
+
+#include <nlohmann/json.hpp>
+
+#include "openvino/core/except.hpp"
+#include "sampler_kernels.hpp"
+
+namespace {
+
+// Limits protecting from exponential growth of automaton
+constexpr size_t MAX_REPETITIONS = 1000;
+constexpr size_t MAX_DFA_STATES = 20000;
+// Number of tail tokens of a sequence which are checked for replacement
+constexpr size_t NUM_TAIL_TOKENS_TO_VERIFY = 32;
+
+using ByteSet = std::bitset<256>;
+
+struct RegexNode {
+    enum class Kind { BYTES, CONCAT, ALTERNATION, REPEAT };
+
+    Kind kind;
+    ByteSet bytes;
+    std::vector<RegexNode> children;
+    size_t min_count = 0, max_count = 0;
+
+    static RegexNode make_bytes(const ByteSet& bytes) {
+        RegexNode node{Kind::BYTES};
+        node.bytes = bytes;
+        return node;
+    }
+
+    static RegexNode make_literal(const std::string& text) {
+        RegexNode node{Kind::CONCAT};
+        for (unsigned char byte : text)
+            node.children.push_back(make_bytes(ByteSet().set(byte)));
+        return node;
+    }
+};
+
+void append_utf8(std::string& text, uint32_t code_point) {
+    if (code_point < 0x80) {
+        text += static_cast<char>(code_point);
+    } else if (code_point < 0x800) {
+        text += static_cast<char>(0xC0 | (code_point >> 6));
+        text += static_cast<char>(0x80 | (code_point & 0x3F));
+    } else if (code_point < 0x10000) {
+        text += static_cast<char>(0xE0 | (code_point >> 12));
+        text += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        text += static_cast<char>(0x80 | (code_point & 0x3F));
+    } else {
+        text += static_cast<char>(0xF0 | (code_point >> 18));
+        text += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+        text += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        text += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+}
+
+ByteSet byte_range(size_t first, size_t last) {
+    ByteSet bytes;
+    for (size_t byte = first; byte <= last; ++byte)
+        bytes.set(byte);
+    return bytes;
+}
+
+class RegexParser {
+public:
+    explicit RegexParser(const std::string& regex) : m_regex(regex) {}
+
+    RegexNode parse() {
+        RegexNode node = parse_alternation();
+        OPENVINO_ASSERT(m_pos == m_regex.size(), "Unexpected '", m_regex[m_pos], "' at position ", m_pos, " of regular expression: ", m_regex);
+        return node;
+    }
+
+private:
+    const std::string& m_regex;
+    size_t m_pos = 0;
+
+    bool is_end() const {
+        return m_pos == m_regex.size();
+    }
+
+    char peek() const {
+        return m_regex[m_pos];
+    }
+
+    char get() {
+        OPENVINO_ASSERT(!is_end(), "Unexpected end of regular expression: ", m_regex);
+        return m_regex[m_pos++];
+    }
+
+    void expect(char symbol) {
+        OPENVINO_ASSERT(get() == symbol, "Expected '", symbol, "' at position ", m_pos - 1, " of regular expression: ", m_regex);
+    }
+
+    RegexNode parse_alternation() {
+        RegexNode node{RegexNode::Kind::ALTERNATION};
+        node.children.push_back(parse_concatenation());
+        while (!is_end() && peek() == '|') {
+            ++m_pos;
+            node.children.push_back(parse_concatenation());
+        }
+        return node.children.size() == 1 ? std::move(node.children[0]) : std::move(node);
+    }
+
+    RegexNode parse_concatenation() {
+        RegexNode node{RegexNode::Kind::CONCAT};
+        while (!is_end() && peek() != '|' && peek() != ')')
+            node.children.push_back(parse_quantified());
+        return node;
+    }
+
+    size_t parse_number() {
+        size_t number = 0, num_digits = 0;
+        while (!is_end() && std::isdigit(static_cast<unsigned char>(peek()))) {
+            number = number * 10 + (get() - '0');
+            OPENVINO_ASSERT(++num_digits <= 6, "Too large repetition count in regular expression: ", m_regex);
+        }
+        OPENVINO_ASSERT(num_digits > 0, "Expected number at position ", m_pos, " of regular expression: ", m_regex);
+        return number;
+    }
+
+    RegexNode parse_quantified() {
+        RegexNode node = parse_atom();
+        while (!is_end()) {
+            size_t min_count, max_count;
+            const char symbol = peek();
+            if (symbol == '*') {
+                min_count = 0, max_count = std::numeric_limits<size_t>::max();
+            } else if (symbol == '+') {
+                min_count = 1, max_count = std::numeric_limits<size_t>::max();
+            } else if (symbol == '?') {
+                min_count = 0, max_count = 1;
+            } else if (symbol == '{') {
+                ++m_pos;
+                min_count = max_count = parse_number();
+                if (peek() == ',') {
+                    ++m_pos;
+                    max_count = peek() == '}' ? std::numeric_limits<size_t>::max() : parse_number();
+                }
+                OPENVINO_ASSERT(peek() == '}' && min_count <= max_count, "Invalid repetition at position ", m_pos, " of regular expression: ", m_regex);
+            } else {
+                break;
+            }
+            ++m_pos;
+            // lazy and possessive quantifiers match the same language
+            if (!is_end() && (peek() == '?' || peek() == '+'))
+                ++m_pos;
+
+            RegexNode repeat{RegexNode::Kind::REPEAT};
+            repeat.min_count = min_count;
+            repeat.max_count = max_count;
+            repeat.children.push_back(std::move(node));
+            node = std::move(repeat);
+        }
+        return node;
+    }
+
+    RegexNode parse_atom() {
+        const char symbol = get();
+        if (symbol == '(') {
+            if (!is_end() && peek() == '?') {
+                ++m_pos;
+                expect(':');
+            }
+            RegexNode node = parse_alternation();
+            expect(')');
+            return node;
+        }
+        if (symbol == '[')
+            return parse_class();
+        if (symbol == '.')
+            return RegexNode::make_bytes(ByteSet().set().reset('\n'));
+        // expression is always matched against the whole text
+        if (symbol == '^' || symbol == '$')
+            return RegexNode{RegexNode::Kind::CONCAT};
+        if (symbol == '\\') {
+            ByteSet bytes;
+            std::string literal;
+            parse_escape(bytes, literal);
+            return literal.empty() ? RegexNode::make_bytes(bytes) : RegexNode::make_literal(literal);
+        }
+        OPENVINO_ASSERT(symbol != ')' && symbol != '*' && symbol != '+' && symbol != '?' && symbol != '{',
+                        "Unexpected '", symbol, "' at position ", m_pos - 1, " of regular expression: ", m_regex);
+        // literal multi-byte UTF-8 symbols are matched byte by byte
+        return RegexNode::make_literal(std::string(1, symbol));
+    }
+
+    uint32_t parse_hex(size_t num_digits) {
+        uint32_t value = 0;
+        for (size_t i = 0; i < num_digits; ++i) {
+            const char digit = get();
+            OPENVINO_ASSERT(std::isxdigit(static_cast<unsigned char>(digit)), "Invalid hex digit at position ", m_pos - 1, " of regular expression: ", m_regex);
+            value = value * 16 + (std::isdigit(static_cast<unsigned char>(digit)) ? digit - '0' : std::tolower(digit) - 'a' + 10);
+        }
+        return value;
+    }
+
+    // Parses escape sequence after '\' either into set of bytes (character class escapes) or into UTF-8 literal
+    void parse_escape(ByteSet& bytes, std::string& literal) {
+        const char symbol = get();
+        const ByteSet digits = byte_range('0', '9');
+        const ByteSet word = digits | byte_range('a', 'z') | byte_range('A', 'Z') | ByteSet().set('_');
+        const ByteSet spaces = ByteSet().set(' ').set('\t').set('\n').set('\r').set('\f').set('\v');
+        switch (symbol) {
+        case 'd': bytes = digits; break;
+        case 'w': bytes = word; break;
+        case 's': bytes = spaces; break;
+        case 'D': bytes = ~digits; break;
+        case 'W': bytes = ~word; break;
+        case 'S': bytes = ~spaces; break;
+        case 'n': literal = "\n"; break;
+        case 't': literal = "\t"; break;
+        case 'r': literal = "\r"; break;
+        case 'f': literal = "\f"; break;
+        case 'v': literal = "\v"; break;
+        case '0': literal = std::string(1, '\0'); break;
+        case 'x': append_utf8(literal, parse_hex(2)); break;
+        case 'u': append_utf8(literal, parse_hex(4)); break;
+        default:
+            OPENVINO_ASSERT(!std::isalnum(static_cast<unsigned char>(symbol)), "Unsupported escape sequence '\\", symbol, "' in regular expression: ", m_regex);
+            literal = std::string(1, symbol);
+        }
+    }
+
+    // Returns code point of a class member, -1 for class escapes which are merged into bytes
+    int64_t parse_class_member(ByteSet& bytes) {
+        char symbol = get();
+        std::string literal;
+        if (symbol == '\\') {
+            ByteSet escape_bytes;
+            parse_escape(escape_bytes, literal);
+            if (literal.empty()) {
+                bytes |= escape_bytes;
+                return -1;
+            }
+        } else {
+            literal = std::string(1, symbol);
+            // collect continuation bytes of UTF-8 symbol
+            while (!is_end() && (static_cast<unsigned char>(peek()) & 0xC0) == 0x80)
+                literal += get();
+        }
+        OPENVINO_ASSERT(literal.size() == 1 && static_cast<unsigned char>(literal[0]) < 0x80,
+                        "Only ASCII symbols are supported in character classes of regular expression: ", m_regex);
+        return static_cast<unsigned char>(literal[0]);
+    }
+
+    RegexNode parse_class() {
+        bool is_negated = false;
+        if (!is_end() && peek() == '^') {
+            is_negated = true;
+            ++m_pos;
+        }
+        ByteSet bytes;
+        bool is_first = true;
+        while (!is_end() && (peek() != ']' || is_first)) {
+            is_first = false;
+            int64_t first = parse_class_member(bytes);
+            if (first >= 0 && m_pos + 1 < m_regex.size() && peek() == '-' && m_regex[m_pos + 1] != ']') {
+                ++m_pos;
+                int64_t last = parse_class_member(bytes);
+                OPENVINO_ASSERT(last >= first, "Invalid character class range in regular expression: ", m_regex);
+                bytes |= byte_range(first, last);
+            } else if (first >= 0) {
+                bytes.set(first);
+            }
+        }
+        expect(']');
+        return RegexNode::make_bytes(is_negated ? ~bytes : bytes);
+    }
+};
+
+// Thompson NFA, every state has either byte transition or epsilon transitions
+class NFA {
+public:
+    struct State {
+        ByteSet bytes;
+        int next = -1;
+        std::vector<int> epsilon;
+    };
+
+    explicit NFA(const RegexNode& root) {
+        m_start = add_state();
+        m_accept = build(root, m_start);
+    }
+
+    const std::vector<State>& get_states() const {
+        return m_states;
+    }
+
+    int get_start() const {
+        return m_start;
+    }
+
+    int get_accept() const {
+        return m_accept;
+    }
+
+private:
+    std::vector<State> m_states;
+    int m_start, m_accept;
+
+    int add_state() {
+        OPENVINO_ASSERT(m_states.size() < MAX_DFA_STATES * 64, "Regular expression is too large for structured output");
+        m_states.emplace_back();
+        return static_cast<int>(m_states.size()) - 1;
+    }
+
+    // Builds fragment starting at state start, returns its end state
+    int build(const RegexNode& node, int start) {
+        switch (node.kind) {
+        case RegexNode::Kind::BYTES: {
+            int end = add_state();
+            m_states[start].bytes = node.bytes;
+            m_states[start].next = end;
+            return end;
+        }
+        case RegexNode::Kind::CONCAT: {
+            int end = start;
+            for (const auto& child : node.children) {
+                int child_start = add_state();
+                m_states[end].epsilon.push_back(child_start);
+                end = build(child, child_start);
+            }
+            return end;
+        }
+        case RegexNode::Kind::ALTERNATION: {
+            int end = add_state();
+            for (const auto& child : node.children) {
+                int child_start = add_state();
+                m_states[start].epsilon.push_back(child_start);
+                m_states[build(child, child_start)].epsilon.push_back(end);
+            }
+            return end;
+        }
+        case RegexNode::Kind::REPEAT: {
+            const RegexNode& child = node.children[0];
+            const bool is_unbounded = node.max_count == std::numeric_limits<size_t>::max();
+            OPENVINO_ASSERT(node.min_count <= MAX_REPETITIONS && (is_unbounded || node.max_count <= MAX_REPETITIONS),
+                            "Too large repetition count in regular expression, maximum is ", MAX_REPETITIONS);
+            int end = start;
+            for (size_t i = 0; i < node.min_count; ++i) {
+                int child_start = add_state();
+                m_states[end].epsilon.push_back(child_start);
+                end = build(child, child_start);
+            }
+            if (is_unbounded) {
+                int loop_start = add_state(), loop_end = add_state();
+                m_states[end].epsilon.push_back(loop_start);
+                m_states[end].epsilon.push_back(loop_end);
+                int child_start = add_state();
+                m_states[loop_start].epsilon.push_back(child_start);
+                int child_end = build(child, child_start);
+                m_states[child_end].epsilon.push_back(loop_start);
+                m_states[child_end].epsilon.push_back(loop_end);
+                return loop_end;
+            }
+            // optional repetitions are nested, so that every one of them can skip to the end
+            const int repeat_end = add_state();
+            for (size_t i = node.min_count; i < node.max_count; ++i) {
+                int child_start = add_state();
+                m_states[end].epsilon.push_back(child_start);
+                m_states[end].epsilon.push_back(repeat_end);
+                end = build(child, child_start);
+            }
+            m_states[end].epsilon.push_back(repeat_end);
+            return repeat_end;
+        }
+        }
+        OPENVINO_THROW("Unknown regular expression node");
+    }
+};
+
+std::string escape_regex(const std::string& text) {
+    static const std::string special_symbols = "\\.^$|?*+()[]{}";
+    std::string escaped;
+    for (char symbol : text) {
+        if (special_symbols.find(symbol) != std::string::npos)
+            escaped += '\\';
+        escaped += symbol;
+    }
+    return escaped;
+}
+
+// JSON schema conversion
+
+const std::string JSON_WHITESPACE = "[ \\n\\t]{0,8}";
+const std::string JSON_STRING_SYMBOL = "(?:[^\"\\\\\\x00-\\x1F]|\\\\[\"\\\\/bfnrt]|\\\\u[0-9a-fA-F]{4})";
+const std::string JSON_STRING = "\"" + JSON_STRING_SYMBOL + "*\"";
+const std::string JSON_INTEGER = "-?(?:0|[1-9][0-9]*)";
+const std::string JSON_NUMBER = JSON_INTEGER + "(?:\\.[0-9]+)?(?:[eE][+-]?[0-9]+)?";
+const std::string JSON_BOOLEAN = "(?:true|false)";
+const std::string JSON_NULL = "null";
+// Nesting depth of arrays and objects without schema
+constexpr size_t MAX_GENERIC_JSON_DEPTH = 2;
+
+const std::map<std::string, std::string> JSON_STRING_FORMATS = {
+    {"date", "\"[0-9]{4}-(?:0[1-9]|1[0-2])-(?:0[1-9]|[12][0-9]|3[01])\""},
+    {"time", "\"(?:[01][0-9]|2[0-3]):[0-5][0-9]:[0-5][0-9](?:\\.[0-9]+)?(?:Z|[+-](?:[01][0-9]|2[0-3]):[0-5][0-9])?\""},
+    {"date-time", "\"[0-9]{4}-(?:0[1-9]|1[0-2])-(?:0[1-9]|[12][0-9]|3[01])T(?:[01][0-9]|2[0-3]):[0-5][0-9]:[0-5][0-9](?:\\.[0-9]+)?(?:Z|[+-](?:[01][0-9]|2[0-3]):[0-5][0-9])?\""},
+    {"uuid", "\"[0-9a-fA-F]{8}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{4}-[0-9a-fA-F]{12}\""},
+};
+
+std::string generic_json_value_regex(size_t depth) {
+    std::string value = "(?:" + JSON_STRING + "|" + JSON_NUMBER + "|" + JSON_BOOLEAN + "|" + JSON_NULL;
+    if (depth > 0) {
+        const std::string nested = generic_json_value_regex(depth - 1);
+        value += "|\\[" + JSON_WHITESPACE + "(?:" + nested + "(?:" + JSON_WHITESPACE + "," + JSON_WHITESPACE + nested + ")*)?" + JSON_WHITESPACE + "\\]";
+        const std::string member = JSON_STRING + JSON_WHITESPACE + ":" + JSON_WHITESPACE + nested;
+        value += "|\\{" + JSON_WHITESPACE + "(?:" + member + "(?:" + JSON_WHITESPACE + "," + JSON_WHITESPACE + member + ")*)?" + JSON_WHITESPACE + "\\}";
+    }
+    return value + ")";
+}
+
+class JsonSchemaConverter {
+public:
+    explicit JsonSchemaConverter(const nlohmann::ordered_json& root) : m_root(root) {}
+
+    std::string convert(const nlohmann::ordered_json& schema) {
+        if (schema.is_boolean()) {
+            OPENVINO_ASSERT(schema.get<bool>(), "JSON schema 'false' does not allow any value");
+            return generic_json_value_regex(MAX_GENERIC_JSON_DEPTH);
+        }
+        OPENVINO_ASSERT(schema.is_object(), "JSON schema must be an object, but got: ", schema.dump());
+
+        if (schema.contains("$ref"))
+            return convert_reference(schema["$ref"].get<std::string>());
+        if (schema.contains("const"))
+            return escape_regex(schema["const"].dump());
+        if (schema.contains("enum")) {
+            std::string regex;
+            for (const auto& value : schema["enum"])
+                regex += (regex.empty() ? "" : "|") + escape_regex(value.dump());
+            return "(?:" + regex + ")";
+        }
+        for (const char* key : {"anyOf", "oneOf"}) {
+            if (schema.contains(key)) {
+                std::string regex;
+                for (const auto& subschema : schema[key])
+                    regex += (regex.empty() ? "" : "|") + convert(subschema);
+                return "(?:" + regex + ")";
+            }
+        }
+        if (schema.contains("allOf")) {
+            OPENVINO_ASSERT(schema["allOf"].size() == 1, "Only single subschema is supported in 'allOf' of JSON schema");
+            return convert(schema["allOf"][0]);
+        }
+
+        if (!schema.contains("type")) {
+            if (schema.contains("properties"))
+                return convert_object(schema);
+            if (schema.contains("items"))
+                return convert_array(schema);
+            return generic_json_value_regex(MAX_GENERIC_JSON_DEPTH);
+        }
+        if (schema["type"].is_array()) {
+            std::string regex;
+            for (const auto& type : schema["type"]) {
+                nlohmann::ordered_json subschema = schema;
+                subschema["type"] = type;
+                regex += (regex.empty() ? "" : "|") + convert(subschema);
+            }
+            return "(?:" + regex + ")";
+        }
+
+        const std::string type = schema["type"].get<std::string>();
+        if (type == "object")
+            return convert_object(schema);
+        if (type == "array")
+            return convert_array(schema);
+        if (type == "string")
+            return convert_string(schema);
+        if (type == "integer")
+            return JSON_INTEGER;
+        if (type == "number")
+            return JSON_NUMBER;
+        if (type == "boolean")
+            return JSON_BOOLEAN;
+        if (type == "null")
+            return JSON_NULL;
+        OPENVINO_THROW("Unsupported type '", type, "' in JSON schema");
+    }
+
+private:
+    const nlohmann::ordered_json& m_root;
+    std::vector<std::string> m_references;
+
+    std::string convert_reference(const std::string& reference) {
+        OPENVINO_ASSERT(reference.size() > 0 && reference[0] == '#', "Only local references are supported in JSON schema, but got: ", reference);
+        OPENVINO_ASSERT(std::find(m_references.begin(), m_references.end(), reference) == m_references.end(),
+                        "Recursive JSON schemas are not supported, reference: ", reference);
+        m_references.push_back(reference);
+        std::string regex = convert(m_root.at(nlohmann::ordered_json::json_pointer(reference.substr(1))));
+        m_references.pop_back();
+        return regex;
+    }
+
+    std::string convert_string(const nlohmann::ordered_json& schema) {
+        if (schema.contains("pattern")) {
+            std::string pattern = schema["pattern"].get<std::string>();
+            return "\"(?:" + pattern + ")\"";
+        }
+        if (schema.contains("format")) {
+            auto format_it = JSON_STRING_FORMATS.find(schema["format"].get<std::string>());
+            if (format_it != JSON_STRING_FORMATS.end())
+                return format_it->second;
+        }
+        if (schema.contains("minLength") || schema.contains("maxLength")) {
+            const size_t min_length = schema.value("minLength", size_t(0));
+            const std::string max_length = schema.contains("maxLength") ? std::to_string(schema["maxLength"].get<size_t>()) : "";
+            return "\"" + JSON_STRING_SYMBOL + "{" + std::to_string(min_length) + "," + max_length + "}\"";
+        }
+        return JSON_STRING;
+    }
+
+    std::string convert_array(const nlohmann::ordered_json& schema) {
+        const std::string item = schema.contains("items") ? convert(schema["items"]) : generic_json_value_regex(MAX_GENERIC_JSON_DEPTH - 1);
+        const size_t min_items = schema.value("minItems", size_t(0));
+        const bool is_bounded = schema.contains("maxItems");
+        const size_t max_items = is_bounded ? schema["maxItems"].get<size_t>() : std::numeric_limits<size_t>::max();
+        OPENVINO_ASSERT(min_items <= max_items, "'minItems' must not be greater than 'maxItems' in JSON schema");
+
+        const std::string open = "\\[" + JSON_WHITESPACE, close = JSON_WHITESPACE + "\\]";
+        if (max_items == 0)
+            return open + close;
+        const std::string separated_item = "(?:" + JSON_WHITESPACE + "," + JSON_WHITESPACE + item + ")";
+        const std::string tail = "{" + std::to_string(min_items > 0 ? min_items - 1 : 0) + "," +
+                                 (is_bounded ? std::to_string(max_items - 1) : "") + "}";
+        const std::string items = item + separated_item + tail;
+        return open + (min_items > 0 ? items : "(?:" + items + ")?") + close;
+    }
+
+    std::string convert_object(const nlohmann::ordered_json& schema) {
+        if (!schema.contains("properties") || schema["properties"].empty()) {
+            if (schema.value("additionalProperties", nlohmann::ordered_json(true)) == nlohmann::ordered_json(false))
+                return "\\{" + JSON_WHITESPACE + "\\}";
+            const std::string value = generic_json_value_regex(MAX_GENERIC_JSON_DEPTH - 1);
+            const std::string member = JSON_STRING + JSON_WHITESPACE + ":" + JSON_WHITESPACE + value;
+            return "\\{" + JSON_WHITESPACE + "(?:" + member + "(?:" + JSON_WHITESPACE + "," + JSON_WHITESPACE + member + ")*)?" + JSON_WHITESPACE + "\\}";
+        }
+
+        std::set<std::string> required;
+        if (schema.contains("required")) {
+            for (const auto& name : schema["required"])
+                required.insert(name.get<std::string>());
+        }
+        std::vector<std::pair<std::string, bool>> members;
+        for (const auto& [name, property_schema] : schema["properties"].items()) {
+            std::string member = escape_regex(nlohmann::ordered_json(name).dump()) + JSON_WHITESPACE + ":" + JSON_WHITESPACE + convert(property_schema);
+            members.emplace_back(std::move(member), required.count(name) > 0);
+        }
+        return "\\{" + JSON_WHITESPACE + convert_members(members, 0, false) + JSON_WHITESPACE + "\\}";
+    }
+
+    // Members are generated in the schema order, optional members may be skipped. Once a member is generated,
+    // all following members are preceded by a comma, so only the first generated member needs a branch.
+    std::string convert_members(const std::vector<std::pair<std::string, bool>>& members, size_t idx, bool is_preceded) {
+        if (idx == members.size())
+            return "";
+        const auto& [member, is_required] = members[idx];
+        const std::string separator = is_preceded ? JSON_WHITESPACE + "," + JSON_WHITESPACE : "";
+        const std::string with_member = separator + member + convert_members(members, idx + 1, true);
+        if (is_required)
+            return with_member;
+        if (is_preceded)
+            return "(?:" + separator + member + ")?" + convert_members(members, idx + 1, true);
+        return "(?:" + with_member + "|" + convert_members(members, idx + 1, false) + ")";
+    }
+};
+
+// Grammar conversion
+
+class GrammarConverter {
+public:
+    explicit GrammarConverter(const std::string& grammar) : m_grammar(grammar) {
+        skip_whitespace();
+        while (!is_end()) {
+            std::string name = parse_name();
+            skip_whitespace();
+            OPENVINO_ASSERT(m_grammar.compare(m_pos, 3, "::=") == 0, "Expected '::=' after rule name '", name, "' in grammar");
+            m_pos += 3;
+            size_t body_begin = m_pos;
+            skip_alternation();
+            OPENVINO_ASSERT(m_rules.emplace(name, m_grammar.substr(body_begin, m_pos - body_begin)).second, "Rule '", name, "' is defined more than once in grammar");
+            skip_whitespace();
+        }
+    }
+
+    std::string convert_rule(const std::string& name) {
+        auto rule_it = m_rules.find(name);
+        OPENVINO_ASSERT(rule_it != m_rules.end(), "Rule '", name, "' is not defined in grammar");
+        OPENVINO_ASSERT(std::find(m_rule_stack.begin(), m_rule_stack.end(), name) == m_rule_stack.end(),
+                        "Recursive grammars are not supported, rule: ", name);
+        m_rule_stack.push_back(name);
+        GrammarConverter body_converter(rule_it->second, m_rules, m_rule_stack);
+        std::string regex = body_converter.convert_alternation();
+        m_rule_stack.pop_back();
+        return "(?:" + regex + ")";
+    }
+
+private:
+    std::string m_grammar;
+    size_t m_pos = 0;
+    std::map<std::string, std::string> m_rules;
+    std::vector<std::string> m_rule_stack;
+
+    GrammarConverter(std::string body, const std::map<std::string, std::string>& rules, const std::vector<std::string>& rule_stack)
+        : m_grammar(std::move(body)), m_rules(rules), m_rule_stack(rule_stack) {}
+
+    bool is_end() const {
+        return m_pos == m_grammar.size();
+    }
+
+    static bool is_name_symbol(char symbol) {
+        return std::isalnum(static_cast<unsigned char>(symbol)) || symbol == '_' || symbol == '-';
+    }
+
+    void skip_whitespace() {
+        while (!is_end()) {
+            if (std::isspace(static_cast<unsigned char>(m_grammar[m_pos]))) {
+                ++m_pos;
+            } else if (m_grammar[m_pos] == '#') {
+                while (!is_end() && m_grammar[m_pos] != '\n')
+                    ++m_pos;
+            } else {
+                break;
+            }
+        }
+    }
+
+    std::string parse_name() {
+        size_t begin = m_pos;
+        while (!is_end() && is_name_symbol(m_grammar[m_pos]))
+            ++m_pos;
+        OPENVINO_ASSERT(m_pos > begin, "Expected rule name at position ", m_pos, " of grammar");
+        return m_grammar.substr(begin, m_pos - begin);
+    }
+
+    // Checks whether the next name starts a new rule definition
+    bool is_rule_definition() {
+        size_t pos = m_pos;
+        while (pos < m_grammar.size() && is_name_symbol(m_grammar[pos]))
+            ++pos;
+        if (pos == m_pos)
+            return false;
+        while (pos < m_grammar.size() && std::isspace(static_cast<unsigned char>(m_grammar[pos])))
+            ++pos;
+        return m_grammar.compare(pos, 3, "::=") == 0;
+    }
+
+    // Skips delimited literal or class, which may contain any symbols
+    std::string parse_delimited(char close) {
+        size_t begin = m_pos++;
+        while (!is_end() && m_grammar[m_pos] != close)
+            m_pos += m_grammar[m_pos] == '\\' ? 2 : 1;
+        OPENVINO_ASSERT(!is_end(), "Unterminated literal in grammar");
+        ++m_pos;
+        return m_grammar.substr(begin, m_pos - begin);
+    }
+
+    void skip_alternation() {
+        int depth = 0;
+        skip_whitespace();
+        while (!is_end() && (depth > 0 || !is_rule_definition())) {
+            const char symbol = m_grammar[m_pos];
+            if (symbol == '"') {
+                parse_delimited('"');
+            } else if (symbol == '[') {
+                parse_delimited(']');
+            } else {
+                depth += symbol == '(' ? 1 : symbol == ')' ? -1 : 0;
+                ++m_pos;
+            }
+            skip_whitespace();
+        }
+    }
+
+    std::string convert_literal(const std::string& literal) {
+        std::string text;
+        for (size_t i = 1; i + 1 < literal.size(); ++i) {
+            if (literal[i] != '\\') {
+                text += literal[i];
+                continue;
+            }
+            const char symbol = literal[++i];
+            switch (symbol) {
+            case 'n': text += '\n'; break;
+            case 't': text += '\t'; break;
+            case 'r': text += '\r'; break;
+            default: text += symbol;
+            }
+        }
+        return escape_regex(text);
+    }
+
+    std::string convert_alternation() {
+        std::string regex = convert_sequence();
+        while (!is_end() && m_grammar[m_pos] == '|') {
+            ++m_pos;
+            regex += "|" + convert_sequence();
+        }
+        return regex;
+    }
+
+    std::string convert_sequence() {
+        std::string regex;
+        skip_whitespace();
+        while (!is_end() && m_grammar[m_pos] != '|' && m_grammar[m_pos] != ')') {
+            const char symbol = m_grammar[m_pos];
+            if (symbol == '"') {
+                regex += "(?:" + convert_literal(parse_delimited('"')) + ")";
+            } else if (symbol == '[') {
+                regex += parse_delimited(']');
+            } else if (symbol == '.') {
+                ++m_pos;
+                regex += ".";
+            } else if (symbol == '(') {
+                ++m_pos;
+                regex += "(?:" + convert_alternation() + ")";
+                OPENVINO_ASSERT(!is_end() && m_grammar[m_pos] == ')', "Expected ')' in grammar");
+                ++m_pos;
+            } else if (symbol == '*' || symbol == '+' || symbol == '?') {
+                ++m_pos;
+                regex += symbol;
+            } else if (symbol == '{') {
+                regex += parse_delimited('}');
+            } else {
+                regex += convert_rule(parse_name());
+            }
+            skip_whitespace();
+        }
+        return regex;
+    }
+};
+
+}  // namespace
+
+namespace ov::genai {
+
+std::string json_schema_to_regex(const std::string& json_schema) {
+    nlohmann::ordered_json schema = nlohmann::ordered_json::parse(json_schema, nullptr, false);
+    OPENVINO_ASSERT(!schema.is_discarded(), "JSON schema of structured output is not a valid JSON");
+    return JsonSchemaConverter(schema).convert(schema);
+}
+
+std::string grammar_to_regex(const std::string& grammar) {
+    return GrammarConverter(grammar).convert_rule("root");
+}
+
+std::string get_structured_output_regex(const StructuredOutputConfig& structured_output_config) {
+    structured_output_config.validate();
+    if (structured_output_config.json_schema.has_value())
+        return json_schema_to_regex(*structured_output_config.json_schema);
+    if (structured_output_config.grammar.has_value())
+        return grammar_to_regex(*structured_output_config.grammar);
+    return *structured_output_config.regex;
+}
+
+ByteDFA::ByteDFA(const std::string& regex) {
+    const NFA nfa(RegexParser(regex).parse());
+    const auto& nfa_states = nfa.get_states();
+
+    auto epsilon_closure = [&nfa, &nfa_states](std::vector<int> states) {
+        std::vector<bool> is_visited(nfa_states.size(), false);
+        for (int state : states)
+            is_visited[state] = true;
+        for (size_t i = 0; i < states.size(); ++i) {
+            for (int next_state : nfa_states[states[i]].epsilon) {
+                if (!is_visited[next_state]) {
+                    is_visited[next_state] = true;
+                    states.push_back(next_state);
+                }
+            }
+        }
+        // only states with byte transitions and accepting state define DFA state
+        std::vector<int> closure;
+        for (int state : states) {
+            if (nfa_states[state].next >= 0 || state == nfa.get_accept())
+                closure.push_back(state);
+        }
+        std::sort(closure.begin(), closure.end());
+        return closure;
+    };
+
+    std::map<std::vector<int>, State> dfa_states;
+    std::vector<std::vector<int>> queue = {epsilon_closure({nfa.get_start()})};
+    dfa_states.emplace(queue[0], INITIAL);
+    for (size_t dfa_state = 0; dfa_state < queue.size(); ++dfa_state) {
+        const std::vector<int> closure = queue[dfa_state];
+        m_accepting.push_back(std::binary_search(closure.begin(), closure.end(), nfa.get_accept()));
+        m_transitions.resize(m_transitions.size() + ALPHABET_SIZE, DEAD);
+
+        for (size_t byte = 0; byte < ALPHABET_SIZE; ++byte) {
+            std::vector<int> next_states;
+            for (int state : closure) {
+                if (nfa_states[state].next >= 0 && nfa_states[state].bytes[byte])
+                    next_states.push_back(nfa_states[state].next);
+            }
+            if (next_states.empty())
+                continue;
+            std::vector<int> next_closure = epsilon_closure(std::move(next_states));
+            auto [it, is_inserted] = dfa_states.emplace(next_closure, static_cast<State>(queue.size()));
+            if (is_inserted) {
+                OPENVINO_ASSERT(queue.size() < MAX_DFA_STATES, "Structured output automaton exceeds ", MAX_DFA_STATES, " states");
+                queue.push_back(std::move(next_closure));
+            }
+            m_transitions[dfa_state * ALPHABET_SIZE + byte] = it->second;
+        }
+    }
+}
+
+TokenVocabulary::TokenVocabulary(std::vector<std::string> token_texts) : m_token_texts(std::move(token_texts)) {
+    // insert tokens into trie in lexicographical order of texts, so that children of a node are created contiguously
+    std::vector<int64_t> sorted_token_ids(m_token_texts.size());
+    std::iota(sorted_token_ids.begin(), sorted_token_ids.end(), 0);
+    std::sort(sorted_token_ids.begin(), sorted_token_ids.end(), [this](int64_t lhs, int64_t rhs) {
+        return m_token_texts[lhs] < m_token_texts[rhs];
+    });
+
+    struct Node {
+        std::vector<std::pair<uint8_t, uint32_t>> children;
+        std::vector<int64_t> token_ids;
+    };
+    std::vector<Node> nodes(1);
+    for (int64_t token_id : sorted_token_ids) {
+        uint32_t node = 0;
+        for (unsigned char byte : m_token_texts[token_id]) {
+            auto& children = nodes[node].children;
+            if (children.empty() || children.back().first != byte) {
+                children.emplace_back(byte, static_cast<uint32_t>(nodes.size()));
+                nodes.emplace_back();
+            }
+            node = nodes[node].children.back().second;
+        }
+        if (node != 0)
+            nodes[node].token_ids.push_back(token_id);
+    }
+
+    m_child_offsets.reserve(nodes.size() + 1);
+    m_token_offsets.reserve(nodes.size() + 1);
+    m_child_offsets.push_back(0);
+    m_token_offsets.push_back(0);
+    for (const auto& node : nodes) {
+        for (const auto& [byte, child] : node.children) {
+            m_child_bytes.push_back(byte);
+            m_child_nodes.push_back(child);
+        }
+        m_token_ids.insert(m_token_ids.end(), node.token_ids.begin(), node.token_ids.end());
+        m_child_offsets.push_back(static_cast<uint32_t>(m_child_nodes.size()));
+        m_token_offsets.push_back(static_cast<uint32_t>(m_token_ids.size()));
+    }
+}
+
+TokenAutomaton::State TokenAutomaton::next(State state, int64_t token_id) const {
+    if (state == ByteDFA::DEAD || token_id < 0 || static_cast<size_t>(token_id) >= m_vocabulary->size())
+        return ByteDFA::DEAD;
+    const std::string& text = m_vocabulary->get_text(token_id);
+    // tokens without text do not advance structured output and are not allowed
+    if (text.empty())
+        return ByteDFA::DEAD;
+    for (unsigned char byte : text) {
+        state = m_dfa->next(state, byte);
+        if (state == ByteDFA::DEAD)
+            break;
+    }
+    return state;
+}
+
+const TokenAutomaton::Bitmask& TokenAutomaton::get_mask(State state) {
+    MaskEntry* entry;
+    {
+        std::lock_guard<std::mutex> lock(m_masks_mutex);
+        auto& mask_entry = m_masks[state];
+        if (!mask_entry)
+            mask_entry = std::make_unique<MaskEntry>();
+        entry = mask_entry.get();
+    }
+    // mask is computed by the first caller, e.g. prefetch task, other callers wait for it
+    std::call_once(entry->once, [this, state, entry] {
+        Bitmask mask((m_vocabulary->size() + 31) / 32, 0);
+        m_vocabulary->traverse(state, ByteDFA::DEAD,
+            [this](State dfa_state, uint8_t byte) {
+                return m_dfa->next(dfa_state, byte);
+            },
+            [&mask](State, const int64_t* token_ids_begin, const int64_t* token_ids_end) {
+                for (const int64_t* token_id = token_ids_begin; token_id != token_ids_end; ++token_id)
+                    mask[*token_id / 32] |= 1u << (*token_id % 32);
+            });
+        entry->mask = std::move(mask);
+    });
+    return entry->mask;
+}
+
+TokenAutomaton::State StructuredOutputTransform::get_state(uint64_t sequence_id, const TokenIds& generated_tokens, size_t num_tokens) {
+    SequenceState& sequence_state = m_sequence_states[sequence_id];
+
+    // tail tokens might be replaced since the previous step, e.g. by speculative decoding
+    size_t num_valid_tokens = std::min(sequence_state.token_ids.size(), num_tokens);
+    size_t num_tail_tokens = std::min(num_valid_tokens, NUM_TAIL_TOKENS_TO_VERIFY);
+    for (size_t i = num_valid_tokens - num_tail_tokens; i < num_valid_tokens; ++i) {
+        if (sequence_state.token_ids[i] != generated_tokens[i]) {
+            num_valid_tokens = i;
+            break;
+        }
+    }
+    sequence_state.token_ids.resize(num_valid_tokens);
+    sequence_state.states.resize(num_valid_tokens);
+
+    TokenAutomaton::State state = num_valid_tokens > 0 ? sequence_state.states.back() : ByteDFA::INITIAL;
+    for (size_t i = num_valid_tokens; i < num_tokens; ++i) {
+        state = m_automaton->next(state, generated_tokens[i]);
+        sequence_state.token_ids.push_back(generated_tokens[i]);
+        sequence_state.states.push_back(state);
+    }
+    return state;
+}
+
+void StructuredOutputTransform::apply(Logits& logits, uint64_t sequence_id, const TokenIds& generated_tokens, size_t num_tokens) {
+    OPENVINO_ASSERT(!logits.m_token_ids && !logits.is_vector_initialized(), "Structured output requires logits for the whole vocabulary");
+    const TokenAutomaton::State state = get_state(sequence_id, generated_tokens, num_tokens);
+    const bool is_stop_allowed = state == ByteDFA::DEAD || m_automaton->is_accepting(state);
+
+    // stop tokens are allowed only when structured output is complete
+    std::vector<std::pair<int64_t, float>> stop_logits;
+    const float min_value = -std::numeric_limits<float>::infinity();
+    for (int64_t stop_token_id : m_stop_token_ids) {
+        if (static_cast<size_t>(stop_token_id) < logits.m_size)
+            stop_logits.emplace_back(stop_token_id, is_stop_allowed ? logits.m_data[stop_token_id] : min_value);
+    }
+
+    const size_t size = std::min(logits.m_size, m_automaton->get_vocab_size());
+    if (state == ByteDFA::DEAD) {
+        std::fill_n(logits.m_data, size, min_value);
+    } else {
+        kernels::mask_inplace(logits.m_data, size, m_automaton->get_mask(state).data(), min_value);
+    }
+    // logits of padded vocabulary do not correspond to any token
+    std::fill(logits.m_data + size, logits.m_data + logits.m_size, min_value);
+
+    for (const auto& [stop_token_id, logit] : stop_logits)
+        logits.m_data[stop_token_id] = logit;
+}
+
+void StructuredOutputTransform::prefetch(uint64_t sequence_id, const TokenIds& generated_tokens, ThreadPool& thread_pool) {
+    const TokenAutomaton::State state = get_state(sequence_id, generated_tokens, generated_tokens.size());
+    if (state != ByteDFA::DEAD) {
+        thread_pool.submit([automaton = m_automaton, state] {
+            automaton->get_mask(state);
+        });
+    }
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,197 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/genai/generation_config.hpp"
+#include "logit_processor.hpp"
+#include "threadpool.hpp"
+
+namespace ov::genai {
+
+/**
+ * Converts JSON schema into regular expression matching compact JSON documents valid against the schema.
+ * Supported keywords: type, properties, required, items, minItems, maxItems, enum, const, anyOf, oneOf, $ref (non-recursive),
+ * minLength, maxLength, pattern and format (date, time, date-time, uuid). Properties are generated in the order of the schema,
+ * additional properties are not generated.
+ */
+std::string json_schema_to_regex(const std::string& json_schema);
+
+/**
+ * Converts non-recursive EBNF grammar in GBNF notation (`rule ::= expression`, `root` is a start rule) into regular expression.
+ */
+std::string grammar_to_regex(const std::string& grammar);
+
+/**
+ * @return Regular expression describing text generated with the structured output config
+ */
+std::string get_structured_output_regex(const StructuredOutputConfig& structured_output_config);
+
+/**
+ * Deterministic finite automaton over bytes of UTF-8 text compiled from regular expression.
+ * Supported syntax: literals, escapes (\d \w \s \D \W \S \n \t \r \f \v \xHH \uHHHH), character classes, `.`, groups,
+ * alternation and quantifiers * + ? {n} {n,} {n,m}. Expression is matched against the whole text.
+ * Negated character classes and `.` match any non-ASCII byte.
+ * Every non-dead state has a path to an accepting state.
+ */
+class ByteDFA {
+public:
+    using State = int32_t;
+    static constexpr State DEAD = -1;
+    static constexpr State INITIAL = 0;
+
+    explicit ByteDFA(const std::string& regex);
+
+    State next(State state, uint8_t byte) const {
+        return m_transitions[static_cast<size_t>(state) * ALPHABET_SIZE + byte];
+    }
+
+    bool is_accepting(State state) const {
+        return m_accepting[state];
+    }
+
+    size_t num_states() const {
+        return m_accepting.size();
+    }
+
+private:
+    static constexpr size_t ALPHABET_SIZE = 256;
+    std::vector<State> m_transitions;
+    std::vector<bool> m_accepting;
+};
+
+/**
+ * Texts of all vocabulary tokens organized as a byte trie, so that tokens sharing a prefix are checked against
+ * an automaton only once. Tokens with empty text (e.g. special tokens) are not in the trie.
+ */
+class TokenVocabulary {
+public:
+    explicit TokenVocabulary(std::vector<std::string> token_texts);
+
+    size_t size() const {
+        return m_token_texts.size();
+    }
+
+    const std::string& get_text(int64_t token_id) const {
+        return m_token_texts[token_id];
+    }
+
+    /**
+     * Visits trie in depth-first order. Visitor is called as `visitor(state, token_ids_begin, token_ids_end)` for tokens
+     * ending at trie node, `advance(state, byte)` returns state of a child node, children with DEAD state are skipped.
+     */
+    template <typename State, typename Advance, typename Visitor>
+    void traverse(State initial_state, State dead_state, Advance&& advance, Visitor&& visitor) const {
+        std::vector<std::pair<uint32_t, State>> stack = {{0, initial_state}};
+        while (!stack.empty()) {
+            auto [node, state] = stack.back();
+            stack.pop_back();
+            visitor(state, m_token_ids.data() + m_token_offsets[node], m_token_ids.data() + m_token_offsets[node + 1]);
+            for (uint32_t child_idx = m_child_offsets[node]; child_idx < m_child_offsets[node + 1]; ++child_idx) {
+                State child_state = advance(state, m_child_bytes[child_idx]);
+                if (child_state != dead_state)
+                    stack.emplace_back(m_child_nodes[child_idx], child_state);
+            }
+        }
+    }
+
+private:
+    std::vector<std::string> m_token_texts;
+    // trie nodes in compressed sparse row format
+    std::vector<uint32_t> m_child_offsets, m_child_nodes, m_token_offsets;
+    std::vector<uint8_t> m_child_bytes;
+    std::vector<int64_t> m_token_ids;
+};
+
+/**
+ * Token level automaton: DFA over bytes combined with vocabulary. Masks of tokens allowed in a DFA state are computed
+ * once and cached, so masking logits costs a single pass over vocabulary bitmask. Thread safe.
+ */
+class TokenAutomaton {
+public:
+    using State = ByteDFA::State;
+    using Bitmask = std::vector<uint32_t>;
+
+    TokenAutomaton(std::shared_ptr<const TokenVocabulary> vocabulary, std::shared_ptr<const ByteDFA> dfa)
+        : m_vocabulary(std::move(vocabulary)), m_dfa(std::move(dfa)) {}
+
+    TokenAutomaton(std::shared_ptr<const TokenVocabulary> vocabulary, const std::string& regex)
+        : TokenAutomaton(std::move(vocabulary), std::make_shared<const ByteDFA>(regex)) {}
+
+    /**
+     * @return State after token, DFA::DEAD if token is not allowed in the state
+     */
+    State next(State state, int64_t token_id) const;
+
+    bool is_accepting(State state) const {
+        return m_dfa->is_accepting(state);
+    }
+
+    /**
+     * @return Bitmask of tokens allowed in the state, stop tokens are not taken into account
+     */
+    const Bitmask& get_mask(State state);
+
+    size_t get_vocab_size() const {
+        return m_vocabulary->size();
+    }
+
+private:
+    struct MaskEntry {
+        std::once_flag once;
+        Bitmask mask;
+    };
+
+    std::shared_ptr<const TokenVocabulary> m_vocabulary;
+    std::shared_ptr<const ByteDFA> m_dfa;
+    std::unordered_map<State, std::unique_ptr<MaskEntry>> m_masks;
+    std::mutex m_masks_mutex;
+};
+
+/**
+ * Masks logits of tokens which do not continue structured output of a sequence. Tokens generated by every sequence
+ * are tracked incrementally, masks for the next step are prefetched by thread pool while model inference is running.
+ */
+class StructuredOutputTransform {
+public:
+    using TokenIds = std::vector<int64_t>;
+
+    StructuredOutputTransform(std::shared_ptr<TokenAutomaton> automaton, const std::set<int64_t>& stop_token_ids)
+        : m_automaton(std::move(automaton)), m_stop_token_ids(stop_token_ids) {}
+
+    /**
+     * Masks logits for the token following the first num_tokens of generated tokens of a sequence
+     */
+    void apply(Logits& logits, uint64_t sequence_id, const TokenIds& generated_tokens, size_t num_tokens);
+
+    /**
+     * Schedules computation of mask for the token following generated tokens of a sequence
+     */
+    void prefetch(uint64_t sequence_id, const TokenIds& generated_tokens, ThreadPool& thread_pool);
+
+    void clear_sequence(uint64_t sequence_id) {
+        m_sequence_states.erase(sequence_id);
+    }
+
+private:
+    struct SequenceState {
+        TokenIds token_ids;
+        std::vector<TokenAutomaton::State> states;
+    };
+
+    TokenAutomaton::State get_state(uint64_t sequence_id, const TokenIds& generated_tokens, size_t num_tokens);
+
+    std::shared_ptr<TokenAutomaton> m_automaton;
+    std::set<int64_t> m_stop_token_ids;
+    std::unordered_map<uint64_t, SequenceState> m_sequence_states;
+};
+
+}  // namespace ov::genai
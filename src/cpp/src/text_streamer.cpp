@@ -3,6 +3,39 @@
 
 #include "openvino/genai/text_streamer.hpp"
 
+#include <algorithm>
+
+
+namespace {
+
+// Detokenizers with text post-processing (e.g. regex removing a space before apostrophe) might change text
+// of the last tokens after adding the next ones, so printing of several last tokens is delayed for them.
+constexpr size_t DELAY_N_TOKENS = 3;
+
+// Printed tokens are kept as a context for decoding of the next tokens. Once there are more of them, only the tokens
+// printed last are kept. Length of their text is not known and they are decoded once more, so it's done rarely.
+constexpr size_t MAX_NUM_CONTEXT_TOKENS = 16;
+
+bool is_incomplete_utf8(const std::string& text) {
+    constexpr char replacement[] = "\xef\xbf\xbd";  // MSVC with /utf-8 fails to compile � directly with newline in string literal error.
+    if (text.size() >= 3 && text.compare(text.size() - 3, 3, replacement) == 0)
+        return true;
+
+    // detokenizer might return raw bytes, check whether the last UTF-8 symbol has all continuation bytes
+    size_t num_continuation_bytes = 0;
+    for (auto it = text.rbegin(); it != text.rend() && num_continuation_bytes < 4; ++it) {
+        const uint8_t byte = static_cast<uint8_t>(*it);
+        if ((byte & 0xC0) == 0x80) {
+            ++num_continuation_bytes;
+            continue;
+        }
+        size_t symbol_length = (byte >> 5) == 0x6 ? 2 : (byte >> 4) == 0xE ? 3 : (byte >> 3) == 0x1E ? 4 : 1;
+        return num_continuation_bytes + 1 < symbol_length;
+    }
+    return false;
+}
+
+}  // namespace
 
 namespace ov {
 namespace genai {
@@ -10,45 +43,67 @@ namespace genai {
 TextStreamer::TextStreamer(const Tokenizer& tokenizer, std::function<ov::genai::CallbackTypeVariant(std::string)> callback) {
     m_tokenizer = tokenizer;
     m_subword_callback = callback;
+    // text decoded with vocabulary table is a concatenation of token texts, so it never changes after adding tokens
+    m_delay_n_tokens = m_tokenizer.get_vocab_vector().empty() ? DELAY_N_TOKENS : 0;
+}
+
+TextStreamer::TextStreamer(std::function<ov::genai::CallbackTypeVariant(std::string)> callback, size_t delay_n_tokens)
+    : m_subword_callback(callback), m_delay_n_tokens(delay_n_tokens) {}
+
+std::string TextStreamer::decode(const std::vector<int64_t>& tokens) {
+    return m_tokenizer.decode(tokens);
+}
+
+std::string TextStreamer::decode_tokens_cache(size_t num_tokens) {
+    if (num_tokens == 0)
+        return {};
+    return decode(std::vector<int64_t>(m_tokens_cache.begin(), m_tokens_cache.begin() + num_tokens));
 }
 
 StreamingStatus TextStreamer::write(int64_t token) {
-    std::stringstream res;
     m_tokens_cache.push_back(token);
-    std::string text = m_tokenizer.decode(m_tokens_cache);
-    m_decoded_lengths.push_back(text.length());
-    
-    if (!text.empty() && '\n' == text.back() && text.size() > m_printed_len) {
-        // Flush the cache after the new line symbol
-        res << std::string_view{text.data() + m_printed_len, text.size() - m_printed_len};
-        m_tokens_cache.clear();
-        m_decoded_lengths.clear();
-        m_printed_len = 0;
-        return run_callback_if_needed(res.str());
-    }
 
-    constexpr char replacement[] = "\xef\xbf\xbd";  // MSVC with /utf-8 fails to compile � directly with newline in string literal error.
-    if (text.size() >= 3 && text.compare(text.size() - 3, 3, replacement) == 0) {
-        m_decoded_lengths[m_decoded_lengths.size() - 1] = -1;
-        // Don't print incomplete text
-        return run_callback_if_needed(res.str());
-    }
-    constexpr size_t delay_n_tokens = 3;
-    // In some cases adding the next token can shorten the text, 
-    // e.g. when apostrophe removing regex had worked after adding new tokens.
-    // Printing several last tokens is delayed.
-    if (m_decoded_lengths.size() < delay_n_tokens) {
-        return run_callback_if_needed(res.str());
-    }
-    auto print_until = m_decoded_lengths[m_decoded_lengths.size() - delay_n_tokens];
-    if (print_until != -1 && print_until > m_printed_len) {
-        // It is possible to have a shorter text after adding new token.
-        // Print to output only if text length is increaesed.
-        res << std::string_view{text.data() + m_printed_len, print_until - m_printed_len} << std::flush;
-        m_printed_len = print_until;
+    // Only a sliding window of tokens is decoded: already printed tokens are decoded as a prefix, so that detokenizer
+    // handles the beginning of the new text (e.g. a leading space) the same way as in the whole text.
+    size_t num_tokens_to_print = m_tokens_cache.size();
+    std::string text = decode_tokens_cache(num_tokens_to_print);
+    // Flush the cache after the new line symbol, otherwise printing of the last tokens is delayed
+    if (m_delay_n_tokens > 0 && (text.empty() || text.back() != '\n')) {
+        // text is reused when the current last tokens are not delayed anymore
+        m_delayed_texts[num_tokens_to_print] = std::move(text);
+        if (num_tokens_to_print < m_num_printed_tokens + m_delay_n_tokens + 1)
+            return StreamingStatus::RUNNING;
+        num_tokens_to_print -= m_delay_n_tokens;
+        // the window without delayed tokens was decoded by one of the previous calls unless the window was moved since then
+        auto delayed_text = m_delayed_texts.find(num_tokens_to_print);
+        text = delayed_text != m_delayed_texts.end() ? delayed_text->second : decode_tokens_cache(num_tokens_to_print);
     }
 
-    return run_callback_if_needed(res.str());
+    // Don't print incomplete text
+    if (is_incomplete_utf8(text))
+        return StreamingStatus::RUNNING;
+
+    // It is possible to have a shorter text after adding new token.
+    // Print to output only if text length is increased.
+    if (text.size() <= m_printed_len)
+        return StreamingStatus::RUNNING;
+
+    const std::string printed_text = text.substr(m_printed_len);
+    const size_t num_previously_printed_tokens = m_num_printed_tokens;
+    m_num_printed_tokens = num_tokens_to_print;
+    m_printed_len = text.size();
+    // texts of windows which are not longer than the printed one are not needed anymore
+    for (auto it = m_delayed_texts.begin(); it != m_delayed_texts.end();)
+        it = it->first <= num_tokens_to_print ? m_delayed_texts.erase(it) : std::next(it);
+
+    if (m_num_printed_tokens > MAX_NUM_CONTEXT_TOKENS) {
+        // Newly printed tokens become a prefix for decoding of the next tokens
+        m_tokens_cache.erase(m_tokens_cache.begin(), m_tokens_cache.begin() + num_previously_printed_tokens);
+        m_num_printed_tokens -= num_previously_printed_tokens;
+        m_printed_len = decode_tokens_cache(m_num_printed_tokens).size();
+        m_delayed_texts.clear();
+    }
+    return run_callback_if_needed(printed_text);
 }
 
 StreamingStatus TextStreamer::set_streaming_status(CallbackTypeVariant callback_status) {
@@ -67,19 +122,85 @@ StreamingStatus TextStreamer::run_callback_if_needed(const std::string& text) {
 }
 
 void TextStreamer::end() {
-    std::stringstream res;
-    std::string text = m_tokenizer.decode(m_tokens_cache);
-    if (text.size() <= m_printed_len)
-        return;
-    res << std::string_view{text.data() + m_printed_len, text.size() - m_printed_len} << std::flush;
+    std::string text = decode_tokens_cache(m_tokens_cache.size());
+    const size_t printed_len = m_printed_len;
     m_tokens_cache.clear();
-    m_decoded_lengths.clear();
+    m_num_printed_tokens = 0;
     m_printed_len = 0;
-    m_subword_callback(res.str());
+    m_delayed_texts.clear();
+    if (text.size() <= printed_len)
+        return;
+    m_subword_callback(text.substr(printed_len));
     return;
 }
 
 ov::genai::StreamerBase::~StreamerBase() = default;
 
+StreamingStatus BatchStreamerBase::write(int64_t token) {
+    OPENVINO_THROW("BatchStreamerBase receives tokens of all requests of a batch, use write(const std::vector<BatchStreamingUpdate>&)");
+}
+
+BatchTextStreamer::BatchTextStreamer(const Tokenizer& tokenizer, Callback callback)
+    : m_tokenizer(tokenizer), m_callback(std::move(callback)) {}
+
+TextStreamer& BatchTextStreamer::get_request_streamer(size_t request_index) {
+    auto it = m_request_streamers.find(request_index);
+    if (it == m_request_streamers.end()) {
+        // text is collected until the callback is called with updates of all requests
+        auto streamer = std::make_unique<TextStreamer>(m_tokenizer, [this](std::string text) {
+            m_request_text += text;
+            return StreamingStatus::RUNNING;
+        });
+        it = m_request_streamers.emplace(request_index, std::move(streamer)).first;
+    }
+    return *it->second;
+}
+
+StreamingStatus BatchTextStreamer::write(const std::vector<BatchStreamingUpdate>& updates) {
+    std::vector<BatchStreamingUpdate> text_updates;
+    text_updates.reserve(updates.size());
+    for (const BatchStreamingUpdate& update : updates) {
+        TextStreamer& streamer = get_request_streamer(update.request_index);
+        m_request_text.clear();
+        for (int64_t token : update.tokens)
+            streamer.write(token);
+        if (update.finished) {
+            streamer.end();
+            m_request_streamers.erase(update.request_index);
+        }
+        if (m_request_text.empty() && !update.finished)
+            continue;
+        text_updates.push_back(update);
+        text_updates.back().text = std::move(m_request_text);
+    }
+
+    if (text_updates.empty())
+        return StreamingStatus::RUNNING;
+    CallbackTypeVariant callback_status = m_callback(text_updates);
+    if (auto status = std::get_if<StreamingStatus>(&callback_status))
+        return *status;
+    return std::get<bool>(callback_status) ? StreamingStatus::STOP : StreamingStatus::RUNNING;
+}
+
+void BatchTextStreamer::end() {
+    // flush requests which were not finished, e.g. after generation was stopped
+    std::vector<BatchStreamingUpdate> text_updates;
+    for (auto& [request_index, streamer] : m_request_streamers) {
+        m_request_text.clear();
+        streamer->end();
+        if (!m_request_text.empty()) {
+            text_updates.emplace_back();
+            text_updates.back().request_index = request_index;
+            text_updates.back().text = std::move(m_request_text);
+        }
+    }
+    m_request_streamers.clear();
+    std::sort(text_updates.begin(), text_updates.end(), [](const BatchStreamingUpdate& lhs, const BatchStreamingUpdate& rhs) {
+        return lhs.request_index < rhs.request_index;
+    });
+    if (!text_updates.empty())
+        m_callback(text_updates);
+}
+
 }  // namespace genai
 }  // namespace ov
\ No newline at end of file
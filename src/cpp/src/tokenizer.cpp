@@ -4,6 +4,8 @@
 #include <filesystem>
 #include <fstream>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <jinja2cpp/template.h>
 #include <jinja2cpp/template_env.h>
 #include <jinja2cpp/user_callable.h>
@@ -17,6 +19,10 @@
 #include "make_tokenizer_stateful.hpp"
 #include "tokenizers_path.hpp"
 #include "circular_buffer_queue.hpp"
+#include "vocabulary_table.hpp"
+#include "threadpool.hpp"
+#include "lru_cache.hpp"
+#include "segment_encoder.hpp"
 #include "json_utils.hpp"
 #include "utils.hpp"
 
@@ -30,6 +36,23 @@ void check_arguments(const ov::AnyMap& parameters, std::set<std::string> allowed
     }
 }
 
+// Removes genai specific num_tokenizer_infer_requests and tokenization_cache_size from properties passed to ov::Core
+ov::AnyMap get_compile_properties(const ov::AnyMap& properties, size_t& num_infer_requests) {
+    ov::AnyMap compile_properties = properties;
+    compile_properties.erase(ov::genai::tokenization_cache_size.name());
+    num_infer_requests = 0;
+    auto it = compile_properties.find(ov::genai::num_tokenizer_infer_requests.name());
+    if (it == compile_properties.end())
+        return compile_properties;
+
+    num_infer_requests = it->second.as<size_t>();
+    OPENVINO_ASSERT(num_infer_requests > 0, "num_tokenizer_infer_requests must be positive");
+    compile_properties.erase(it);
+    if (compile_properties.find(ov::num_streams.name()) == compile_properties.end())
+        compile_properties.insert(ov::num_streams(ov::streams::Num(static_cast<int32_t>(num_infer_requests))));
+    return compile_properties;
+}
+
 constexpr char bos_token_key_name[] = "bos_token";
 constexpr char eos_token_key_name[] = "eos_token";
 constexpr char pad_token_key_name[] = "pad_token";
@@ -134,13 +157,24 @@ class Tokenizer::TokenizerImpl {
 public:
     std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_ireq_queue_tokenizer;
     std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_ireq_queue_detokenizer;
+    bool m_has_tokenizer = false;
+    bool m_has_detokenizer = false;
+    // Set when infer request queues are created, see setup_tokenizer
+    std::shared_future<void> m_ready;
+    // Compilation and warm-up of tokenizer and detokenizer
+    std::future<void> m_compilation;
 
     // To change the adding special tokens mode we use a statefull subgraph,
-    // this flag holds the current state value of the CompiledModel.
-    bool m_add_special_tokens = true;
-    bool m_skip_special_tokens = true;
-    bool m_pad_to_max_length = false;
-    std::optional<int32_t> m_max_length;
+    // these flags hold the current state values of every infer request.
+    struct StateFlags {
+        bool add_special_tokens = true;
+        bool skip_special_tokens = true;
+        bool pad_to_max_length = false;
+        std::optional<int32_t> max_length;
+    };
+    // Infer requests are stored by CircularBufferQueue, so their addresses are stable
+    std::unordered_map<const ov::InferRequest*, StateFlags> m_state_flags;
+    std::mutex m_state_flags_mutex;
     bool m_older_than_24_5 = false;
 
     int64_t m_pad_token_id = -1;
@@ -153,6 +187,59 @@ public:
 
     std::string m_chat_template = {};
 
+    struct EncodeCacheKey {
+        std::string prompt;
+        bool add_special_tokens;
+        bool pad_to_max_length;
+        std::optional<int32_t> max_length;
+
+        bool operator==(const EncodeCacheKey& other) const {
+            return prompt == other.prompt && add_special_tokens == other.add_special_tokens &&
+                   pad_to_max_length == other.pad_to_max_length && max_length == other.max_length;
+        }
+    };
+    struct EncodeCacheKeyHash {
+        size_t operator()(const EncodeCacheKey& key) const {
+            size_t hash = std::hash<std::string>{}(key.prompt);
+            hash ^= (static_cast<size_t>(key.add_special_tokens) << 1) | (static_cast<size_t>(key.pad_to_max_length) << 2);
+            return hash ^ (std::hash<int32_t>{}(key.max_length.value_or(-1)) << 3);
+        }
+    };
+    // Results of single prompt encoding, enabled by tokenization_cache_size property
+    std::unique_ptr<LRUCache<EncodeCacheKey, TokenizedInputs, EncodeCacheKeyHash>> m_encode_cache;
+
+    // Detokenizer model is kept until vocabulary table is extracted from it on the first use.
+    std::shared_ptr<ov::Model> m_detokenizer_model;
+    std::shared_ptr<VocabularyTable> m_vocabulary_table;
+    std::once_flag m_vocabulary_table_once;
+
+    const VocabularyTable* get_vocabulary_table() {
+        std::call_once(m_vocabulary_table_once, [this]() {
+            if (m_detokenizer_model)
+                m_vocabulary_table = VocabularyTable::from_detokenizer(m_detokenizer_model);
+            m_detokenizer_model.reset();
+        });
+        return m_vocabulary_table.get();
+    }
+
+    ThreadPool& get_async_pool() {
+        std::call_once(m_async_pool_once, [this]() {
+            wait_ready();
+            // every thread of the pool occupies one infer request while encode or decode is running
+            size_t num_threads = std::max(m_ireq_queue_tokenizer ? m_ireq_queue_tokenizer->size() : 0,
+                                          m_ireq_queue_detokenizer ? m_ireq_queue_detokenizer->size() : 0);
+            m_async_pool = std::make_unique<ThreadPool>(std::max<size_t>(num_threads, 1));
+        });
+        return *m_async_pool;
+    }
+
+    bool get_skip_special_tokens(const ov::AnyMap& detokenization_params) const {
+        bool skip_special_tokens_flag = true;
+        ov::genai::utils::read_anymap_param(detokenization_params, skip_special_tokens.name(), skip_special_tokens_flag);
+        // detokenizers older than 24.5 skip special tokens regardless of the state, see set_state_if_necessary
+        return skip_special_tokens_flag || m_older_than_24_5;
+    }
+
     void set_state_if_necessary(CircularBufferQueueElementGuard<ov::InferRequest>& infer_request_guard, const ov::AnyMap& params) {
         // These values should be equal to default values in py_tokenizer.cpp
         // in order to get the same behavior in C++ when arguments are not specified.
@@ -166,12 +253,19 @@ public:
         ov::genai::utils::read_anymap_param(params, pad_to_max_length.name(), pad_to_max_length_val);
         ov::genai::utils::read_anymap_param(params, max_length.name(), max_length_val);
 
+        // Infer request is used exclusively by the caller, so its flags can be modified without lock
+        StateFlags* state_flags = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_state_flags_mutex);
+            state_flags = &m_state_flags[&infer_request_guard.get()];
+        }
+
         // If requested add[skip]_special_tokens, max_length or pading mode 
         // is different from the stored state, need to set state variable.
-        if (add_special_tokens_flag == m_add_special_tokens 
-            && skip_special_tokens_flag == m_skip_special_tokens
-            && max_length_val == m_max_length
-            && pad_to_max_length_val == m_pad_to_max_length) {
+        if (add_special_tokens_flag == state_flags->add_special_tokens
+            && skip_special_tokens_flag == state_flags->skip_special_tokens
+            && max_length_val == state_flags->max_length
+            && pad_to_max_length_val == state_flags->pad_to_max_length) {
             return;
         }
         if (m_older_than_24_5) {
@@ -213,10 +307,10 @@ public:
                 state.set_state(pad_to_max_length_tensor);
             }
         }
-        m_add_special_tokens = add_special_tokens_flag;
-        m_skip_special_tokens = skip_special_tokens_flag;
-        m_max_length = max_length_val;
-        m_pad_to_max_length = pad_to_max_length_val;
+        state_flags->add_special_tokens = add_special_tokens_flag;
+        state_flags->skip_special_tokens = skip_special_tokens_flag;
+        state_flags->max_length = max_length_val;
+        state_flags->pad_to_max_length = pad_to_max_length_val;
     }
 
     TokenizerImpl(const std::filesystem::path& models_path, const ov::AnyMap& properties) {
@@ -230,6 +324,8 @@ public:
     void setup_tokenizer(const std::filesystem::path& models_path, const ov::AnyMap& properties) {
         ScopedVar env_manager(tokenizers_relative_to_genai());
         auto core = get_core_singleton();
+        size_t num_infer_requests = 0;
+        const ov::AnyMap read_properties = get_compile_properties(properties, num_infer_requests);
 
         OPENVINO_ASSERT(models_path.extension() != ".xml", "'models_path' parameter should be a path to a dir not a xml file");
 
@@ -237,11 +333,11 @@ public:
         std::shared_ptr<ov::Model> ov_detokenizer = nullptr;
 
         if (std::filesystem::exists(models_path / "openvino_tokenizer.xml")) {
-            ov_tokenizer = core.read_model(models_path / "openvino_tokenizer.xml", {}, properties);
+            ov_tokenizer = core.read_model(models_path / "openvino_tokenizer.xml", {}, read_properties);
         }
 
         if (std::filesystem::exists(models_path / "openvino_detokenizer.xml")) {
-            ov_detokenizer = core.read_model(models_path / "openvino_detokenizer.xml", {}, properties);
+            ov_detokenizer = core.read_model(models_path / "openvino_detokenizer.xml", {}, read_properties);
         }
 
         read_config(models_path);
@@ -258,8 +354,12 @@ public:
         auto [ov_tokenizer, ov_detokenizer] = models;
         OPENVINO_ASSERT(ov_tokenizer || ov_detokenizer, "Neither tokenizer nor detokenzier models were provided");
 
-        auto core = get_core_singleton();
-        std::string device = "CPU"; // only CPU is supported for now
+        size_t num_infer_requests = 0;
+        ov::AnyMap compile_properties = get_compile_properties(properties, num_infer_requests);
+        size_t encode_cache_size = 0;
+        ov::genai::utils::read_anymap_param(properties, tokenization_cache_size.name(), encode_cache_size);
+        if (encode_cache_size > 0)
+            m_encode_cache = std::make_unique<LRUCache<EncodeCacheKey, TokenizedInputs, EncodeCacheKeyHash>>(encode_cache_size);
 
         // Saving IR version was added only in 24.5, so if it's missing, then it's older than 24.5
         m_older_than_24_5 = !(ov_tokenizer ? ov_tokenizer: ov_detokenizer)->has_rt_info("openvino_tokenizers_version");
@@ -269,14 +369,6 @@ public:
             manager.register_pass<MakeAddSpecialTokensSatateful>();
             manager.register_pass<MakePaddingSatateful>();
             manager.run_passes(ov_tokenizer);
-            ov::CompiledModel tokenizer = core.compile_model(ov_tokenizer, device, properties);
-            ov::genai::utils::print_compiled_model_properties(tokenizer, "OV Tokenizer");
-
-            m_ireq_queue_tokenizer = std::make_unique<CircularBufferQueue<ov::InferRequest>>(
-                tokenizer.get_property(ov::optimal_number_of_infer_requests),
-                [&tokenizer]() -> ov::InferRequest {
-                    return tokenizer.create_infer_request();
-                });
 
             const ov::AnyMap& rt_info = ov_tokenizer->get_rt_info();
             m_pad_token_id = find_or_fallback(rt_info, "pad_token_id", m_pad_token_id);
@@ -289,36 +381,103 @@ public:
             if (!fallback.has_value()) {
                 m_chat_template = find_or_fallback(rt_info, "simplified_chat_template", m_chat_template);
             }
-            // Initialize tokenizer's cache to save time later.
-            // TODO CVS-150630: Empty strings sporadically can fail, therefore use nonempty string for warmup.
-            encode("non empty string");
         }
 
         if (ov_detokenizer) {
             ov::pass::Manager manager_detok;
             manager_detok.register_pass<MakeVocabDecoderSatateful>();
             manager_detok.run_passes(ov_detokenizer);
-            ov::CompiledModel detokenizer = core.compile_model(ov_detokenizer, device, properties);
+            m_detokenizer_model = ov_detokenizer;
+        }
+
+        // Compilation runs in background, so that pipelines compile LLM and tokenizers concurrently.
+        // Everything which requires infer requests waits for m_ready, ids of special tokens and chat template are
+        // available immediately.
+        m_has_tokenizer = ov_tokenizer != nullptr;
+        m_has_detokenizer = ov_detokenizer != nullptr;
+        // core with tokenizers extension is initialized while tokenizers library path is set
+        ov::Core core = get_core_singleton();
+        auto ready = std::make_shared<std::promise<void>>();
+        m_ready = ready->get_future().share();
+        m_compilation = std::async(std::launch::async, [this, core, ready, ov_tokenizer, ov_detokenizer, compile_properties, num_infer_requests]() {
+            try {
+                compile_models(core, ov_tokenizer, ov_detokenizer, compile_properties, num_infer_requests);
+            } catch (...) {
+                // exception is rethrown on the first use of tokenizer
+                ready->set_exception(std::current_exception());
+                return;
+            }
+            ready->set_value();
+
+            // Initialize tokenizer's and detokenizer's caches to save time later. Warm-up occupies a single infer
+            // request, so calls made meanwhile are not delayed unless there is only one infer request.
+            try {
+                // TODO CVS-150630: Empty strings sporadically can fail, therefore use nonempty string for warmup.
+                if (m_ireq_queue_tokenizer)
+                    encode_uncached("non empty string", {});
+                if (m_ireq_queue_detokenizer)
+                    decode_with_model({1, 33, 199, 42, 42}, {});
+            } catch (...) {
+                // warm-up failures are not fatal, the same calls are repeated by users
+            }
+        });
+    }
+
+    void compile_models(ov::Core core, const std::shared_ptr<ov::Model>& ov_tokenizer, const std::shared_ptr<ov::Model>& ov_detokenizer,
+                        const ov::AnyMap& compile_properties, size_t num_infer_requests) {
+        std::string device = "CPU"; // only CPU is supported for now
+
+        // tokenizer and detokenizer are compiled concurrently
+        std::future<ov::CompiledModel> detokenizer_future;
+        if (ov_detokenizer) {
+            detokenizer_future = std::async(std::launch::async, [&core, &device, &ov_detokenizer, &compile_properties]() {
+                return core.compile_model(ov_detokenizer, device, compile_properties);
+            });
+        }
+
+        if (ov_tokenizer) {
+            ov::CompiledModel tokenizer = core.compile_model(ov_tokenizer, device, compile_properties);
+            ov::genai::utils::print_compiled_model_properties(tokenizer, "OV Tokenizer");
+
+            m_ireq_queue_tokenizer = std::make_unique<CircularBufferQueue<ov::InferRequest>>(
+                num_infer_requests > 0 ? num_infer_requests : tokenizer.get_property(ov::optimal_number_of_infer_requests),
+                [&tokenizer]() -> ov::InferRequest {
+                    return tokenizer.create_infer_request();
+                });
+        }
+
+        if (ov_detokenizer) {
+            ov::CompiledModel detokenizer = detokenizer_future.get();
             ov::genai::utils::print_compiled_model_properties(detokenizer, "OV Detokenizer");
 
             m_ireq_queue_detokenizer = std::make_unique<CircularBufferQueue<ov::InferRequest>>(
-                detokenizer.get_property(ov::optimal_number_of_infer_requests),
+                num_infer_requests > 0 ? num_infer_requests : detokenizer.get_property(ov::optimal_number_of_infer_requests),
                 [&detokenizer]() -> ov::InferRequest {
                     return detokenizer.create_infer_request();
                 });
 
-            // Unset/-1 token causes exception in SentencePiece detokenization.
+            // Unset/-1 token causes exception in SentencePiece detokenization. Special tokens are usually in skip list
+            // of detokenizer, so they are decoded without skipping.
             if (m_pad_token_id != -1 && m_pad_token.empty())
-                m_pad_token = decode(std::vector{m_pad_token_id}, {ov::genai::add_special_tokens(true)});
+                m_pad_token = decode_with_model({m_pad_token_id}, {ov::genai::skip_special_tokens(false)});
             if (m_bos_token_id != -1 && m_bos_token.empty())
-                m_bos_token = decode(std::vector{m_bos_token_id}, {ov::genai::add_special_tokens(true)});
+                m_bos_token = decode_with_model({m_bos_token_id}, {ov::genai::skip_special_tokens(false)});
             if (m_eos_token_id != -1 && m_eos_token.empty())
-                m_eos_token = decode(std::vector{m_eos_token_id}, {ov::genai::add_special_tokens(true)});
-            // Initialize detokenizer's cache to save time later.
-            decode({1, 33, 199, 42, 42});
+                m_eos_token = decode_with_model({m_eos_token_id}, {ov::genai::skip_special_tokens(false)});
         }
     }
 
+    // Blocks until tokenizer and detokenizer are compiled, rethrows compilation error
+    void wait_ready() const {
+        if (m_ready.valid())
+            m_ready.get();
+    }
+
+    ~TokenizerImpl() {
+        if (m_compilation.valid())
+            m_compilation.wait();
+    }
+
     // load special tokens ids from config.json
     void read_config(const std::filesystem::path& tokenizer_path) {
         auto config_file_path = tokenizer_path / "config.json";
@@ -439,9 +598,68 @@ public:
         get_id_from_str(m_eos_token, m_eos_token_id);
     }
 
+    static TokenizedInputs copy_inputs(const TokenizedInputs& inputs) {
+        TokenizedInputs copied{ov::Tensor(inputs.input_ids.get_element_type(), inputs.input_ids.get_shape()),
+                               ov::Tensor(inputs.attention_mask.get_element_type(), inputs.attention_mask.get_shape())};
+        inputs.input_ids.copy_to(copied.input_ids);
+        inputs.attention_mask.copy_to(copied.attention_mask);
+        return copied;
+    }
+
     TokenizedInputs encode(std::string prompt, const ov::AnyMap& tokenization_params = {}) {
-        OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
-                                                "Tokenizer::encode is not available");
+        if (!m_encode_cache)
+            return encode_uncached(std::move(prompt), tokenization_params);
+
+        EncodeCacheKey key{std::move(prompt), true, false, std::nullopt};
+        ov::genai::utils::read_anymap_param(tokenization_params, add_special_tokens.name(), key.add_special_tokens);
+        ov::genai::utils::read_anymap_param(tokenization_params, pad_to_max_length.name(), key.pad_to_max_length);
+        ov::genai::utils::read_anymap_param(tokenization_params, max_length.name(), key.max_length);
+        // cached tensors are never exposed, callers get copies which they are free to modify
+        if (std::optional<TokenizedInputs> cached = m_encode_cache->get(key))
+            return copy_inputs(*cached);
+
+        TokenizedInputs encoded = encode_uncached(key.prompt, tokenization_params);
+        m_encode_cache->put(key, copy_inputs(encoded));
+        return encoded;
+    }
+
+    TokenizedInputs encode_segments(const std::vector<std::string>& segments, const ov::AnyMap& tokenization_params) {
+        OPENVINO_ASSERT(!segments.empty(), "At least one segment has to be provided");
+        bool add_special_tokens_flag = true;
+        ov::genai::utils::read_anymap_param(tokenization_params, add_special_tokens.name(), add_special_tokens_flag);
+
+        // padding and truncation are applied to the whole sequence, so such prompts are tokenized as a whole
+        const bool has_sequence_params = std::any_of(tokenization_params.begin(), tokenization_params.end(), [](const auto& param) {
+            return param.first != add_special_tokens.name();
+        });
+        std::optional<std::vector<int64_t>> input_ids;
+        if (!has_sequence_params) {
+            input_ids = ov::genai::encode_segments(segments, add_special_tokens_flag, [this](const std::string& text, bool add_special) {
+                return encode_ids(text, add_special);
+            });
+        }
+        if (!input_ids) {
+            std::string prompt;
+            for (const std::string& segment : segments)
+                prompt += segment;
+            return encode(std::move(prompt), tokenization_params);
+        }
+
+        TokenizedInputs result{ov::Tensor(ov::element::i64, {1, input_ids->size()}), ov::Tensor(ov::element::i64, {1, input_ids->size()})};
+        std::copy(input_ids->begin(), input_ids->end(), result.input_ids.data<int64_t>());
+        std::fill_n(result.attention_mask.data<int64_t>(), input_ids->size(), 1);
+        return result;
+    }
+
+    std::vector<int64_t> encode_ids(const std::string& text, bool add_special_tokens_flag) {
+        ov::Tensor ids = encode(text, {ov::genai::add_special_tokens(add_special_tokens_flag)}).input_ids;
+        return std::vector<int64_t>(ids.data<int64_t>(), ids.data<int64_t>() + ids.get_size());
+    }
+
+    TokenizedInputs encode_uncached(std::string prompt, const ov::AnyMap& tokenization_params) {
+        OPENVINO_ASSERT(m_has_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
+                                         "Tokenizer::encode is not available");
+        wait_ready();
 
         CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(m_ireq_queue_tokenizer.get());
         set_state_if_necessary(infer_request_guard, tokenization_params);
@@ -457,8 +675,9 @@ public:
     }
 
     TokenizedInputs encode(std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params = {}) {
-        OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
-                                                "Tokenizer::encode is not available");
+        OPENVINO_ASSERT(m_has_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
+                                         "Tokenizer::encode is not available");
+        wait_ready();
 
         TokenizedInputs unpadded;
         {
@@ -488,8 +707,17 @@ public:
     }
 
     std::string decode(std::vector<int64_t> tokens, const ov::AnyMap& detokenization_params = {}) {
-        OPENVINO_ASSERT(m_ireq_queue_detokenizer, "Detokenizer model has not been provided. Tokenizer::decode is not available");
+        OPENVINO_ASSERT(m_has_detokenizer, "Detokenizer model has not been provided. Tokenizer::decode is not available");
+
+        const VocabularyTable* vocabulary_table = get_vocabulary_table();
+        if (vocabulary_table && vocabulary_table->can_decode(tokens.data(), tokens.size()))
+            return vocabulary_table->decode(tokens.data(), tokens.size(), get_skip_special_tokens(detokenization_params));
 
+        wait_ready();
+        return decode_with_model(std::move(tokens), detokenization_params);
+    }
+
+    std::string decode_with_model(std::vector<int64_t> tokens, const ov::AnyMap& detokenization_params) {
         CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_detokenizer.get());
         set_state_if_necessary(infer_request_guard, detokenization_params);
         size_t batch_size = 1;
@@ -500,10 +728,21 @@ public:
     }
 
     std::vector<std::string> decode(ov::Tensor tokens, const ov::AnyMap& detokenization_params = {}) {
-        OPENVINO_ASSERT(m_ireq_queue_detokenizer, "Detokenizer model has not been provided. Tokenizer::decode is not available");
+        OPENVINO_ASSERT(m_has_detokenizer, "Detokenizer model has not been provided. Tokenizer::decode is not available");
         OPENVINO_ASSERT(tokens.get_element_type() == ov::element::i64, "tokens tensor element type should be an i64");
         OPENVINO_ASSERT(tokens.get_shape().size() == 2, "tokens tensor should of rank 2 with shape [batch_size, seq_len]");
 
+        const VocabularyTable* vocabulary_table = get_vocabulary_table();
+        const size_t batch_size = tokens.get_shape()[0], seq_len = tokens.get_shape()[1];
+        if (vocabulary_table && vocabulary_table->can_decode(tokens.data<int64_t>(), tokens.get_size())) {
+            const bool skip_special_tokens_flag = get_skip_special_tokens(detokenization_params);
+            std::vector<std::string> texts(batch_size);
+            for (size_t i = 0; i < batch_size; ++i)
+                texts[i] = vocabulary_table->decode(tokens.data<int64_t>() + i * seq_len, seq_len, skip_special_tokens_flag);
+            return texts;
+        }
+
+        wait_ready();
         CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_detokenizer.get());
         set_state_if_necessary(infer_request_guard, detokenization_params);
         infer_request_guard.get().set_input_tensor(tokens);
@@ -516,7 +755,20 @@ public:
     }
 
     std::vector<std::string> decode(std::vector<std::vector<int64_t>> lines, const ov::AnyMap& detokenization_params = {}) {
-        OPENVINO_ASSERT(m_ireq_queue_detokenizer, "Detokenizer model has not been provided. Tokenizer::decode is not available");
+        OPENVINO_ASSERT(m_has_detokenizer, "Detokenizer model has not been provided. Tokenizer::decode is not available");
+
+        const VocabularyTable* vocabulary_table = get_vocabulary_table();
+        auto can_decode_line = [vocabulary_table](const std::vector<int64_t>& line) {
+            return vocabulary_table->can_decode(line.data(), line.size());
+        };
+        if (vocabulary_table && std::all_of(lines.begin(), lines.end(), can_decode_line)) {
+            const bool skip_special_tokens_flag = get_skip_special_tokens(detokenization_params);
+            std::vector<std::string> texts;
+            texts.reserve(lines.size());
+            for (const auto& line : lines)
+                texts.push_back(vocabulary_table->decode(line.data(), line.size(), skip_special_tokens_flag));
+            return texts;
+        }
 
         auto compare_lengths = [](const std::vector<int64_t>& a, const std::vector<int64_t>& b) {
             return a.size() < b.size();
@@ -533,6 +785,7 @@ public:
             std::fill(tokens_data + i * max_len + line_len, tokens_data + (i + 1) * max_len, m_pad_token_id);
         }
 
+        wait_ready();
         CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_detokenizer.get());
         set_state_if_necessary(infer_request_guard, detokenization_params);
         infer_request_guard.get().set_input_tensor(tokens);
@@ -543,6 +796,44 @@ public:
         return std::vector<std::string>(res_data, res_data + res.get_shape()[0]);
     }
 
+    struct CompiledChatTemplate {
+        jinja2::TemplateEnv env;
+        std::unique_ptr<jinja2::Template> tpl;
+    };
+    static constexpr size_t MAX_COMPILED_CHAT_TEMPLATES = 8;
+    // Parsed chat templates which are not being rendered, grouped by template string. Rendering of the same
+    // jinja2::Template from several threads is not guaranteed to be safe, so every concurrent apply_chat_template
+    // call takes its own parsed template, and a template string is parsed at most once per concurrent call.
+    mutable std::unordered_map<std::string, std::vector<std::unique_ptr<CompiledChatTemplate>>> m_compiled_chat_templates;
+    mutable std::mutex m_compiled_chat_templates_mutex;
+
+    std::unique_ptr<CompiledChatTemplate> acquire_compiled_chat_template(const std::string& chat_tpl) const {
+        {
+            std::lock_guard<std::mutex> lock(m_compiled_chat_templates_mutex);
+            auto it = m_compiled_chat_templates.find(chat_tpl);
+            if (it != m_compiled_chat_templates.end() && !it->second.empty()) {
+                std::unique_ptr<CompiledChatTemplate> compiled_template = std::move(it->second.back());
+                it->second.pop_back();
+                return compiled_template;
+            }
+        }
+
+        auto compiled_template = std::make_unique<CompiledChatTemplate>();
+        compiled_template->env.GetSettings().lstripBlocks = true;
+        compiled_template->env.GetSettings().trimBlocks = true;
+        compiled_template->tpl = std::make_unique<jinja2::Template>(&compiled_template->env);
+        compiled_template->tpl->Load(chat_tpl);
+        return compiled_template;
+    }
+
+    void release_compiled_chat_template(const std::string& chat_tpl, std::unique_ptr<CompiledChatTemplate> compiled_template) const {
+        std::lock_guard<std::mutex> lock(m_compiled_chat_templates_mutex);
+        // templates passed to apply_chat_template explicitly might differ for every call, so the cache is bounded
+        if (m_compiled_chat_templates.size() >= MAX_COMPILED_CHAT_TEMPLATES && m_compiled_chat_templates.count(chat_tpl) == 0)
+            m_compiled_chat_templates.clear();
+        m_compiled_chat_templates[chat_tpl].push_back(std::move(compiled_template));
+    }
+
     std::string apply_chat_template(ChatHistory history,
                                     bool add_generation_prompt,
                                     const std::string& chat_template) const {
@@ -551,11 +842,7 @@ public:
                         "Chat template wasn't found. This may indicate that the model wasn't trained for chat scenario."
                         " Please add 'chat_template' to tokenizer_config.json to use the model in chat scenario."
                         " For more information see the section Troubleshooting in README.md");
-        jinja2::TemplateEnv env;
-        env.GetSettings().lstripBlocks = true;
-        env.GetSettings().trimBlocks = true;
-        jinja2::Template tpl(&env);
-        tpl.Load(chat_tpl);
+        std::unique_ptr<CompiledChatTemplate> compiled_template = acquire_compiled_chat_template(chat_tpl);
 
         jinja2::UserCallable slice_callable = jinja2::MakeCallable(
             [](const jinja2::GenericList& messages, const size_t& start) {
@@ -580,6 +867,8 @@ public:
             jinja_messages.emplace_back(jinja_message);
         }
 
+        // texts of special tokens might be decoded by detokenizer
+        wait_ready();
         jinja2::ValuesMap params = {
             {"messages", jinja_messages},
             {"bos_token",  m_bos_token},
@@ -590,9 +879,14 @@ public:
         };
 
         std::string result;
+        bool is_rendered = true;
         try {
-            result = tpl.RenderAsString(params).value();
-        } catch (const std::exception& error) {
+            result = compiled_template->tpl->RenderAsString(params).value();
+        } catch (const std::exception&) {
+            is_rendered = false;
+        }
+        release_compiled_chat_template(chat_tpl, std::move(compiled_template));
+        if (!is_rendered) {
             OPENVINO_THROW("Chat template for the current model is not supported by Jinja2Cpp. "
                            "Please apply template manually to your prompt before calling generate. "
                            "For example: <start_of_turn>user{user_prompt}<end_of_turn><start_of_turn>model");
@@ -610,6 +904,11 @@ public:
     std::string get_chat_template() {
         return m_chat_template;
     }
+
+    // Threads executing encode_async and decode_async. The pool is destroyed first, so that running tasks are finished
+    // while other members are still alive.
+    std::unique_ptr<ThreadPool> m_async_pool;
+    std::once_flag m_async_pool_once;
 };
 
 Tokenizer::Tokenizer(const std::filesystem::path& tokenizer_path, const ov::AnyMap& properties) {
@@ -683,6 +982,39 @@ std::vector<std::string> Tokenizer::decode(std::vector<std::vector<int64_t>> lin
 }
 
 
+TokenizedInputs Tokenizer::encode_segments(const std::vector<std::string>& segments, const ov::AnyMap& tokenization_params) {
+    check_arguments(tokenization_params, {ov::genai::add_special_tokens.name()});
+    return m_pimpl->encode_segments(segments, tokenization_params);
+}
+
+std::future<TokenizedInputs> Tokenizer::encode_async(std::string prompt, const ov::AnyMap& tokenization_params) {
+    check_arguments(tokenization_params, {ov::genai::add_special_tokens.name(), ov::genai::max_length.name(), ov::genai::pad_to_max_length.name()});
+    return m_pimpl->get_async_pool().submit([impl = m_pimpl.get(), prompt = std::move(prompt), tokenization_params]() mutable {
+        return impl->encode(std::move(prompt), tokenization_params);
+    });
+}
+
+std::future<TokenizedInputs> Tokenizer::encode_async(std::vector<std::string> prompts, const ov::AnyMap& tokenization_params) {
+    check_arguments(tokenization_params, {ov::genai::add_special_tokens.name(), ov::genai::max_length.name(), ov::genai::pad_to_max_length.name()});
+    return m_pimpl->get_async_pool().submit([impl = m_pimpl.get(), prompts = std::move(prompts), tokenization_params]() mutable {
+        return impl->encode(prompts, tokenization_params);
+    });
+}
+
+std::future<std::string> Tokenizer::decode_async(std::vector<int64_t> tokens, const ov::AnyMap& detokenization_params) {
+    check_arguments(detokenization_params, {ov::genai::skip_special_tokens.name()});
+    return m_pimpl->get_async_pool().submit([impl = m_pimpl.get(), tokens = std::move(tokens), detokenization_params]() mutable {
+        return impl->decode(std::move(tokens), detokenization_params);
+    });
+}
+
+std::future<std::vector<std::string>> Tokenizer::decode_async(std::vector<std::vector<int64_t>> lines, const ov::AnyMap& detokenization_params) {
+    check_arguments(detokenization_params, {ov::genai::skip_special_tokens.name()});
+    return m_pimpl->get_async_pool().submit([impl = m_pimpl.get(), lines = std::move(lines), detokenization_params]() mutable {
+        return impl->decode(std::move(lines), detokenization_params);
+    });
+}
+
 int64_t Tokenizer::get_bos_token_id() const {
     return m_pimpl->m_bos_token_id;
 }
@@ -696,17 +1028,32 @@ int64_t Tokenizer::get_pad_token_id() const {
 }
 
 std::string Tokenizer::get_pad_token() const {
+    m_pimpl->wait_ready();
     return m_pimpl->m_pad_token;
 }
 
 std::string Tokenizer::get_bos_token() const {
+    m_pimpl->wait_ready();
     return m_pimpl->m_bos_token;
 }
 
 std::string Tokenizer::get_eos_token() const {
+    m_pimpl->wait_ready();
     return m_pimpl->m_eos_token;
 }
 
+const std::vector<std::string>& Tokenizer::get_vocab_vector() const {
+    static const std::vector<std::string> empty_vocab;
+    const VocabularyTable* vocabulary_table = m_pimpl->get_vocabulary_table();
+    return vocabulary_table ? vocabulary_table->get_token_bytes() : empty_vocab;
+}
+
+const std::vector<bool>& Tokenizer::get_special_tokens_mask() const {
+    static const std::vector<bool> empty_mask;
+    const VocabularyTable* vocabulary_table = m_pimpl->get_vocabulary_table();
+    return vocabulary_table ? vocabulary_table->get_special_tokens_mask() : empty_mask;
+}
+
 std::string Tokenizer::apply_chat_template(ChatHistory history,
                                            bool add_generation_prompt,
                                            const std::string& chat_template) const {
@@ -3,17 +3,22 @@
 
 #include "utils.hpp"
 
+#include <algorithm>
 #include <variant>
 #include <fstream>
 #include <memory>
 
 #include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
 #include "openvino/op/divide.hpp"
 #include "openvino/op/gather.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/matmul.hpp"
+#include "openvino/op/result.hpp"
 #include "openvino/op/slice.hpp"
 #include "openvino/op/tanh.hpp"
+#include "openvino/op/topk.hpp"
 #include "openvino/op/transpose.hpp"
 #include "openvino/genai/text_streamer.hpp"
 
@@ -152,6 +157,7 @@ ov::genai::StreamerVariant get_streamer_from_map(const ov::AnyMap& config_map) {
 }
 
 std::shared_ptr<StreamerBase> create_streamer(StreamerVariant streamer, Tokenizer tokenizer) {
+    assert_no_batch_streamer(streamer, "Pipeline");
     std::shared_ptr<StreamerBase> streamer_ptr = std::visit(overloaded{
         [](std::monostate) -> std::shared_ptr<StreamerBase> {
             return nullptr;
@@ -170,6 +176,18 @@ std::shared_ptr<StreamerBase> create_streamer(StreamerVariant streamer, Tokenize
     return streamer_ptr;
 }
 
+std::shared_ptr<BatchStreamerBase> get_batch_streamer(const StreamerVariant& streamer) {
+    if (auto streamer_ptr = std::get_if<std::shared_ptr<StreamerBase>>(&streamer))
+        return std::dynamic_pointer_cast<BatchStreamerBase>(*streamer_ptr);
+    return nullptr;
+}
+
+void assert_no_batch_streamer(const StreamerVariant& streamer, const std::string& pipeline_name) {
+    OPENVINO_ASSERT(get_batch_streamer(streamer) == nullptr,
+        pipeline_name, " streams a single sequence and does not support BatchStreamerBase. "
+        "Use ContinuousBatchingPipeline without speculative decoding or prompt lookup to stream a batch");
+}
+
 ov::genai::OptionalGenerationConfig get_config_from_map(const ov::AnyMap& config_map) {
     if (config_map.count(CONFIG_ARG_NAME))
         return config_map.at(CONFIG_ARG_NAME).as<ov::genai::GenerationConfig>();
@@ -283,6 +301,31 @@ void apply_gather_before_matmul_transformation(std::shared_ptr<ov::Model> model)
     }
 }
 
+void apply_topk_logits_transformation(std::shared_ptr<ov::Model> model, size_t num_candidates) {
+    OPENVINO_ASSERT(num_candidates > 0, "Number of logits candidates must be positive");
+
+    const auto outputs = model->outputs();
+    auto logits_it = std::find_if(outputs.begin(), outputs.end(), [](const ov::Output<ov::Node>& output) {
+        return output.get_names().count("logits") > 0;
+    });
+    OPENVINO_ASSERT(logits_it != outputs.end(), "Model does not have 'logits' output");
+    ov::Output<ov::Node> logits = logits_it->get_node_shared_ptr()->input_value(0);
+
+    auto k = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{}, std::vector<int64_t>{static_cast<int64_t>(num_candidates)});
+    auto topk = std::make_shared<ov::op::v11::TopK>(logits, k, -1, ov::op::TopKMode::MAX, ov::op::TopKSortType::SORT_VALUES, ov::element::i64);
+
+    ov::Output<ov::Node> values = topk->output(0);
+    if (values.get_element_type() != ov::element::f32) {
+        values = std::make_shared<ov::op::v0::Convert>(values, ov::element::f32);
+    }
+
+    auto values_result = std::make_shared<ov::op::v0::Result>(values);
+    values_result->output(0).get_tensor().set_names({"logits_candidates"});
+    auto token_ids_result = std::make_shared<ov::op::v0::Result>(topk->output(1));
+    token_ids_result->output(0).get_tensor().set_names({"logits_candidates_token_ids"});
+    model->add_results({values_result, token_ids_result});
+}
+
 ov::Core singleton_core() {
     static ov::Core core;
     return core;
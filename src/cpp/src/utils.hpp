@@ -94,6 +94,12 @@ void apply_slice_before_matmul_transformation(std::shared_ptr<ov::Model> model);
 
 void apply_gather_before_matmul_transformation(std::shared_ptr<ov::Model> model);
 
+/**
+ * Appends TopK over vocabulary axis of "logits" output, which produces "logits_candidates" (f32 values) and
+ * "logits_candidates_token_ids" (i64 indices) outputs of shape [..., num_candidates], sorted by value in descending order.
+ */
+void apply_topk_logits_transformation(std::shared_ptr<ov::Model> model, size_t num_candidates);
+
 ov::Core singleton_core();
 
 size_t get_first_history_difference(const ov::Tensor& encoded_history, const std::vector<int64_t> tokenized_history);
@@ -178,6 +184,12 @@ template<class... Ts> struct overloaded : Ts... {using Ts::operator()...;};
 template<class... Ts> overloaded(Ts...) -> overloaded<Ts...>;
 std::shared_ptr<StreamerBase> create_streamer(StreamerVariant streamer, Tokenizer tokenizer);
 
+// Returns streamer if it streams all requests of a batch, nullptr otherwise
+std::shared_ptr<BatchStreamerBase> get_batch_streamer(const StreamerVariant& streamer);
+
+// Throws if streamer streams all requests of a batch, called by pipelines before generation starts
+void assert_no_batch_streamer(const StreamerVariant& streamer, const std::string& pipeline_name);
+
 }  // namespace utils
 }  // namespace genai
 }  // namespace ov
@@ -80,15 +80,19 @@ public:
             )
         },
         m_is_chat_conversation{false} {
+        // language model is compiled concurrently with vision encoder, embeddings model and tokenizer
+        auto compiled_language_model_future = std::async(std::launch::async, [&models_dir, &device, &properties]() {
+            return utils::singleton_core().compile_model(
+                models_dir / "openvino_language_model.xml", device, properties
+            );
+        });
         m_inputs_embedder = std::make_shared<InputsEmbedder>(
             m_vlm_config, models_dir, device, properties);
 
         m_tokenizer = m_inputs_embedder->get_tokenizer();
         m_embedding = m_inputs_embedder->get_embedding_model();
 
-        auto compiled_language_model = utils::singleton_core().compile_model(
-            models_dir / "openvino_language_model.xml", device, properties
-        );
+        auto compiled_language_model = compiled_language_model_future.get();
         ov::genai::utils::print_compiled_model_properties(compiled_language_model, "VLM language model");
         auto language_model = compiled_language_model.get_runtime_model();
         m_kv_cache_seq_length_axis = ov::genai::utils::get_kv_axes_pos(language_model).seq_len;
@@ -103,7 +107,6 @@ public:
         }
 
         m_sampler.set_tokenizer(m_tokenizer);
-        m_sampler.set_seed(m_generation_config.rng_seed);
     }
 
     VLMPipelineImpl(
@@ -141,7 +144,6 @@ public:
         }
 
         m_sampler.set_tokenizer(m_tokenizer);
-        m_sampler.set_seed(m_generation_config.rng_seed);
     }
 
     VLMDecodedResults generate(
@@ -210,10 +212,6 @@ public:
         std::optional<int64_t> rope_delta;
         std::tie(position_ids, rope_delta) = m_inputs_embedder->get_position_ids(inputs_embeds_size, history_size);
 
-        if (m_sampler.get_seed() != generation_config.rng_seed) {
-            m_sampler.set_seed(generation_config.rng_seed);
-        }
-
         ov::genai::utils::GenerationFinishInfo finish_info = ov::genai::get_lm_encoded_results(m_language, inputs_embeds, new_atten_mask, streamer_ptr, m_sampler, requests,
                                                                                                position_ids, kv_cache_state, m_embedding, rope_delta);
 
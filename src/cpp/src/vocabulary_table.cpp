@@ -0,0 +1,332 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "vocabulary_table.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <optional>
+#include <set>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/op/constant.hpp"
+
+namespace {
+
+// Operations of detokenizer which are expressed by VocabularyTable, other operations make C++ decoding unavailable
+const std::set<std::string> SUPPORTED_DETOKENIZER_OPS = {
+    "Parameter", "Result", "Constant", "Convert", "Slice", "Multiply", "ReadValue", "Assign",
+    "VocabDecoder", "StringTensorUnpack", "StringTensorPack", "FuzeRagged", "CharsToBytes",
+    "ByteFallback", "RegexNormalization", "UTF8Validate",
+};
+
+const std::string METASPACE = "\xE2\x96\x81";
+const std::string REPLACEMENT_CHARACTER = "\xEF\xBF\xBD";
+
+// inverse of GPT-2 bytes_to_unicode mapping: printable bytes map to themselves, others to code points starting from 256
+std::array<int, 324> get_unicode_to_byte_table() {
+    std::array<int, 324> table;
+    table.fill(-1);
+    int next_code_point = 256;
+    for (int byte = 0; byte < 256; ++byte) {
+        bool is_printable = (byte >= 33 && byte <= 126) || (byte >= 161 && byte <= 172) || (byte >= 174 && byte <= 255);
+        table[is_printable ? byte : next_code_point++] = byte;
+    }
+    return table;
+}
+
+// @return code point of UTF-8 character starting at position, -1 for invalid sequences
+int32_t read_code_point(const std::string& text, size_t& pos) {
+    const uint8_t lead = static_cast<uint8_t>(text[pos]);
+    size_t length = lead < 0x80 ? 1 : (lead >> 5) == 0x6 ? 2 : (lead >> 4) == 0xE ? 3 : (lead >> 3) == 0x1E ? 4 : 0;
+    if (length == 0 || pos + length > text.size())
+        return -1;
+    int32_t code_point = length == 1 ? lead : lead & (0x7F >> length);
+    for (size_t i = 1; i < length; ++i) {
+        const uint8_t byte = static_cast<uint8_t>(text[pos + i]);
+        if ((byte & 0xC0) != 0x80)
+            return -1;
+        code_point = (code_point << 6) | (byte & 0x3F);
+    }
+    pos += length;
+    return code_point;
+}
+
+std::optional<std::string> chars_to_bytes(const std::string& text) {
+    static const std::array<int, 324> unicode_to_byte = get_unicode_to_byte_table();
+    std::string bytes;
+    bytes.reserve(text.size());
+    for (size_t pos = 0; pos < text.size();) {
+        int32_t code_point = read_code_point(text, pos);
+        if (code_point < 0 || code_point >= static_cast<int32_t>(unicode_to_byte.size()) || unicode_to_byte[code_point] < 0)
+            return std::nullopt;
+        bytes.push_back(static_cast<char>(unicode_to_byte[code_point]));
+    }
+    return bytes;
+}
+
+std::optional<char> parse_byte_fallback_token(const std::string& text) {
+    if (text.size() != 6 || text.compare(0, 3, "<0x") != 0 || text.back() != '>' ||
+        !std::isxdigit(static_cast<unsigned char>(text[3])) || !std::isxdigit(static_cast<unsigned char>(text[4])))
+        return std::nullopt;
+    return static_cast<char>(std::stoi(text.substr(3, 2), nullptr, 16));
+}
+
+// Appends bytes replacing maximal invalid subparts of UTF-8 sequences as Python's decode(errors="replace") does
+void append_valid_utf8(std::string& result, const std::string& bytes, size_t begin, bool replace_invalid) {
+    for (size_t pos = begin; pos < bytes.size();) {
+        const uint8_t lead = static_cast<uint8_t>(bytes[pos]);
+        size_t length = 0;
+        uint8_t second_min = 0x80, second_max = 0xBF;
+        if (lead < 0x80) {
+            length = 1;
+        } else if (lead >= 0xC2 && lead <= 0xDF) {
+            length = 2;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            length = 3;
+            second_min = lead == 0xE0 ? 0xA0 : 0x80;
+            second_max = lead == 0xED ? 0x9F : 0xBF;
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            length = 4;
+            second_min = lead == 0xF0 ? 0x90 : 0x80;
+            second_max = lead == 0xF4 ? 0x8F : 0xBF;
+        }
+
+        size_t num_valid = length > 0 ? 1 : 0;
+        while (num_valid > 0 && num_valid < length && pos + num_valid < bytes.size()) {
+            const uint8_t byte = static_cast<uint8_t>(bytes[pos + num_valid]);
+            bool is_second = num_valid == 1;
+            if (byte < (is_second ? second_min : 0x80) || byte > (is_second ? second_max : 0xBF))
+                break;
+            ++num_valid;
+        }
+
+        if (length > 0 && num_valid == length) {
+            result.append(bytes, pos, length);
+            pos += length;
+        } else {
+            if (replace_invalid)
+                result += REPLACEMENT_CHARACTER;
+            pos += std::max<size_t>(num_valid, 1);
+        }
+    }
+}
+
+std::shared_ptr<ov::op::v0::Constant> get_constant(const std::shared_ptr<ov::Node>& node) {
+    return ov::as_type_ptr<ov::op::v0::Constant>(node);
+}
+
+std::optional<std::string> read_string_constant(const std::shared_ptr<ov::Node>& node) {
+    auto constant = get_constant(node);
+    if (!constant)
+        return std::nullopt;
+    if (constant->get_element_type() == ov::element::string && ov::shape_size(constant->get_shape()) == 1)
+        return *static_cast<const std::string*>(constant->get_data_ptr());
+    if (constant->get_element_type() == ov::element::u8)
+        return std::string(static_cast<const char*>(constant->get_data_ptr()), ov::shape_size(constant->get_shape()));
+    return std::nullopt;
+}
+
+// Reads vocabulary from (begins, ends, chars) inputs of VocabDecoder, which are either constants or outputs of
+// StringTensorUnpack of a string constant. String constant is an ov::element::string tensor or a u8 tensor packed
+// as [batch_size, offsets[batch_size + 1], chars].
+std::optional<std::vector<std::string>> read_vocabulary(const std::shared_ptr<ov::Node>& vocab_decoder) {
+    auto begins_const = get_constant(vocab_decoder->get_input_node_shared_ptr(1));
+    auto ends_const = get_constant(vocab_decoder->get_input_node_shared_ptr(2));
+    auto chars_const = get_constant(vocab_decoder->get_input_node_shared_ptr(3));
+    std::vector<std::string> vocabulary;
+    if (begins_const && ends_const && chars_const) {
+        const auto begins = begins_const->cast_vector<int64_t>();
+        const auto ends = ends_const->cast_vector<int64_t>();
+        const auto* chars = static_cast<const char*>(chars_const->get_data_ptr());
+        const int64_t num_chars = static_cast<int64_t>(ov::shape_size(chars_const->get_shape()));
+        if (begins.size() != ends.size())
+            return std::nullopt;
+        vocabulary.reserve(begins.size());
+        for (size_t i = 0; i < begins.size(); ++i) {
+            if (begins[i] < 0 || begins[i] > ends[i] || ends[i] > num_chars)
+                return std::nullopt;
+            vocabulary.emplace_back(chars + begins[i], chars + ends[i]);
+        }
+        return vocabulary;
+    }
+
+    auto unpack = vocab_decoder->get_input_node_shared_ptr(1);
+    if (std::strcmp(unpack->get_type_info().name, "StringTensorUnpack") != 0 || unpack != vocab_decoder->get_input_node_shared_ptr(2) ||
+        unpack != vocab_decoder->get_input_node_shared_ptr(3))
+        return std::nullopt;
+    auto strings_const = get_constant(unpack->get_input_node_shared_ptr(0));
+    if (!strings_const)
+        return std::nullopt;
+
+    if (strings_const->get_element_type() == ov::element::string) {
+        const auto* strings = static_cast<const std::string*>(strings_const->get_data_ptr());
+        return std::vector<std::string>(strings, strings + ov::shape_size(strings_const->get_shape()));
+    }
+    if (strings_const->get_element_type() != ov::element::u8)
+        return std::nullopt;
+
+    const auto* packed = static_cast<const char*>(strings_const->get_data_ptr());
+    const size_t packed_size = ov::shape_size(strings_const->get_shape());
+    int32_t batch_size = 0;
+    if (packed_size < sizeof(int32_t))
+        return std::nullopt;
+    std::memcpy(&batch_size, packed, sizeof(int32_t));
+    const size_t chars_offset = sizeof(int32_t) * (static_cast<size_t>(batch_size) + 2);
+    if (batch_size < 0 || packed_size < chars_offset)
+        return std::nullopt;
+    std::vector<int32_t> offsets(batch_size + 1);
+    std::memcpy(offsets.data(), packed + sizeof(int32_t), sizeof(int32_t) * offsets.size());
+    vocabulary.reserve(batch_size);
+    for (int32_t i = 0; i < batch_size; ++i) {
+        if (offsets[i] < 0 || offsets[i] > offsets[i + 1] || chars_offset + offsets[i + 1] > packed_size)
+            return std::nullopt;
+        vocabulary.emplace_back(packed + chars_offset + offsets[i], packed + chars_offset + offsets[i + 1]);
+    }
+    return vocabulary;
+}
+
+std::optional<std::vector<int64_t>> read_skip_tokens(const std::shared_ptr<ov::Node>& vocab_decoder) {
+    if (vocab_decoder->get_input_size() < 5)
+        return std::vector<int64_t>{};
+    auto skip_tokens = vocab_decoder->get_input_node_shared_ptr(4);
+    // MakeVocabDecoderSatateful inserts Slice which selects either all skip tokens or none of them
+    if (std::strcmp(skip_tokens->get_type_info().name, "Slice") == 0)
+        skip_tokens = skip_tokens->get_input_node_shared_ptr(0);
+    auto skip_tokens_const = get_constant(skip_tokens);
+    if (!skip_tokens_const)
+        return std::nullopt;
+    return skip_tokens_const->cast_vector<int64_t>();
+}
+
+class BoolAttributeReader : public ov::AttributeVisitor {
+public:
+    explicit BoolAttributeReader(std::string name) : m_name(std::move(name)) {}
+
+    using ov::AttributeVisitor::on_adapter;
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {}
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        if (name == m_name)
+            m_value = adapter.get();
+    }
+
+    std::optional<bool> get_value() const {
+        return m_value;
+    }
+
+private:
+    std::string m_name;
+    std::optional<bool> m_value;
+};
+
+}  // namespace
+
+namespace ov::genai {
+
+VocabularyTable::VocabularyTable(const std::vector<std::string>& token_texts, const std::vector<int64_t>& special_token_ids,
+                                 const DecoderOptions& options)
+    : m_is_special(token_texts.size(), false), m_options(options) {
+    m_token_bytes.reserve(token_texts.size());
+    for (const std::string& text : token_texts) {
+        std::string bytes = text;
+        if (m_options.is_byte_level) {
+            // tokens which are not in bytes to unicode mapping (e.g. added tokens) are kept as is
+            if (auto decoded = chars_to_bytes(text))
+                bytes = std::move(*decoded);
+        }
+        if (m_options.replace_metaspace) {
+            for (size_t pos = bytes.find(METASPACE); pos != std::string::npos; pos = bytes.find(METASPACE, pos + 1))
+                bytes.replace(pos, METASPACE.size(), " ");
+        }
+        if (m_options.byte_fallback) {
+            if (auto byte = parse_byte_fallback_token(bytes))
+                bytes = std::string(1, *byte);
+        }
+        m_token_bytes.push_back(std::move(bytes));
+    }
+    for (int64_t token_id : special_token_ids) {
+        if (token_id >= 0 && static_cast<size_t>(token_id) < m_is_special.size())
+            m_is_special[token_id] = true;
+    }
+}
+
+std::shared_ptr<VocabularyTable> VocabularyTable::from_detokenizer(const std::shared_ptr<ov::Model>& detokenizer) {
+    std::shared_ptr<ov::Node> vocab_decoder;
+    DecoderOptions options;
+    for (const auto& node : detokenizer->get_ordered_ops()) {
+        const std::string type_name = node->get_type_info().name;
+        if (SUPPORTED_DETOKENIZER_OPS.count(type_name) == 0)
+            return nullptr;
+
+        if (type_name == "VocabDecoder") {
+            if (vocab_decoder || node->get_input_size() < 4)
+                return nullptr;
+            vocab_decoder = node;
+        } else if (type_name == "CharsToBytes") {
+            options.is_byte_level = true;
+        } else if (type_name == "ByteFallback") {
+            options.byte_fallback = true;
+        } else if (type_name == "UTF8Validate") {
+            BoolAttributeReader reader("replace_mode");
+            node->visit_attributes(reader);
+            options.validate_utf8 = true;
+            // replace_mode is false by default in UTF8Validate
+            options.replace_invalid_utf8 = reader.get_value().value_or(false);
+        } else if (type_name == "RegexNormalization") {
+            // search and replace patterns are the last inputs
+            const size_t num_inputs = node->get_input_size();
+            if (num_inputs < 2)
+                return nullptr;
+            auto search_pattern = read_string_constant(node->get_input_node_shared_ptr(num_inputs - 2));
+            auto replace_pattern = read_string_constant(node->get_input_node_shared_ptr(num_inputs - 1));
+            if (!search_pattern || !replace_pattern)
+                return nullptr;
+            if (*search_pattern == METASPACE && *replace_pattern == " ")
+                options.replace_metaspace = true;
+            else if (*search_pattern == "^ " && replace_pattern->empty())
+                options.strip_leading_space = true;
+            else
+                return nullptr;
+        }
+    }
+    if (!vocab_decoder)
+        return nullptr;
+
+    auto vocabulary = read_vocabulary(vocab_decoder);
+    auto skip_tokens = read_skip_tokens(vocab_decoder);
+    if (!vocabulary || !skip_tokens)
+        return nullptr;
+    return std::make_shared<VocabularyTable>(*vocabulary, *skip_tokens, options);
+}
+
+bool VocabularyTable::can_decode(const int64_t* token_ids, size_t num_tokens) const {
+    for (size_t i = 0; i < num_tokens; ++i) {
+        if (token_ids[i] < 0 || static_cast<size_t>(token_ids[i]) >= m_token_bytes.size())
+            return false;
+    }
+    return true;
+}
+
+std::string VocabularyTable::decode(const int64_t* token_ids, size_t num_tokens, bool skip_special_tokens) const {
+    std::string bytes;
+    for (size_t i = 0; i < num_tokens; ++i) {
+        if (skip_special_tokens && m_is_special[token_ids[i]])
+            continue;
+        bytes += m_token_bytes[token_ids[i]];
+    }
+
+    size_t begin = m_options.strip_leading_space && !bytes.empty() && bytes.front() == ' ' ? 1 : 0;
+    std::string text;
+    text.reserve(bytes.size() - begin);
+    if (m_options.validate_utf8)
+        append_valid_utf8(text, bytes, begin, m_options.replace_invalid_utf8);
+    else
+        text.append(bytes, begin, std::string::npos);
+    return text;
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,69 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+
+namespace ov::genai {
+
+/**
+ * Token id to raw bytes table extracted from VocabDecoder operation of a detokenizer model. Decodes tokens in C++
+ * without model inference if all operations of detokenizer can be expressed by the table: byte-level BPE vocabularies
+ * (CharsToBytes) and SentencePiece-like vocabularies (metaspace replacement, byte fallback, stripping of leading space).
+ */
+class VocabularyTable {
+public:
+    struct DecoderOptions {
+        // token texts are encoded with GPT-2 bytes to unicode mapping
+        bool is_byte_level = false;
+        // U+2581 (metaspace) is replaced with space
+        bool replace_metaspace = false;
+        // <0xHH> tokens are decoded into a single byte
+        bool byte_fallback = false;
+        // a space at the beginning of decoded text is removed
+        bool strip_leading_space = false;
+        // decoded text is validated as UTF-8 by UTF8Validate operation, otherwise bytes are kept as is
+        bool validate_utf8 = false;
+        // invalid UTF-8 sequences are replaced with U+FFFD, otherwise they are removed; used only with validate_utf8
+        bool replace_invalid_utf8 = false;
+    };
+
+    VocabularyTable(const std::vector<std::string>& token_texts, const std::vector<int64_t>& special_token_ids, const DecoderOptions& options);
+
+    /**
+     * @return Table of detokenizer model, nullptr if detokenizer contains operations which are not supported by the table
+     */
+    static std::shared_ptr<VocabularyTable> from_detokenizer(const std::shared_ptr<ov::Model>& detokenizer);
+
+    size_t size() const {
+        return m_token_bytes.size();
+    }
+
+    const std::vector<std::string>& get_token_bytes() const {
+        return m_token_bytes;
+    }
+
+    const std::vector<bool>& get_special_tokens_mask() const {
+        return m_is_special;
+    }
+
+    /**
+     * @return false if some tokens are out of vocabulary, they have to be decoded by detokenizer model
+     */
+    bool can_decode(const int64_t* token_ids, size_t num_tokens) const;
+
+    std::string decode(const int64_t* token_ids, size_t num_tokens, bool skip_special_tokens) const;
+
+private:
+    std::vector<std::string> m_token_bytes;
+    std::vector<bool> m_is_special;
+    DecoderOptions m_options;
+};
+
+}  // namespace ov::genai
@@ -315,6 +315,8 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
         chunk_init_tokens.insert(chunk_init_tokens.end(), init_tokens.begin(), init_tokens.end());
 
         SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(0, chunk_init_tokens, config, 1);
+        sampler.prepare_structured_output(sequence_group->get_request_id(), config);
+        sampler.start_generation();
 
         auto [result, cancelled] = decode(decoder,
                                           chunk_init_tokens,
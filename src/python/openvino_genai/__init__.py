@@ -43,7 +43,8 @@ from .py_openvino_genai import (
 # Generation config
 from .py_openvino_genai import (
     GenerationConfig,
-    StopCriteria
+    StopCriteria,
+    StructuredOutputConfig
 )
 
 # Tokenizers
@@ -85,6 +86,7 @@ from .py_openvino_genai import (
 # Continuous batching
 from .py_openvino_genai import (
     ContinuousBatchingPipeline,
+    GenerationCompletionQueue,
     GenerationResult,
     SchedulerConfig,
     CacheEvictionConfig,
@@ -2,10 +2,11 @@
 Pybind11 binding for Whisper Pipeline
 """
 from __future__ import annotations
+import numpy
 import openvino._pyopenvino
 import os
 import typing
-__all__ = ['Adapter', 'AdapterConfig', 'AggregationMode', 'AutoencoderKL', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EncodedGenerationResult', 'EncodedResults', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'InpaintingPipeline', 'LLMPipeline', 'MeanStdPair', 'PerfMetrics', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'SD3Transformer2DModel', 'Scheduler', 'SchedulerConfig', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'T5EncoderModel', 'Text2ImagePipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'draft_model', 'get_version']
+__all__ = ['Adapter', 'AdapterConfig', 'AggregationMode', 'AutoencoderKL', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EncodedGenerationResult', 'EncodedResults', 'FluxTransformer2DModel', 'GenerationCompletionQueue', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'InpaintingPipeline', 'LLMPipeline', 'MeanStdPair', 'PerfMetrics', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'SD3Transformer2DModel', 'Scheduler', 'SchedulerConfig', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'StructuredOutputConfig', 'T5EncoderModel', 'Text2ImagePipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'draft_model', 'get_version']
 class Adapter:
     """
     Immutable LoRA Adapter that carries the adaptation matrices and serves as unique adapter identifier.
@@ -385,12 +386,18 @@ class ContinuousBatchingPipeline:
     def __init__(self, models_path: os.PathLike, tokenizer: Tokenizer, scheduler_config: SchedulerConfig, device: str, **kwargs) -> None:
         ...
     @typing.overload
+    def add_request(self, request_id: int, input_ids: numpy.ndarray[numpy.int64], generation_config: GenerationConfig) -> GenerationHandle:
+        ...
+    @typing.overload
     def add_request(self, request_id: int, input_ids: openvino._pyopenvino.Tensor, generation_config: GenerationConfig) -> GenerationHandle:
         ...
     @typing.overload
     def add_request(self, request_id: int, prompt: str, generation_config: GenerationConfig) -> GenerationHandle:
         ...
     @typing.overload
+    def generate(self, input_ids: list[numpy.ndarray[numpy.int64]], generation_config: list[GenerationConfig], streamer: typing.Callable[[str], int | None] | StreamerBase | None = None) -> list[EncodedGenerationResult]:
+        ...
+    @typing.overload
     def generate(self, input_ids: list[openvino._pyopenvino.Tensor], generation_config: list[GenerationConfig], streamer: typing.Callable[[str], int | None] | StreamerBase | None = None) -> list[EncodedGenerationResult]:
         ...
     @typing.overload
@@ -407,6 +414,8 @@ class ContinuousBatchingPipeline:
         ...
     def has_non_finished_requests(self) -> bool:
         ...
+    def set_completion_queue(self, completion_queue: GenerationCompletionQueue) -> None:
+        ...
     def step(self) -> None:
         ...
 class CppStdGenerator(Generator):
@@ -470,6 +479,10 @@ class EncodedGenerationResult:
     m_scores: list[float]
     def __init__(self) -> None:
         ...
+    def get_generation_ids_views(self) -> list:
+        """
+        Returns read-only NumPy arrays sharing memory with m_generation_ids. They keep the result alive, m_generation_ids can't be reassigned while they exist.
+        """
     @property
     def m_request_id(self) -> int:
         ...
@@ -490,6 +503,10 @@ class EncodedResults:
         scores: sum of logarithmic probabilities of all tokens in the sequence.
         metrics: performance metrics with tpot, ttft, etc. of type ov::genai::PerfMetrics.
     """
+    def get_tokens_views(self) -> list:
+        """
+        Returns read-only NumPy arrays sharing memory with tokens, they keep the results alive.
+        """
     @property
     def perf_metrics(self) -> PerfMetrics:
         ...
@@ -567,6 +584,8 @@ class GenerationConfig:
         logprobs:       number of top logprobs computed for each position, if set to 0, logprobs are not computed and value 0.0 is returned.
                         Currently only single top logprob can be returned, so any logprobs > 1 is treated as logprobs == 1. (default: 0).
         apply_chat_template: whether to apply chat_template for non-chat scenarios
+        structured_output_config: if set, generated text is constrained by JSON schema, regular expression or grammar.
+                                  Not supported by beam search.
     
         repetition_penalty: the parameter for repetition penalty. 1.0 means no penalty.
         presence_penalty: reduces absolute log prob if the token was generated at least once.
@@ -621,6 +640,7 @@ class GenerationConfig:
     stop_criteria: StopCriteria
     stop_strings: set[str]
     stop_token_ids: set[int]
+    structured_output_config: StructuredOutputConfig | None
     temperature: float
     top_k: int
     top_p: float
@@ -648,6 +668,24 @@ class GenerationConfig:
         ...
     def validate(self) -> None:
         ...
+class GenerationCompletionQueue:
+    """
+    Reports ids of requests whose GenerationHandle got new outputs or changed status.
+    """
+    def __init__(self) -> None:
+        ...
+    def get_fd(self) -> int:
+        """
+        File descriptor which is readable while there are ready requests. Linux only, -1 on other platforms.
+        """
+    def poll(self) -> list[int]:
+        """
+        Returns ids of ready requests without waiting.
+        """
+    def wait(self, timeout_ms: int) -> list[int]:
+        """
+        Waits until some requests are ready or timeout expires, returns ids of ready requests.
+        """
 class GenerationFinishReason:
     """
     Members:
@@ -701,6 +739,10 @@ class GenerationHandle:
         ...
     def read_all(self) -> list[GenerationOutput]:
         ...
+    def read_available(self) -> dict[int, GenerationOutput]:
+        ...
+    def set_completion_queue(self, completion_queue: GenerationCompletionQueue, request_id: int) -> None:
+        ...
     def stop(self) -> None:
         ...
 class GenerationOutput:
@@ -708,6 +750,10 @@ class GenerationOutput:
     generated_ids: list[int]
     generated_log_probs: list[float]
     score: float
+    def get_generated_ids_view(self) -> numpy.ndarray[numpy.int64]:
+        """
+        Returns read-only NumPy array sharing memory with generated_ids. It keeps the output alive, generated_ids can't be reassigned while it exists.
+        """
 class GenerationResult:
     """
     
@@ -1091,12 +1137,12 @@ class LLMPipeline:
     """
     This class is used for generation with LLMs
     """
-    def __call__(self, inputs: openvino._pyopenvino.Tensor | TokenizedInputs | str | list[str], generation_config: GenerationConfig | None = None, streamer: typing.Callable[[str], int | None] | StreamerBase | None = None, **kwargs) -> EncodedResults | DecodedResults:
+    def __call__(self, inputs: numpy.ndarray[numpy.int64] | openvino._pyopenvino.Tensor | TokenizedInputs | str | list[str], generation_config: GenerationConfig | None = None, streamer: typing.Callable[[str], int | None] | StreamerBase | None = None, **kwargs) -> EncodedResults | DecodedResults:
         """
             Generates sequences or tokens for LLMs. If input is a string or list of strings then resulting sequences will be already detokenized.
         
             :param inputs: inputs in the form of string, list of strings or tokenized input_ids
-            :type inputs: str, List[str], ov.genai.TokenizedInputs, or ov.Tensor
+            :type inputs: str, List[str], ov.genai.TokenizedInputs, ov.Tensor or numpy.ndarray of integer token ids
         
             :param generation_config: generation_config
             :type generation_config: GenerationConfig or a Dict
@@ -1177,12 +1223,12 @@ class LLMPipeline:
         """
     def finish_chat(self) -> None:
         ...
-    def generate(self, inputs: openvino._pyopenvino.Tensor | TokenizedInputs | str | list[str], generation_config: GenerationConfig | None = None, streamer: typing.Callable[[str], int | None] | StreamerBase | None = None, **kwargs) -> EncodedResults | DecodedResults:
+    def generate(self, inputs: numpy.ndarray[numpy.int64] | openvino._pyopenvino.Tensor | TokenizedInputs | str | list[str], generation_config: GenerationConfig | None = None, streamer: typing.Callable[[str], int | None] | StreamerBase | None = None, **kwargs) -> EncodedResults | DecodedResults:
         """
             Generates sequences or tokens for LLMs. If input is a string or list of strings then resulting sequences will be already detokenized.
         
             :param inputs: inputs in the form of string, list of strings or tokenized input_ids
-            :type inputs: str, List[str], ov.genai.TokenizedInputs, or ov.Tensor
+            :type inputs: str, List[str], ov.genai.TokenizedInputs, ov.Tensor or numpy.ndarray of integer token ids
         
             :param generation_config: generation_config
             :type generation_config: GenerationConfig or a Dict
@@ -1364,6 +1410,12 @@ class PipelineMetrics:
     
         :param avg_cache_usage: Running average of the KV cache usage (in %) during the lifetime of the pipeline, with max window size of 1000 steps
         :type avg_cache_usage: float
+    
+        :param cancelled_requests: Number of requests stopped or cancelled via their handles, which were released before the next generation step.
+        :type cancelled_requests: int
+    
+        :param cancelled_tokens_saved: Number of tokens which were not computed because their requests were stopped or cancelled via handles.
+        :type cancelled_tokens_saved: int
     """
     def __init__(self) -> None:
         ...
@@ -1374,6 +1426,12 @@ class PipelineMetrics:
     def cache_usage(self) -> float:
         ...
     @property
+    def cancelled_requests(self) -> int:
+        ...
+    @property
+    def cancelled_tokens_saved(self) -> int:
+        ...
+    @property
     def max_cache_usage(self) -> float:
         ...
     @property
@@ -1719,6 +1777,26 @@ class StreamingStatus:
     @property
     def value(self) -> int:
         ...
+class StructuredOutputConfig:
+    """
+    
+        Structure to keep parameters of structured output generation. Generated text is constrained to match
+        exactly one of the following descriptions:
+        json_schema: JSON schema of the generated JSON document.
+        regex:       regular expression which generated text must fully match.
+        grammar:     EBNF grammar in GBNF notation with `root` start rule. Recursive rules are not supported.
+    """
+    grammar: str | None
+    json_schema: str | None
+    regex: str | None
+    @typing.overload
+    def __init__(self) -> None:
+        ...
+    @typing.overload
+    def __init__(self, **kwargs) -> None:
+        ...
+    def validate(self) -> None:
+        ...
 class T5EncoderModel:
     """
     T5EncoderModel class.
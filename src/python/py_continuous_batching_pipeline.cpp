@@ -110,6 +110,12 @@ auto pipeline_metrics_docstring = R"(
 
     :param avg_cache_usage: Running average of the KV cache usage (in %) during the lifetime of the pipeline, with max window size of 1000 steps
     :type avg_cache_usage: float
+
+    :param cancelled_requests: Number of requests stopped or cancelled via their handles, which were released before the next generation step.
+    :type cancelled_requests: int
+
+    :param cancelled_tokens_saved: Number of tokens which were not computed because their requests were stopped or cancelled via handles.
+    :type cancelled_tokens_saved: int
 )";
 
 std::ostream& operator << (std::ostream& stream, const GenerationResult& generation_result) {
@@ -191,9 +197,21 @@ void init_continuous_batching_pipeline(py::module_& m) {
     py::class_<EncodedGenerationResult>(m, "EncodedGenerationResult", generation_result_docstring)
         .def(py::init<>())
         .def_readonly("m_request_id", &EncodedGenerationResult::m_request_id)
-        .def_readwrite("m_generation_ids", &EncodedGenerationResult::m_generation_ids)
+        .def_property("m_generation_ids",
+            [](const EncodedGenerationResult& r) {
+                return r.m_generation_ids;
+            },
+            [](EncodedGenerationResult& r, std::vector<std::vector<int64_t>> generation_ids) {
+                pyutils::assert_no_token_ids_views(&r.m_generation_ids, "m_generation_ids");
+                r.m_generation_ids = std::move(generation_ids);
+            })
         .def_readwrite("m_scores", &EncodedGenerationResult::m_scores)
-        .def_readonly("perf_metrics", &EncodedGenerationResult::perf_metrics);
+        .def_readonly("perf_metrics", &EncodedGenerationResult::perf_metrics)
+        .def("get_generation_ids_views",
+            [](py::object self) {
+                return pyutils::token_ids_views(self.cast<const EncodedGenerationResult&>().m_generation_ids, self);
+            },
+            "Returns read-only NumPy arrays sharing memory with m_generation_ids. They keep the result alive, m_generation_ids can't be reassigned while they exist.");
 
     py::enum_<ov::genai::GenerationFinishReason>(m, "GenerationFinishReason")
         .value("NONE", ov::genai::GenerationFinishReason::NONE)
@@ -201,10 +219,22 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .value("LENGTH", ov::genai::GenerationFinishReason::LENGTH);
 
     py::class_<GenerationOutput, std::shared_ptr<GenerationOutput>>(m, "GenerationOutput")
-        .def_readwrite("generated_ids", &GenerationOutput::generated_ids)
+        .def_property("generated_ids",
+            [](const GenerationOutput& output) {
+                return output.generated_ids;
+            },
+            [](GenerationOutput& output, std::vector<int64_t> generated_ids) {
+                pyutils::assert_no_token_ids_views(&output.generated_ids, "generated_ids");
+                output.generated_ids = std::move(generated_ids);
+            })
         .def_readwrite("generated_log_probs", &GenerationOutput::generated_log_probs)
         .def_readwrite("score", &GenerationOutput::score)
-        .def_readwrite("finish_reason", &GenerationOutput::finish_reason);
+        .def_readwrite("finish_reason", &GenerationOutput::finish_reason)
+        .def("get_generated_ids_view",
+            [](py::object self) {
+                return pyutils::token_ids_view(self.cast<const GenerationOutput&>().generated_ids, self);
+            },
+            "Returns read-only NumPy array sharing memory with generated_ids. It keeps the output alive, generated_ids can't be reassigned while it exists.");
 
     py::class_<GenerationHandleImpl, std::shared_ptr<GenerationHandleImpl>>(m, "GenerationHandle")
         .def("get_status", &GenerationHandleImpl::get_status)
@@ -213,7 +243,22 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def("stop", &GenerationHandleImpl::stop)
         .def("cancel", &GenerationHandleImpl::cancel)
         .def("read", &GenerationHandleImpl::read)
-        .def("read_all", &GenerationHandleImpl::read_all);
+        .def("read_all", &GenerationHandleImpl::read_all)
+        .def("read_available", &GenerationHandleImpl::read_available)
+        .def("set_completion_queue", &GenerationHandleImpl::set_completion_queue, py::arg("completion_queue"), py::arg("request_id"));
+
+    py::class_<GenerationCompletionQueue, std::shared_ptr<GenerationCompletionQueue>>(m, "GenerationCompletionQueue",
+        "Reports ids of requests whose GenerationHandle got new outputs or changed status.")
+        .def(py::init<>())
+        .def("wait", [](GenerationCompletionQueue& self, size_t timeout_ms) {
+                return self.wait(std::chrono::milliseconds(timeout_ms));
+            },
+            py::arg("timeout_ms"),
+            py::call_guard<py::gil_scoped_release>(),
+            "Waits until some requests are ready or timeout expires, returns ids of ready requests.")
+        .def("poll", &GenerationCompletionQueue::poll, "Returns ids of ready requests without waiting.")
+        .def("get_fd", &GenerationCompletionQueue::get_fd,
+            "File descriptor which is readable while there are ready requests. Linux only, -1 on other platforms.");
 
     // Binding for StopCriteria
     py::enum_<AggregationMode>(m, "AggregationMode",
@@ -251,7 +296,9 @@ void init_continuous_batching_pipeline(py::module_& m) {
             .def_readonly("scheduled_requests", &PipelineMetrics::scheduled_requests)
             .def_readonly("cache_usage", &PipelineMetrics::cache_usage)
             .def_readonly("avg_cache_usage", &PipelineMetrics::avg_cache_usage)
-            .def_readonly("max_cache_usage", &PipelineMetrics::max_cache_usage);
+            .def_readonly("max_cache_usage", &PipelineMetrics::max_cache_usage)
+            .def_readonly("cancelled_requests", &PipelineMetrics::cancelled_requests)
+            .def_readonly("cancelled_tokens_saved", &PipelineMetrics::cancelled_tokens_saved);
 
     py::class_<ContinuousBatchingPipeline>(m, "ContinuousBatchingPipeline", "This class is used for generation with LLMs with continuous batchig")
         .def(py::init([](const std::filesystem::path& models_path, const SchedulerConfig& scheduler_config, const std::string& device, const std::map<std::string, py::object>& llm_plugin_config, const std::map<std::string, py::object>& tokenizer_plugin_config) {
@@ -276,12 +323,41 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def("get_tokenizer", &ContinuousBatchingPipeline::get_tokenizer)
         .def("get_config", &ContinuousBatchingPipeline::get_config)
         .def("get_metrics", &ContinuousBatchingPipeline::get_metrics)
+        // NumPy overloads go first: overloads are tried in order when arguments need conversion, so integer arrays of
+        // other dtypes and lists of ints are converted to int64 arrays instead of implicitly converted ov.Tensor
+        .def("add_request",
+            [](ContinuousBatchingPipeline& pipe, uint64_t request_id, const pyutils::TokenIdsArray& input_ids, const ov::genai::GenerationConfig& generation_config) {
+                // prompt is copied to the request, so the array is not referenced after the call
+                return pipe.add_request(request_id, pyutils::token_ids_to_tensor(input_ids), generation_config);
+            },
+            py::arg("request_id"), py::arg("input_ids"), py::arg("generation_config"))
         .def("add_request", py::overload_cast<uint64_t, const ov::Tensor&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("input_ids"), py::arg("generation_config"))
         .def("add_request", py::overload_cast<uint64_t, const std::string&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("prompt"), py::arg("generation_config"))
+        .def("set_completion_queue", &ContinuousBatchingPipeline::set_completion_queue, py::arg("completion_queue"))
         .def("step", &ContinuousBatchingPipeline::step)
         .def("has_non_finished_requests", &ContinuousBatchingPipeline::has_non_finished_requests)
 
 
+        // NumPy overload goes before ov.Tensor one, see add_request
+        .def(
+            "generate",
+            [](ContinuousBatchingPipeline& pipe,
+               const std::vector<pyutils::TokenIdsArray>& input_ids,
+               const std::vector<ov::genai::GenerationConfig>& generation_config,
+               const pyutils::PyBindStreamerVariant& streamer
+            ) -> py::typing::Union<std::vector<ov::genai::EncodedGenerationResult>> {
+                // tensors share memory with the arrays, which are kept alive by the call arguments
+                std::vector<ov::Tensor> input_tensors;
+                input_tensors.reserve(input_ids.size());
+                for (const auto& request_input_ids : input_ids)
+                    input_tensors.push_back(pyutils::token_ids_to_tensor(request_input_ids));
+                return __call_cb_generate(pipe, input_tensors, generation_config, streamer);
+            },
+            py::arg("input_ids"),
+            py::arg("generation_config"),
+            py::arg("streamer") = std::monostate{}
+        )
+
         .def(
             "generate",
             [](ContinuousBatchingPipeline& pipe,
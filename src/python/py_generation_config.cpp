@@ -14,6 +14,7 @@ namespace py = pybind11;
 namespace pyutils = ov::genai::pybind::utils;
 
 using ov::genai::StopCriteria;
+using ov::genai::StructuredOutputConfig;
 using ov::genai::GenerationConfig;
 
 namespace {
@@ -27,6 +28,14 @@ auto stop_criteria_docstring =  R"(
         "openvino_genai.StopCriteria.NEVER" stops when there cannot be better candidates.
 )";
 
+auto structured_output_config_docstring = R"(
+    Structure to keep parameters of structured output generation. Generated text is constrained to match
+    exactly one of the following descriptions:
+    json_schema: JSON schema of the generated JSON document.
+    regex:       regular expression which generated text must fully match.
+    grammar:     EBNF grammar in GBNF notation with `root` start rule. Recursive rules are not supported.
+)";
+
 } // namespace
 
 char generation_config_docstring[] = R"(
@@ -48,6 +57,8 @@ char generation_config_docstring[] = R"(
     logprobs:       number of top logprobs computed for each position, if set to 0, logprobs are not computed and value 0.0 is returned.
                     Currently only single top logprob can be returned, so any logprobs > 1 is treated as logprobs == 1. (default: 0).
     apply_chat_template: whether to apply chat_template for non-chat scenarios
+    structured_output_config: if set, generated text is constrained by JSON schema, regular expression or grammar.
+                              Not supported by beam search.
 
     repetition_penalty: the parameter for repetition penalty. 1.0 means no penalty.
     presence_penalty: reduces absolute log prob if the token was generated at least once.
@@ -83,6 +94,30 @@ void init_generation_config(py::module_& m) {
         .value("HEURISTIC", StopCriteria::HEURISTIC)
         .value("NEVER", StopCriteria::NEVER);
 
+    // Binding for StructuredOutputConfig
+    py::class_<StructuredOutputConfig>(m, "StructuredOutputConfig", structured_output_config_docstring)
+        .def(py::init<>())
+        .def(py::init([](py::kwargs kwargs) {
+            StructuredOutputConfig config;
+            for (const auto& [key, value] : kwargs) {
+                const std::string name = py::cast<std::string>(key);
+                if (name == "json_schema") {
+                    config.json_schema = py::cast<std::optional<std::string>>(value);
+                } else if (name == "regex") {
+                    config.regex = py::cast<std::optional<std::string>>(value);
+                } else if (name == "grammar") {
+                    config.grammar = py::cast<std::optional<std::string>>(value);
+                } else {
+                    throw py::type_error("Unknown StructuredOutputConfig parameter: " + name);
+                }
+            }
+            return config;
+        }))
+        .def_readwrite("json_schema", &StructuredOutputConfig::json_schema)
+        .def_readwrite("regex", &StructuredOutputConfig::regex)
+        .def_readwrite("grammar", &StructuredOutputConfig::grammar)
+        .def("validate", &StructuredOutputConfig::validate);
+
      // Binding for GenerationConfig
     py::class_<GenerationConfig>(m, "GenerationConfig", generation_config_docstring)
         .def(py::init<std::filesystem::path>(), py::arg("json_path"), "path where generation_config.json is stored")
@@ -117,6 +152,7 @@ void init_generation_config(py::module_& m) {
         .def_readwrite("stop_token_ids", &GenerationConfig::stop_token_ids)
         .def_readwrite("adapters", &GenerationConfig::adapters)
         .def_readwrite("apply_chat_template", &GenerationConfig::apply_chat_template)
+        .def_readwrite("structured_output_config", &GenerationConfig::structured_output_config)
         .def("set_eos_token_id", &GenerationConfig::set_eos_token_id, py::arg("tokenizer_eos_token_id"))
         .def("is_beam_search", &GenerationConfig::is_beam_search)
         .def("is_greedy_decoding", &GenerationConfig::is_greedy_decoding)
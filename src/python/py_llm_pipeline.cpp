@@ -27,11 +27,15 @@ using ov::genai::draft_model;
 
 namespace {
 
+// NumPy array goes first: alternatives are tried in order when inputs need conversion, so integer arrays of other
+// dtypes and lists of ints are converted to int64 arrays instead of implicitly converted ov.Tensor
+using GenerateInputs = std::variant<pyutils::TokenIdsArray, ov::Tensor, TokenizedInputs, std::string, std::vector<std::string>>;
+
 auto generate_docstring = R"(
     Generates sequences or tokens for LLMs. If input is a string or list of strings then resulting sequences will be already detokenized.
 
     :param inputs: inputs in the form of string, list of strings or tokenized input_ids
-    :type inputs: str, List[str], ov.genai.TokenizedInputs, or ov.Tensor
+    :type inputs: str, List[str], ov.genai.TokenizedInputs, ov.Tensor or numpy.ndarray of integer token ids
 
     :param generation_config: generation_config
     :type generation_config: GenerationConfig or a Dict
@@ -48,7 +52,7 @@ auto generate_docstring = R"(
 
 py::object call_common_generate(
     LLMPipeline& pipe,
-    const std::variant<ov::Tensor, TokenizedInputs, std::string, std::vector<std::string>>& inputs,
+    const GenerateInputs& inputs,
     const OptionalGenerationConfig& config,
     const pyutils::PyBindStreamerVariant& py_streamer,
     const py::kwargs& kwargs
@@ -69,6 +73,16 @@ py::object call_common_generate(
         }
         results = py::cast(encoded_results);
     },
+    [&](const pyutils::TokenIdsArray& token_ids) {
+        // tensor shares memory with the array, which is kept alive by the call arguments
+        ov::Tensor input_ids = pyutils::token_ids_to_tensor(token_ids);
+        ov::genai::EncodedResults encoded_results;
+        {
+            py::gil_scoped_release rel;
+            encoded_results = pipe.generate(input_ids, updated_config, streamer);
+        }
+        results = py::cast(encoded_results);
+    },
     [&](TokenizedInputs tokenized_input) {
         ov::genai::EncodedResults encoded_results;
         {
@@ -173,7 +187,7 @@ void init_llm_pipeline(py::module_& m) {
         .def(
             "generate",
             [](LLMPipeline& pipe,
-                const std::variant<ov::Tensor, TokenizedInputs, std::string, std::vector<std::string>>& inputs,
+                const GenerateInputs& inputs,
                 const OptionalGenerationConfig& generation_config,
                 const pyutils::PyBindStreamerVariant& streamer,
                 const py::kwargs& kwargs
@@ -189,7 +203,7 @@ void init_llm_pipeline(py::module_& m) {
         .def(
             "__call__",
             [](LLMPipeline& pipe,
-                const std::variant<ov::Tensor, TokenizedInputs, std::string, std::vector<std::string>>& inputs,
+                const GenerateInputs& inputs,
                 const OptionalGenerationConfig& generation_config,
                 const pyutils::PyBindStreamerVariant& streamer,
                 const py::kwargs& kwargs
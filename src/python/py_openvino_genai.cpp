@@ -99,7 +99,12 @@ PYBIND11_MODULE(py_openvino_genai, m) {
     py::class_<EncodedResults>(m, "EncodedResults", encoded_results_docstring)
         .def_readonly("tokens", &EncodedResults::tokens)
         .def_readonly("scores", &EncodedResults::scores)
-        .def_readonly("perf_metrics", &EncodedResults::perf_metrics);
+        .def_readonly("perf_metrics", &EncodedResults::perf_metrics)
+        .def("get_tokens_views",
+            [](py::object self) {
+                return pyutils::token_ids_views(self.cast<const EncodedResults&>().tokens, self);
+            },
+            "Returns read-only NumPy arrays sharing memory with tokens, they keep the results alive.");
     
     init_tokenizer(m);
     init_streamers(m);
@@ -9,6 +9,8 @@
 #include <pybind11/stl/filesystem.h>
 #include <pybind11/functional.h>
 
+#include <unordered_map>
+
 #include <openvino/runtime/auto/properties.hpp>
 
 #include "tokenizers_path.hpp"
@@ -40,6 +42,33 @@ py::list handle_utf8(const std::vector<std::string>& decoded_res) {
 
 namespace {
 
+// Number of alive NumPy views of every token ids field, accessed with GIL held
+std::unordered_map<const void*, size_t>& get_token_ids_views_count() {
+    static std::unordered_map<const void*, size_t> views_count;
+    return views_count;
+}
+
+// Base object of a token ids view: keeps owner of the field alive and counts views of the field
+struct TokenIdsViewBase {
+    py::object owner;
+    const void* field;
+};
+
+py::array_t<int64_t> make_token_ids_view(const std::vector<int64_t>& token_ids, py::handle owner, const void* field) {
+    py::capsule base(new TokenIdsViewBase{py::reinterpret_borrow<py::object>(owner), field}, [](void* ptr) {
+        auto base = static_cast<TokenIdsViewBase*>(ptr);
+        auto& views_count = get_token_ids_views_count();
+        if (--views_count[base->field] == 0)
+            views_count.erase(base->field);
+        delete base;
+    });
+    ++get_token_ids_views_count()[field];
+
+    py::array_t<int64_t> view({token_ids.size()}, {sizeof(int64_t)}, token_ids.data(), base);
+    py::detail::array_proxy(view.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+    return view;
+}
+
 bool py_object_is_any_map(const py::object& py_obj) {
     if (!py::isinstance<py::dict>(py_obj)) {
         return false;
@@ -256,6 +285,8 @@ ov::Any py_object_to_any(const py::object& py_obj, std::string property_name) {
         return py::cast<ov::genai::ImageGenerationConfig>(py_obj);
     } else if (py::isinstance<ov::genai::WhisperGenerationConfig>(py_obj)) {
         return py::cast<ov::genai::WhisperGenerationConfig>(py_obj);
+    } else if (py::isinstance<ov::genai::StructuredOutputConfig>(py_obj)) {
+        return py::cast<ov::genai::StructuredOutputConfig>(py_obj);
     } else if (py::isinstance<ov::genai::StopCriteria>(py_obj)) {
         return py::cast<ov::genai::StopCriteria>(py_obj);
     } else if (py::isinstance<ov::genai::Generator>(py_obj)) {
@@ -271,6 +302,31 @@ ov::Any py_object_to_any(const py::object& py_obj, std::string property_name) {
 
 } // namespace
 
+ov::Tensor token_ids_to_tensor(const TokenIdsArray& token_ids) {
+    OPENVINO_ASSERT(token_ids.ndim() == 1 || token_ids.ndim() == 2, "Token ids array must be 1D or 2D, got ", token_ids.ndim(), "D");
+    ov::Shape shape{1, static_cast<size_t>(token_ids.shape(0))};
+    if (token_ids.ndim() == 2)
+        shape = {static_cast<size_t>(token_ids.shape(0)), static_cast<size_t>(token_ids.shape(1))};
+    // tensor is only read by pipelines
+    return ov::Tensor(ov::element::i64, shape, const_cast<int64_t*>(token_ids.data()));
+}
+
+py::array_t<int64_t> token_ids_view(const std::vector<int64_t>& token_ids, py::handle owner) {
+    return make_token_ids_view(token_ids, owner, &token_ids);
+}
+
+py::list token_ids_views(const std::vector<std::vector<int64_t>>& token_ids, py::handle owner) {
+    py::list views;
+    for (const auto& sequence_token_ids : token_ids)
+        views.append(make_token_ids_view(sequence_token_ids, owner, &token_ids));
+    return views;
+}
+
+void assert_no_token_ids_views(const void* field, const std::string& field_name) {
+    OPENVINO_ASSERT(get_token_ids_views_count().count(field) == 0,
+        field_name, " can't be reassigned while NumPy views of it exist, they share memory with it");
+}
+
 ov::AnyMap properties_to_any_map(const std::map<std::string, py::object>& properties) {
     ov::AnyMap properties_to_cpp;
     for (const auto& property : properties) {
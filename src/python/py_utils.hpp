@@ -4,6 +4,7 @@
 #define PYBIND11_DETAILED_ERROR_MESSAGES
 
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
 
@@ -19,6 +20,9 @@ namespace ov::genai::pybind::utils {
 // Therefore strings decoding should be handled with PyUnicode_DecodeUTF8(..., "replace") to not throw errors.
 using PyBindStreamerVariant = std::variant<std::function<std::optional<uint16_t>(std::string)>, std::shared_ptr<StreamerBase>, std::monostate>;
 
+// Token ids passed from Python as NumPy array, C-contiguous int64 arrays are used without copying
+using TokenIdsArray = py::array_t<int64_t, py::array::c_style | py::array::forcecast>;
+
 template <class... Ts>
 struct overloaded : Ts... {
     using Ts::operator()...;
@@ -30,6 +34,19 @@ py::list handle_utf8(const std::vector<std::string>& decoded_res);
 
 py::str handle_utf8(const std::string& text);
 
+// Tensor sharing memory with the array, the array must outlive the tensor. 1D array is treated as a batch of one prompt.
+ov::Tensor token_ids_to_tensor(const TokenIdsArray& token_ids);
+
+// Read-only array sharing memory with `token_ids`, `owner` is kept alive while the array exists.
+// Setters of `token_ids` field of `owner` have to call assert_no_token_ids_views, since reassignment frees the memory.
+py::array_t<int64_t> token_ids_view(const std::vector<int64_t>& token_ids, py::handle owner);
+
+// Read-only arrays sharing memory with every sequence of `token_ids`, views of the field are counted as views of `token_ids`
+py::list token_ids_views(const std::vector<std::vector<int64_t>>& token_ids, py::handle owner);
+
+// Throws if token ids `field` has alive views returned by token_ids_view or token_ids_views
+void assert_no_token_ids_views(const void* field, const std::string& field_name);
+
 ov::AnyMap properties_to_any_map(const std::map<std::string, py::object>& properties);
 
 ov::AnyMap kwargs_to_any_map(const py::kwargs& kwargs);
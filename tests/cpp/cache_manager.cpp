@@ -2,6 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <numeric>
+
 #include <gtest/gtest.h>
 #include "openvino/runtime/core.hpp"
 #include "scheduler.hpp"
@@ -108,3 +113,135 @@ TEST(TestCacheManager, test_dynamic_cache_increase) {
     cache_manager->allocate_cache_if_needed(block_manager.get_total_number_of_kv_blocks());
     ASSERT_EQ(get_total_allocated_bytes(cache_manager), 200 * block_size_in_bytes);
 }
+
+
+TEST(TestCacheManager, test_export_import_blocks) {
+    ov::Core core;
+    const size_t num_decoder_layers = 2;
+    const std::vector<KVHeadConfig> kv_cache_config(num_decoder_layers, KVHeadConfig { 2, 2, 8, 8 });
+
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    auto cache_manager = std::make_shared<CacheManager>(request, kv_cache_config);
+    cache_manager->allocate_cache_if_needed(4);
+
+    // fill each byte of the cache with the index of its block
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+        for (ov::Tensor cache : {cache_manager->get_key_cache(layer_idx), cache_manager->get_value_cache(layer_idx)}) {
+            size_t block_byte_size = cache.get_byte_size() / cache.get_shape()[0];
+            auto data = static_cast<uint8_t*>(cache.data());
+            for (size_t byte_idx = 0; byte_idx < cache.get_byte_size(); byte_idx++) {
+                data[byte_idx] = static_cast<uint8_t>(byte_idx / block_byte_size);
+            }
+        }
+    }
+
+    std::vector<std::pair<ov::Tensor, ov::Tensor>> exported;
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+        exported.push_back(cache_manager->export_blocks(layer_idx, {2, 1}));
+        ASSERT_EQ(exported.back().first.get_shape()[0], 2);
+        ASSERT_EQ(exported.back().second.get_shape()[0], 2);
+    }
+
+    // blocks 2 and 1 are written to blocks 0 and 3 respectively
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+        cache_manager->import_blocks(layer_idx, {0, 3}, exported[layer_idx].first, exported[layer_idx].second);
+    }
+
+    const std::vector<uint8_t> expected_block_content = {2, 1, 2, 1};
+    for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+        for (ov::Tensor cache : {cache_manager->get_key_cache(layer_idx), cache_manager->get_value_cache(layer_idx)}) {
+            size_t block_byte_size = cache.get_byte_size() / cache.get_shape()[0];
+            auto data = static_cast<uint8_t*>(cache.data());
+            for (size_t byte_idx = 0; byte_idx < cache.get_byte_size(); byte_idx++) {
+                ASSERT_EQ(data[byte_idx], expected_block_content[byte_idx / block_byte_size]);
+            }
+        }
+    }
+}
+
+
+TEST(TestCacheManager, test_export_import_blocks_round_trip_on_available_devices) {
+    ov::Core core;
+    const size_t num_decoder_layers = 2;
+    const std::vector<KVHeadConfig> kv_cache_config(num_decoder_layers, KVHeadConfig { 2, 2, 8, 8 });
+
+    const std::vector<std::string> available_devices = core.get_available_devices();
+    for (const std::string device : {"CPU", "GPU"}) {
+        if (std::find(available_devices.begin(), available_devices.end(), device) == available_devices.end())
+            continue;
+        // KV cache on GPU is allocated as remote tensors, so blocks are written from and read to host memory
+        ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers), device).create_infer_request();
+        auto cache_manager = std::make_shared<CacheManager>(request, kv_cache_config);
+        cache_manager->allocate_cache_if_needed(4);
+
+        for (size_t layer_idx = 0; layer_idx < num_decoder_layers; layer_idx++) {
+            // exported blocks have the layout of the device cache
+            auto [key_blocks, value_blocks] = cache_manager->export_blocks(layer_idx, {0, 1});
+            for (ov::Tensor blocks : {key_blocks, value_blocks}) {
+                size_t block_byte_size = blocks.get_byte_size() / blocks.get_shape()[0];
+                auto data = static_cast<uint8_t*>(blocks.data());
+                for (size_t byte_idx = 0; byte_idx < blocks.get_byte_size(); byte_idx++) {
+                    data[byte_idx] = static_cast<uint8_t>(byte_idx / block_byte_size + 10 * layer_idx + 1);
+                }
+            }
+            cache_manager->import_blocks(layer_idx, {3, 1}, key_blocks, value_blocks);
+
+            auto [key_reexported, value_reexported] = cache_manager->export_blocks(layer_idx, {3, 1});
+            ASSERT_EQ(std::memcmp(key_reexported.data(), key_blocks.data(), key_blocks.get_byte_size()), 0) << device;
+            ASSERT_EQ(std::memcmp(value_reexported.data(), value_blocks.data(), value_blocks.get_byte_size()), 0) << device;
+        }
+    }
+}
+
+
+TEST(TestCacheManager, test_import_blocks_validation) {
+    ov::Core core;
+    const size_t num_decoder_layers = 1;
+    const std::vector<KVHeadConfig> kv_cache_config(num_decoder_layers, KVHeadConfig { 2, 2, 8, 8 });
+
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    auto cache_manager = std::make_shared<CacheManager>(request, kv_cache_config);
+    cache_manager->allocate_cache_if_needed(4);
+
+    auto [key_blocks, value_blocks] = cache_manager->export_blocks(0, {0, 1});
+    EXPECT_THROW(cache_manager->export_blocks(0, {4}), ov::Exception);
+    EXPECT_THROW(cache_manager->import_blocks(0, {4}, key_blocks, value_blocks), ov::Exception);
+    // more blocks than stored in tensors
+    EXPECT_THROW(cache_manager->import_blocks(0, {0, 1, 2}, key_blocks, value_blocks), ov::Exception);
+
+    const ov::element::Type other_precision = key_blocks.get_element_type() == ov::element::f32 ? ov::element::f16 : ov::element::f32;
+    ov::Tensor other_precision_blocks(other_precision, key_blocks.get_shape());
+    EXPECT_THROW(cache_manager->import_blocks(0, {0}, other_precision_blocks, value_blocks), ov::Exception);
+}
+
+
+TEST(TestCacheManager, test_kv_cache_snapshot_save_load) {
+    KVCacheSnapshot snapshot;
+    snapshot.block_size = 4;
+    snapshot.token_ids = {1, 2, 3, 4, 5};
+    for (size_t layer_idx = 0; layer_idx < 2; layer_idx++) {
+        ov::Tensor key(ov::element::f32, {2, 1, 4, 3}), value(ov::element::f16, {2, 1, 4, 3});
+        std::iota(key.data<float>(), key.data<float>() + key.get_size(), static_cast<float>(layer_idx));
+        std::memset(value.data(), static_cast<int>(layer_idx) + 7, value.get_byte_size());
+        snapshot.key_cache.push_back(key);
+        snapshot.value_cache.push_back(value);
+    }
+
+    auto path = std::filesystem::temp_directory_path() / "test_kv_cache_snapshot.bin";
+    snapshot.save(path);
+    KVCacheSnapshot loaded = KVCacheSnapshot::load(path);
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(loaded.block_size, snapshot.block_size);
+    ASSERT_EQ(loaded.token_ids, snapshot.token_ids);
+    ASSERT_EQ(loaded.key_cache.size(), snapshot.key_cache.size());
+    ASSERT_EQ(loaded.value_cache.size(), snapshot.value_cache.size());
+    for (size_t layer_idx = 0; layer_idx < snapshot.key_cache.size(); layer_idx++) {
+        for (auto [expected, actual] : {std::make_pair(snapshot.key_cache[layer_idx], loaded.key_cache[layer_idx]),
+                                        std::make_pair(snapshot.value_cache[layer_idx], loaded.value_cache[layer_idx])}) {
+            ASSERT_EQ(actual.get_element_type(), expected.get_element_type());
+            ASSERT_EQ(actual.get_shape(), expected.get_shape());
+            ASSERT_EQ(std::memcmp(actual.data(), expected.data(), expected.get_byte_size()), 0);
+        }
+    }
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include "circular_buffer_queue.hpp"
+
+using namespace ov::genai;
+
+TEST(CircularBufferQueue, creates_elements_and_reuses_last_returned_one) {
+    size_t num_created = 0;
+    CircularBufferQueue<size_t> queue(3, [&num_created]() { return num_created++; });
+    ASSERT_EQ(queue.size(), 3);
+    ASSERT_EQ(num_created, 3);
+
+    int first = queue.get_idle(), second = queue.get_idle();
+    EXPECT_EQ(queue.get(first), 0);
+    EXPECT_EQ(queue.get(second), 1);
+    queue.return_to(first);
+    queue.return_to(second);
+    // the most recently used element is taken first
+    EXPECT_EQ(queue.get_idle(), second);
+}
+
+TEST(CircularBufferQueue, hands_out_every_element_exclusively_under_contention) {
+    const size_t num_elements = 3, num_threads = 16, num_iterations = 1000;
+    CircularBufferQueue<std::atomic<size_t>*> queue(num_elements, []() { return new std::atomic<size_t>(0); });
+    std::atomic<size_t> num_acquired{0}, max_acquired{0};
+
+    std::vector<std::thread> threads;
+    for (size_t thread_id = 0; thread_id < num_threads; ++thread_id) {
+        threads.emplace_back([&]() {
+            for (size_t i = 0; i < num_iterations; ++i) {
+                CircularBufferQueueElementGuard<std::atomic<size_t>*> guard(&queue);
+                // the element is not used by any other thread
+                EXPECT_EQ(guard.get()->fetch_add(1), 0);
+                size_t acquired = ++num_acquired;
+                size_t max = max_acquired.load();
+                while (acquired > max && !max_acquired.compare_exchange_weak(max, acquired)) {}
+                std::this_thread::yield();
+                --num_acquired;
+                guard.get()->fetch_sub(1);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_LE(max_acquired.load(), num_elements);
+    // all elements are returned to the queue
+    std::vector<int> idle_values;
+    for (size_t i = 0; i < num_elements; ++i)
+        idle_values.push_back(queue.get_idle());
+    std::sort(idle_values.begin(), idle_values.end());
+    EXPECT_EQ(idle_values, std::vector<int>({0, 1, 2}));
+    for (int value : idle_values)
+        delete queue.get(value);
+}
+
+TEST(CircularBufferQueue, wakes_up_waiters_when_elements_are_returned) {
+    const size_t num_waiters = 4;
+    CircularBufferQueue<int> queue(1, []() { return 0; });
+    int value = queue.get_idle();
+
+    std::atomic<size_t> num_woken{0};
+    std::vector<std::future<void>> waiters;
+    for (size_t i = 0; i < num_waiters; ++i) {
+        waiters.push_back(std::async(std::launch::async, [&]() {
+            CircularBufferQueueElementGuard<int> guard(&queue);
+            ++num_woken;
+        }));
+    }
+    // all waiters are blocked while the only element is acquired
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(num_woken.load(), 0);
+
+    queue.return_to(value);
+    for (auto& waiter : waiters)
+        ASSERT_EQ(waiter.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    EXPECT_EQ(num_woken.load(), num_waiters);
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <numeric>
+#include <thread>
+
+#ifdef __linux__
+#include <poll.h>
+#endif
+
+#include "spsc_ring_buffer.hpp"
+#include "generation_stream.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+GenerationOutputs make_outputs(std::vector<int64_t> token_ids) {
+    GenerationOutput output;
+    output.generated_log_probs.resize(token_ids.size(), 0.0f);
+    output.generated_ids = std::move(token_ids);
+    output.score = 0.0f;
+    output.finish_reason = GenerationFinishReason::NONE;
+    return {{0, output}};
+}
+
+}  // namespace
+
+TEST(SPSCRingBuffer, reuses_slots_in_fifo_order) {
+    SPSCRingBuffer<std::vector<int>> ring(3);
+    EXPECT_EQ(ring.capacity(), 4u);
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(ring.try_push([i](std::vector<int>& slot) { slot.assign(1, i); }));
+    EXPECT_FALSE(ring.try_push([](std::vector<int>& slot) { FAIL() << "buffer is full"; }));
+
+    int value = -1;
+    EXPECT_TRUE(ring.try_pop([&value](std::vector<int>& slot) { value = slot.at(0); }));
+    EXPECT_EQ(value, 0);
+    // the freed slot keeps storage of the popped element
+    EXPECT_TRUE(ring.try_push([](std::vector<int>& slot) { EXPECT_GE(slot.capacity(), 1u); slot.assign(1, 4); }));
+    for (int expected = 1; expected <= 4; ++expected) {
+        EXPECT_TRUE(ring.try_pop([&value](std::vector<int>& slot) { value = slot.at(0); }));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(SPSCRingBuffer, preserves_order_across_threads) {
+    constexpr int num_values = 100000;
+    SPSCRingBuffer<int> ring(16);
+    std::thread producer([&ring]() {
+        for (int i = 0; i < num_values; ++i) {
+            while (!ring.try_push([i](int& slot) { slot = i; }))
+                std::this_thread::yield();
+        }
+    });
+    for (int expected = 0; expected < num_values; ++expected) {
+        int value = -1;
+        while (!ring.try_pop([&value](int& slot) { value = slot; }))
+            std::this_thread::yield();
+        ASSERT_EQ(value, expected);
+    }
+    producer.join();
+}
+
+TEST(GenerationStream, read_available_merges_steps_including_overflow) {
+    GenerationStream stream;
+    // more steps than ring capacity, the rest goes to overflow
+    constexpr int64_t num_steps = 100;
+    for (int64_t i = 0; i < num_steps; ++i)
+        stream.push(make_outputs({i}));
+    EXPECT_TRUE(stream.can_read());
+
+    GenerationOutputs outputs;
+    EXPECT_EQ(stream.read_available(outputs), static_cast<size_t>(num_steps));
+    ASSERT_EQ(outputs.size(), 1u);
+    std::vector<int64_t> expected(num_steps);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(outputs.at(0).generated_ids, expected);
+    EXPECT_FALSE(stream.can_read());
+
+    stream.push(make_outputs({num_steps}));
+    EXPECT_EQ(stream.read().at(0).generated_ids, std::vector<int64_t>{num_steps});
+}
+
+TEST(GenerationStream, read_waits_for_producer) {
+    GenerationStream stream;
+    constexpr int64_t num_steps = 1000;
+    std::thread producer([&stream]() {
+        for (int64_t i = 0; i < num_steps; ++i)
+            stream.push(make_outputs({i}));
+    });
+    for (int64_t i = 0; i < num_steps; ++i)
+        ASSERT_EQ(stream.read().at(0).generated_ids, std::vector<int64_t>{i});
+    producer.join();
+}
+
+TEST(GenerationCompletionQueue, reports_each_ready_request_once) {
+    auto completion_queue = std::make_shared<GenerationCompletionQueue>();
+    GenerationStream first, second;
+    first.set_completion_queue(completion_queue, 1);
+    second.set_completion_queue(completion_queue, 2);
+    EXPECT_TRUE(completion_queue->poll().empty());
+
+    first.push(make_outputs({0}));
+    first.push(make_outputs({1}));
+    second.set_generation_status(GenerationStatus::FINISHED);
+#ifdef __linux__
+    pollfd descriptor{completion_queue->get_fd(), POLLIN, 0};
+    EXPECT_EQ(::poll(&descriptor, 1, 0), 1);
+#endif
+    EXPECT_EQ(completion_queue->wait(std::chrono::milliseconds(0)), (std::vector<uint64_t>{1, 2}));
+#ifdef __linux__
+    EXPECT_EQ(::poll(&descriptor, 1, 0), 0);
+#endif
+
+    std::thread producer([&first]() {
+        first.push(make_outputs({2}));
+    });
+    EXPECT_EQ(completion_queue->wait(std::chrono::seconds(10)), std::vector<uint64_t>{1});
+    producer.join();
+}
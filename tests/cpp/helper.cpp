@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "helper.hpp"
+
+#include <cstdlib>
+
 #include "openvino/op/concat.hpp"
 
 std::shared_ptr<ov::Model> get_dummy_model(ov::Core core, size_t num_layers) {
@@ -25,3 +28,9 @@ std::shared_ptr<ov::Model> get_dummy_model(ov::Core core, size_t num_layers) {
     auto model = std::make_shared<ov::Model>(ov::NodeVector{concat1, concat2}, params);
     return std::make_shared<ov::Model>(ov::NodeVector{concat1, concat2}, params);
 }
+
+std::filesystem::path get_test_model_dir() {
+    const char* model_dir_env = std::getenv("OV_GENAI_TEST_MODEL_DIR");
+    std::filesystem::path model_dir = model_dir_env ? model_dir_env : "TinyLlama-1.1B-Chat-v1.0";
+    return std::filesystem::exists(model_dir / "openvino_tokenizer.xml") ? model_dir : std::filesystem::path{};
+}
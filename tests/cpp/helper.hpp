@@ -3,6 +3,15 @@
 
 #pragma once
 
+#include <filesystem>
+
 #include "openvino/runtime/core.hpp"
 
-std::shared_ptr<ov::Model> get_dummy_model(ov::Core core, size_t num_layers);
\ No newline at end of file
+std::shared_ptr<ov::Model> get_dummy_model(ov::Core core, size_t num_layers);
+
+/**
+ * Directory of a model exported by optimum-cli together with openvino_tokenizer.xml and openvino_detokenizer.xml.
+ * Taken from OV_GENAI_TEST_MODEL_DIR environment variable, TinyLlama-1.1B-Chat-v1.0 in the working directory by default.
+ * @return Empty path if the model is not found, tests requiring it are skipped
+ */
+std::filesystem::path get_test_model_dir();
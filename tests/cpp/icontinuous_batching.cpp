@@ -0,0 +1,205 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <algorithm>
+
+#include "openvino/genai/text_streamer.hpp"
+#include "icontinuous_batching.hpp"
+#include "generation_stream.hpp"
+#include "helper.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+std::vector<int64_t> to_vector(const ov::Tensor& tensor) {
+    return std::vector<int64_t>(tensor.data<int64_t>(), tensor.data<int64_t>() + tensor.get_size());
+}
+
+GenerationOutputs make_outputs(std::vector<int64_t> token_ids) {
+    GenerationOutput output;
+    output.generated_log_probs.resize(token_ids.size(), 0.0f);
+    output.generated_ids = std::move(token_ids);
+    output.score = 0.0f;
+    output.finish_reason = GenerationFinishReason::NONE;
+    return {{0, output}};
+}
+
+// Requests of a batch generating given tokens one per step, the request is added to generation at `start_step`
+struct BatchOfRequests {
+    std::vector<std::vector<int64_t>> tokens;
+    std::vector<size_t> start_steps;
+    std::vector<GenerationStream::Ptr> streams;
+    std::vector<GenerationHandle> handles;
+    std::vector<uint8_t> finished;
+
+    BatchOfRequests(std::vector<std::vector<int64_t>> tokens, std::vector<size_t> start_steps) :
+        tokens(std::move(tokens)), start_steps(std::move(start_steps)),
+        streams(this->tokens.size()), handles(this->tokens.size()), finished(this->tokens.size(), 0) {}
+
+    // pushes outputs of generation step, the request is finished together with its last token
+    void generate_step(size_t step) {
+        for (size_t request_index = 0; request_index < tokens.size(); ++request_index) {
+            if (step == start_steps[request_index]) {
+                streams[request_index] = GenerationStream::create();
+                handles[request_index] = std::make_shared<GenerationHandleImpl>(streams[request_index], ov::genai::greedy());
+            }
+            if (step < start_steps[request_index] || streams[request_index]->get_status() != GenerationStatus::RUNNING)
+                continue;
+            const size_t position = step - start_steps[request_index];
+            streams[request_index]->push(make_outputs({tokens[request_index].at(position)}));
+            if (position + 1 == tokens[request_index].size())
+                streams[request_index]->set_generation_status(GenerationStatus::FINISHED);
+        }
+    }
+};
+
+}  // namespace
+
+class IContinuousBatchingTest : public testing::Test, public ov::genai::ContinuousBatchingPipeline {
+protected:
+    // Pipeline which records prompts passed to generation instead of generating
+    class PipelineTestInstance : public ContinuousBatchingPipeline::IContinuousBatchingPipeline {
+    public:
+        explicit PipelineTestInstance(const Tokenizer& tokenizer) {
+            m_tokenizer = tokenizer;
+        }
+
+        GenerationHandle add_request(uint64_t request_id, const ov::Tensor& input_ids, GenerationConfig sampling_params) override {
+            OPENVINO_THROW("Not used in tests");
+        }
+
+        GenerationHandle add_request(uint64_t request_id, const std::string& prompt, GenerationConfig sampling_params) override {
+            OPENVINO_THROW("Not used in tests");
+        }
+
+        bool has_non_finished_requests() override {
+            return false;
+        }
+
+        void step() override {}
+
+        std::vector<EncodedGenerationResult>
+        generate(const std::vector<ov::Tensor>& input_ids,
+                 const std::vector<GenerationConfig>& sampling_params,
+                 const StreamerVariant& streamer) override {
+            for (const ov::Tensor& prompt_ids : input_ids)
+                generated_input_ids.push_back(to_vector(prompt_ids));
+            return {};
+        }
+
+        using IContinuousBatchingPipeline::generate;
+        using IContinuousBatchingPipeline::stream_batch_tokens;
+
+        std::vector<std::vector<int64_t>> generated_input_ids;
+    };
+};
+
+TEST_F(IContinuousBatchingTest, batched_tokenization_of_prompts_matches_tokenization_of_each_prompt) {
+    const std::filesystem::path model_dir = get_test_model_dir();
+    if (model_dir.empty())
+        GTEST_SKIP() << "Test model is not found";
+
+    Tokenizer tokenizer(model_dir);
+    ASSERT_FALSE(tokenizer.get_chat_template().empty());
+    PipelineTestInstance pipeline(tokenizer);
+
+    // several tokenization batches with prompts of different lengths, every third prompt is used without chat template
+    std::vector<std::string> prompts;
+    std::vector<GenerationConfig> sampling_params;
+    for (size_t i = 0; i < 40; ++i) {
+        std::string prompt = "Prompt " + std::to_string(i) + ":";
+        for (size_t word = 0; word < (i * 7) % 23; ++word)
+            prompt += " word" + std::to_string(word);
+        prompts.push_back(prompt);
+        sampling_params.push_back(ov::genai::greedy());
+        sampling_params.back().apply_chat_template = i % 3 != 0;
+    }
+
+    pipeline.generate(prompts, sampling_params, std::monostate{});
+
+    ASSERT_EQ(pipeline.generated_input_ids.size(), prompts.size());
+    for (size_t i = 0; i < prompts.size(); ++i) {
+        std::vector<int64_t> expected;
+        if (sampling_params[i].apply_chat_template) {
+            ChatHistory history({{{"role", "user"}, {"content", prompts[i]}}});
+            const std::string templated = tokenizer.apply_chat_template(history, true);
+            expected = to_vector(tokenizer.encode(templated, ov::genai::add_special_tokens(false)).input_ids);
+        } else {
+            expected = to_vector(tokenizer.encode(prompts[i]).input_ids);
+        }
+        EXPECT_EQ(pipeline.generated_input_ids[i], expected) << "prompt " << i;
+    }
+}
+
+TEST_F(IContinuousBatchingTest, batch_text_streamer_gets_text_of_every_request_once) {
+    const std::filesystem::path model_dir = get_test_model_dir();
+    if (model_dir.empty())
+        GTEST_SKIP() << "Test model is not found";
+
+    Tokenizer tokenizer(model_dir);
+    PipelineTestInstance pipeline(tokenizer);
+    std::vector<std::vector<int64_t>> tokens;
+    for (const std::string& text : {"Why is the Sun yellow?", "1+1=2", "Multiline\nstring! It is longer than others", "若我有一亿美元"})
+        tokens.push_back(to_vector(tokenizer.encode(text, ov::genai::add_special_tokens(false)).input_ids));
+    // requests of different lengths finish at different steps, the last one is added at the second step
+    BatchOfRequests batch(tokens, {0, 0, 0, 1});
+
+    std::vector<std::string> texts(tokens.size());
+    std::vector<size_t> num_finished(tokens.size(), 0);
+    auto streamer = std::make_shared<BatchTextStreamer>(tokenizer, [&](const std::vector<BatchStreamingUpdate>& updates) {
+        for (const BatchStreamingUpdate& update : updates) {
+            EXPECT_EQ(num_finished.at(update.request_index), 0) << "update of finished request " << update.request_index;
+            texts.at(update.request_index) += update.text;
+            num_finished.at(update.request_index) += update.finished;
+        }
+        return StreamingStatus::RUNNING;
+    });
+
+    for (size_t step = 0; std::count(batch.finished.begin(), batch.finished.end(), 0) > 0; ++step) {
+        ASSERT_LT(step, 100);
+        batch.generate_step(step);
+        EXPECT_EQ(pipeline.stream_batch_tokens(streamer, batch.handles, batch.finished), StreamingStatus::RUNNING);
+    }
+    streamer->end();
+
+    for (size_t request_index = 0; request_index < tokens.size(); ++request_index) {
+        EXPECT_EQ(texts[request_index], tokenizer.decode(tokens[request_index])) << "request " << request_index;
+        EXPECT_EQ(num_finished[request_index], 1) << "request " << request_index;
+    }
+}
+
+TEST_F(IContinuousBatchingTest, batch_text_streamer_stops_all_requests) {
+    const std::filesystem::path model_dir = get_test_model_dir();
+    if (model_dir.empty())
+        GTEST_SKIP() << "Test model is not found";
+
+    Tokenizer tokenizer(model_dir);
+    PipelineTestInstance pipeline(tokenizer);
+    std::vector<std::vector<int64_t>> tokens;
+    for (const std::string& text : {"Why is the Sun yellow?", "Multiline\nstring! It is longer than others", "1+1=2"})
+        tokens.push_back(to_vector(tokenizer.encode(text, ov::genai::add_special_tokens(false)).input_ids));
+    // the first request is finished at the first step, the last one isn't added yet when streaming is stopped
+    tokens[0].resize(1);
+    BatchOfRequests batch(tokens, {0, 0, 10});
+
+    size_t num_callbacks = 0;
+    auto streamer = std::make_shared<BatchTextStreamer>(tokenizer, [&](const std::vector<BatchStreamingUpdate>& updates) {
+        return ++num_callbacks == 2 ? StreamingStatus::STOP : StreamingStatus::RUNNING;
+    });
+
+    batch.generate_step(0);
+    EXPECT_EQ(pipeline.stream_batch_tokens(streamer, batch.handles, batch.finished), StreamingStatus::RUNNING);
+    StreamingStatus status = StreamingStatus::RUNNING;
+    for (size_t step = 1; status == StreamingStatus::RUNNING && step < tokens[1].size(); ++step) {
+        batch.generate_step(step);
+        status = pipeline.stream_batch_tokens(streamer, batch.handles, batch.finished);
+    }
+
+    EXPECT_EQ(status, StreamingStatus::STOP);
+    EXPECT_EQ(num_callbacks, 2);
+    EXPECT_EQ(batch.handles[0]->get_status(), GenerationStatus::FINISHED);
+    EXPECT_EQ(batch.handles[1]->get_status(), GenerationStatus::STOP);
+    EXPECT_FALSE(batch.handles[2]);
+}
@@ -0,0 +1,136 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+
+#include "incremental_chat_encoder.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// Tokenizer with a token per byte, which records encoded texts
+struct ByteTokenizer {
+    std::vector<std::string> encoded_texts;
+    // token merged from "ab" pair, merges make boundaries between "a" and "b" unstable
+    bool merge_ab = false;
+    // token prepended to every encoded text, like SentencePiece dummy prefix
+    bool add_dummy_prefix = false;
+
+    static constexpr int64_t AB_TOKEN = 256, DUMMY_PREFIX_TOKEN = 257;
+
+    std::vector<int64_t> operator()(const std::string& text) {
+        encoded_texts.push_back(text);
+        std::vector<int64_t> ids;
+        if (add_dummy_prefix)
+            ids.push_back(DUMMY_PREFIX_TOKEN);
+        for (size_t i = 0; i < text.size(); ++i) {
+            if (merge_ab && text.compare(i, 2, "ab") == 0) {
+                ids.push_back(AB_TOKEN);
+                ++i;
+            } else {
+                ids.push_back(static_cast<uint8_t>(text[i]));
+            }
+        }
+        return ids;
+    }
+
+    bool encoded(const std::string& text) const {
+        return std::find(encoded_texts.begin(), encoded_texts.end(), text) != encoded_texts.end();
+    }
+};
+
+// tokens of the whole text
+std::vector<int64_t> encode_whole(const std::string& text, bool merge_ab = false, bool add_dummy_prefix = false) {
+    ByteTokenizer tokenizer;
+    tokenizer.merge_ab = merge_ab;
+    tokenizer.add_dummy_prefix = add_dummy_prefix;
+    return tokenizer(text);
+}
+
+std::vector<int64_t> to_vector(const ov::Tensor& input_ids) {
+    EXPECT_EQ(input_ids.get_shape().at(0), 1);
+    return std::vector<int64_t>(input_ids.data<int64_t>(), input_ids.data<int64_t>() + input_ids.get_size());
+}
+
+// long enough for the boundary check to tokenize only a tail of the previous history
+const std::string FIRST_TURN = "<|user|>" + std::string(100, 'x') + "<|assistant|>" + std::string(50, 'y');
+
+}  // namespace
+
+TEST(IncrementalChatEncoder, tokenizes_only_appended_text) {
+    IncrementalChatEncoder encoder;
+    ByteTokenizer tokenizer;
+    auto encode_text = std::ref(tokenizer);
+
+    EXPECT_EQ(to_vector(encoder.encode(FIRST_TURN, encode_text)), encode_whole(FIRST_TURN));
+    const std::string second_turn = FIRST_TURN + "<|user|>next question<|assistant|>";
+    tokenizer.encoded_texts.clear();
+    EXPECT_EQ(to_vector(encoder.encode(second_turn, encode_text)), encode_whole(second_turn));
+
+    EXPECT_TRUE(tokenizer.encoded("<|user|>next question<|assistant|>"));
+    EXPECT_FALSE(tokenizer.encoded(second_turn));
+    for (const std::string& text : tokenizer.encoded_texts)
+        EXPECT_LT(text.size(), second_turn.size());
+}
+
+TEST(IncrementalChatEncoder, tokenizes_whole_history_if_tokens_merge_across_boundary) {
+    IncrementalChatEncoder encoder;
+    ByteTokenizer tokenizer;
+    tokenizer.merge_ab = true;
+    auto encode_text = std::ref(tokenizer);
+
+    const std::string first_turn = FIRST_TURN + "a";
+    encoder.encode(first_turn, encode_text);
+    const std::string second_turn = first_turn + "bc";
+    tokenizer.encoded_texts.clear();
+    std::vector<int64_t> input_ids = to_vector(encoder.encode(second_turn, encode_text));
+
+    EXPECT_TRUE(tokenizer.encoded(second_turn));
+    EXPECT_EQ(input_ids, encode_whole(second_turn, true));
+    EXPECT_EQ(input_ids.at(input_ids.size() - 2), ByteTokenizer::AB_TOKEN);
+}
+
+TEST(IncrementalChatEncoder, tokenizes_whole_history_if_tokenizer_adds_dummy_prefix) {
+    IncrementalChatEncoder encoder;
+    ByteTokenizer tokenizer;
+    tokenizer.add_dummy_prefix = true;
+    auto encode_text = std::ref(tokenizer);
+
+    encoder.encode(FIRST_TURN, encode_text);
+    const std::string second_turn = FIRST_TURN + "<|user|>next question<|assistant|>";
+    tokenizer.encoded_texts.clear();
+    std::vector<int64_t> input_ids = to_vector(encoder.encode(second_turn, encode_text));
+
+    EXPECT_TRUE(tokenizer.encoded(second_turn));
+    // the prefix is added only at the beginning of the history
+    EXPECT_EQ(input_ids, encode_whole(second_turn, false, true));
+    EXPECT_EQ(std::count(input_ids.begin(), input_ids.end(), ByteTokenizer::DUMMY_PREFIX_TOKEN), 1);
+}
+
+TEST(IncrementalChatEncoder, tokenizes_whole_history_if_previous_history_is_not_prefix) {
+    IncrementalChatEncoder encoder;
+    ByteTokenizer tokenizer;
+    auto encode_text = std::ref(tokenizer);
+
+    encoder.encode(FIRST_TURN + "<|user|>question<|assistant|>", encode_text);
+    // the last message is replaced
+    const std::string edited_history = FIRST_TURN + "<|user|>edited question<|assistant|>";
+    tokenizer.encoded_texts.clear();
+    EXPECT_EQ(to_vector(encoder.encode(edited_history, encode_text)), encode_whole(edited_history));
+    EXPECT_EQ(tokenizer.encoded_texts, std::vector<std::string>({edited_history}));
+
+    // shorter history, e.g. with removed messages
+    tokenizer.encoded_texts.clear();
+    EXPECT_EQ(to_vector(encoder.encode(FIRST_TURN, encode_text)), encode_whole(FIRST_TURN));
+    EXPECT_EQ(tokenizer.encoded_texts, std::vector<std::string>({FIRST_TURN}));
+
+    // reset history
+    encoder.reset();
+    tokenizer.encoded_texts.clear();
+    const std::string second_turn = FIRST_TURN + "<|user|>next question<|assistant|>";
+    EXPECT_EQ(to_vector(encoder.encode(second_turn, encode_text)), encode_whole(second_turn));
+    EXPECT_EQ(tokenizer.encoded_texts, std::vector<std::string>({second_turn}));
+}
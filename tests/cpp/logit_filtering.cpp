@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <gtest/gtest.h>
+#include <numeric>
+#include <random>
 #include <openvino/core/except.hpp>
 
 #include "logit_processor.hpp"
@@ -127,6 +129,52 @@ TEST(TopKFilteringTest, FilterNotAppliedTopKGreaterThanInputSize) {
     }
 }
 
+TEST(TopPTopKFilteringTest, LargeVocabularyResultEqualToFullSort) {
+    const size_t vocab_size = 32000;
+    std::mt19937 engine(42);
+    std::exponential_distribution<float> distribution(1.0f);
+    std::vector<float> probabilities(vocab_size);
+    for (auto& probability : probabilities)
+        probability = std::pow(distribution(engine), 4.0f);
+    float sum = std::accumulate(probabilities.begin(), probabilities.end(), 0.0f);
+    for (auto& probability : probabilities)
+        probability /= sum;
+
+    std::vector<Token> reference;
+    for (size_t i = 0; i < vocab_size; i++)
+        reference.emplace_back(probabilities[i], i);
+    std::stable_sort(reference.begin(), reference.end(), [](const Token& lhs, const Token& rhs) { return lhs.m_log_prob > rhs.m_log_prob; });
+
+    for (float top_p : {0.1f, 0.5f, 0.95f, 0.999f}) {
+        size_t nucleus_size = 0;
+        float probability_sum = 0.0f;
+        for (const auto& token : reference) {
+            probability_sum += token.m_log_prob;
+            nucleus_size++;
+            if (probability_sum > top_p)
+                break;
+        }
+
+        auto input = probabilities;
+        auto logits = Logits(input.data(), vocab_size);
+        TopPFilter(top_p).apply(logits);
+        ASSERT_EQ(logits.m_size, nucleus_size);
+        ASSERT_EQ(logits.m_vector.size(), nucleus_size);
+        for (size_t i = 0; i < nucleus_size; i++)
+            EXPECT_EQ(logits.m_vector[i].m_log_prob, reference[i].m_log_prob);
+    }
+
+    for (size_t top_k : {1, 20, 1000}) {
+        auto input = probabilities;
+        auto logits = Logits(input.data(), vocab_size);
+        TopKFilter(top_k).apply(logits);
+        ASSERT_EQ(logits.m_size, top_k);
+        ASSERT_EQ(logits.m_vector.size(), top_k);
+        for (size_t i = 0; i < top_k; i++)
+            EXPECT_EQ(logits.m_vector[i].m_log_prob, reference[i].m_log_prob);
+    }
+}
+
 struct RepetitionPenaltyTransformTestStruct {
     static inline const size_t size = 3;
 
@@ -303,6 +351,47 @@ TEST(PresencePenaltyTransformInitializationTest, ThrowsForInvalidInputIds) {
     EXPECT_THROW(transform.apply(logits, {0, -1}), ov::Exception);
 }
 
+TEST(PenaltyTransformTest, FusedPenaltiesEqualToSequentialPenalties) {
+    float input[]{-1.0f, 2.0f, 3.0f, 4.0f};
+    auto token_occurrences = std::make_shared<TokenOccurrences>();
+    token_occurrences->add_prompt_token(3);
+    for (int64_t token_id : {0, 1, 1, 2})
+        token_occurrences->add_generated_token(token_id);
+    // token 2 was rejected, so it should be penalized by repetition penalty only if it is in prompt
+    token_occurrences->remove_generated_token(2);
+    ASSERT_EQ(token_occurrences->get_generated_count(1), 2);
+    ASSERT_EQ(token_occurrences->get_generated_count(2), 0);
+    EXPECT_THROW(token_occurrences->remove_generated_token(2), ov::Exception);
+
+    auto transform = PenaltyTransform(2.0, 0.5, 0.25);
+    transform.set_token_occurrences(token_occurrences);
+    Logits logits(input, 4);
+    transform.apply(logits);
+
+    float expected_output[]{-2.0f + 0.5f + 0.25f, 1.0f - 0.5f - 0.5f, 3.0f, 2.0f};
+    for (size_t i = 0; i < logits.m_size; i++) {
+        EXPECT_NEAR(logits.m_data[i], expected_output[i], 1e-6);
+    }
+}
+
+TEST(PenaltyTransformTest, FrequencyPenaltyChecksSignAfterPresencePenalty) {
+    float input[]{0.3f, -0.3f};
+    auto token_occurrences = std::make_shared<TokenOccurrences>();
+    for (int64_t token_id : {0, 0, 1, 1})
+        token_occurrences->add_generated_token(token_id);
+
+    auto transform = PenaltyTransform(1.0, 0.5, 0.25);
+    transform.set_token_occurrences(token_occurrences);
+    Logits logits(input, 2);
+    transform.apply(logits);
+
+    // presence penalty flips the sign of both logits, so frequency penalty is applied in the opposite direction
+    float expected_output[]{0.3f - 0.5f + 0.5f, -0.3f + 0.5f - 0.5f};
+    for (size_t i = 0; i < logits.m_size; i++) {
+        EXPECT_NEAR(logits.m_data[i], expected_output[i], 1e-6);
+    }
+}
+
 struct EOSPenaltyTransformTestStruct {
     static inline const size_t size = 3;
 
@@ -0,0 +1,54 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "lru_cache.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// all keys collide, so entries are distinguished by key comparison
+struct ConstantHash {
+    size_t operator()(const std::string&) const {
+        return 42;
+    }
+};
+
+}  // namespace
+
+TEST(LRUCache, evicts_least_recently_used_entry) {
+    LRUCache<std::string, int> cache(2);
+    cache.put("a", 1);
+    cache.put("b", 2);
+    EXPECT_EQ(cache.get("a"), 1);
+    // "b" is the least recently used entry
+    cache.put("c", 3);
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.get("b"), std::nullopt);
+    EXPECT_EQ(cache.get("a"), 1);
+    EXPECT_EQ(cache.get("c"), 3);
+
+    cache.put("a", 4);
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.get("a"), 4);
+}
+
+TEST(LRUCache, distinguishes_keys_with_equal_hashes) {
+    LRUCache<std::string, int, ConstantHash> cache(2);
+    cache.put("a", 1);
+    cache.put("b", 2);
+    cache.put("c", 3);
+    EXPECT_EQ(cache.get("a"), std::nullopt);
+    EXPECT_EQ(cache.get("b"), 2);
+    EXPECT_EQ(cache.get("c"), 3);
+}
+
+TEST(LRUCache, zero_capacity_disables_cache) {
+    LRUCache<std::string, int> cache(0);
+    cache.put("a", 1);
+    EXPECT_EQ(cache.get("a"), std::nullopt);
+    EXPECT_EQ(cache.size(), 0u);
+}
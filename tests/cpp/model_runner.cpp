@@ -0,0 +1,87 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <numeric>
+
+#include "model_runner.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// creates sequence groups with given number of scheduled prompt tokens
+std::vector<SequenceGroup::Ptr> create_scheduled_sequence_groups(const std::vector<size_t>& num_scheduled_tokens) {
+    std::vector<SequenceGroup::Ptr> sequence_groups;
+    for (size_t i = 0; i < num_scheduled_tokens.size(); ++i) {
+        std::vector<int64_t> prompt_ids(num_scheduled_tokens[i]);
+        std::iota(prompt_ids.begin(), prompt_ids.end(), 0);
+        sequence_groups.push_back(std::make_shared<SequenceGroup>(i, prompt_ids, ov::genai::greedy(), 32));
+        sequence_groups.back()->schedule_tokens(num_scheduled_tokens[i]);
+    }
+    return sequence_groups;
+}
+
+}  // namespace
+
+TEST(ModelRunnerSubBatches, split_balances_tokens_and_keeps_order) {
+    auto sequence_groups = create_scheduled_sequence_groups({8, 1, 1, 1, 1, 4});
+    std::vector<uint64_t> scheduled_ids{0, 1, 2, 3, 4, 5};
+
+    auto sub_batches = ModelRunner::split_into_sub_batches(sequence_groups, scheduled_ids, 3);
+    std::vector<std::vector<uint64_t>> expected{{0}, {1, 2, 3, 4}, {5}};
+    ASSERT_EQ(sub_batches, expected);
+}
+
+TEST(ModelRunnerSubBatches, split_uses_scheduled_groups_only) {
+    auto sequence_groups = create_scheduled_sequence_groups({1, 100, 1, 1, 100, 10});
+    std::vector<uint64_t> scheduled_ids{0, 2, 3, 5};
+
+    auto sub_batches = ModelRunner::split_into_sub_batches(sequence_groups, scheduled_ids, 2);
+    std::vector<std::vector<uint64_t>> expected{{0, 2, 3}, {5}};
+    ASSERT_EQ(sub_batches, expected);
+}
+
+TEST(ModelRunnerSubBatches, split_into_no_more_sub_batches_than_groups) {
+    auto sequence_groups = create_scheduled_sequence_groups({5, 1, 1});
+    std::vector<uint64_t> scheduled_ids{0, 1, 2};
+
+    auto sub_batches = ModelRunner::split_into_sub_batches(sequence_groups, scheduled_ids, 4);
+    std::vector<std::vector<uint64_t>> expected{{0}, {1}, {2}};
+    ASSERT_EQ(sub_batches, expected);
+
+    sub_batches = ModelRunner::split_into_sub_batches(sequence_groups, scheduled_ids, 1);
+    expected = {{0, 1, 2}};
+    ASSERT_EQ(sub_batches, expected);
+}
+
+TEST(ModelRunnerSubBatches, merge_concatenates_outputs_by_tokens) {
+    const size_t vocab_size = 3;
+    std::vector<float> first_data{0, 1, 2, 3, 4, 5}, second_data{6, 7, 8};
+    std::vector<ov::Tensor> sub_batch_outputs{
+        ov::Tensor(ov::element::f32, {2, 1, vocab_size}, first_data.data()),
+        ov::Tensor(ov::element::f32, {1, 1, vocab_size}, second_data.data()),
+    };
+
+    ov::Tensor merged = ModelRunner::merge_outputs(sub_batch_outputs);
+    ASSERT_EQ(merged.get_element_type(), ov::element::f32);
+    ASSERT_EQ(merged.get_shape(), ov::Shape({3, 1, vocab_size}));
+    const float* merged_data = merged.data<float>();
+    for (size_t i = 0; i < merged.get_size(); ++i) {
+        EXPECT_EQ(merged_data[i], static_cast<float>(i));
+    }
+}
+
+TEST(ModelRunnerSubBatches, merge_keeps_element_type_of_token_ids) {
+    std::vector<int64_t> first_data{10, 11}, second_data{12, 13};
+    std::vector<ov::Tensor> sub_batch_outputs{
+        ov::Tensor(ov::element::i64, {1, 1, 2}, first_data.data()),
+        ov::Tensor(ov::element::i64, {1, 1, 2}, second_data.data()),
+    };
+
+    ov::Tensor merged = ModelRunner::merge_outputs(sub_batch_outputs);
+    ASSERT_EQ(merged.get_element_type(), ov::element::i64);
+    ASSERT_EQ(merged.get_shape(), ov::Shape({2, 1, 2}));
+    std::vector<int64_t> expected{10, 11, 12, 13};
+    ASSERT_EQ(std::vector<int64_t>(merged.data<int64_t>(), merged.data<int64_t>() + merged.get_size()), expected);
+}
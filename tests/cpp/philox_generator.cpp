@@ -0,0 +1,56 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "philox_generator.hpp"
+
+using namespace ov::genai;
+
+TEST(PhiloxGeneratorTest, known_answer) {
+    // reference values of Random123 philox4x32_10
+    PhiloxGenerator::Counter expected_zero = {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8};
+    ASSERT_EQ(PhiloxGenerator::philox4x32_10({0, 0, 0, 0}, {0, 0}), expected_zero);
+
+    PhiloxGenerator::Counter expected_ones = {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd};
+    ASSERT_EQ(PhiloxGenerator::philox4x32_10({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}), expected_ones);
+}
+
+TEST(PhiloxGeneratorTest, streams_are_reproducible_and_distinct) {
+    PhiloxGenerator generator(42, 3, 1, 0, 10), same_generator(42, 3, 1, 0, 10);
+    std::vector<PhiloxGenerator> other_generators = {
+        PhiloxGenerator(43, 3, 1, 0, 10),
+        PhiloxGenerator(42, 4, 1, 0, 10),
+        PhiloxGenerator(42, 3, 2, 0, 10),
+        PhiloxGenerator(42, 3, 1, 1, 10),
+        PhiloxGenerator(42, 3, 1, 0, 11),
+    };
+
+    std::vector<uint32_t> values, same_values;
+    for (size_t i = 0; i < 9; ++i) {
+        values.push_back(generator());
+        same_values.push_back(same_generator());
+    }
+    ASSERT_EQ(values, same_values);
+
+    for (auto& other_generator : other_generators) {
+        std::vector<uint32_t> other_values;
+        for (size_t i = 0; i < 9; ++i)
+            other_values.push_back(other_generator());
+        ASSERT_NE(values, other_values);
+    }
+}
+
+TEST(PhiloxGeneratorTest, uniform_range) {
+    PhiloxGenerator generator(0, 0, 0, 0, 0);
+    double sum = 0.0;
+    const size_t num_samples = 10000;
+    for (size_t i = 0; i < num_samples; ++i) {
+        double value = generator.uniform();
+        ASSERT_GE(value, 0.0);
+        ASSERT_LT(value, 1.0);
+        sum += value;
+    }
+    ASSERT_NEAR(sum / num_samples, 0.5, 0.02);
+}
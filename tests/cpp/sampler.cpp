@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <gtest/gtest.h>
+#include <limits>
+#include <numeric>
+#include <random>
 #include "sampler.hpp"
 #include "openvino/genai/generation_config.hpp"
 
@@ -300,3 +303,274 @@ TEST(SamplerValidationMode, prompt_phase) {
              expected{0, 1, 2, 3};
     ASSERT_EQ(sequence_groups.front()->get_sequences().front()->get_generated_ids(), expected);
 }
+
+TEST(SamplerLogitsCandidates, greedy_maps_candidates_to_token_ids) {
+    auto sampling_config = ov::genai::greedy();
+    std::vector<int64_t> input_vector{0, 1, 2};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 3}, input_vector.data());
+    std::vector<SequenceGroup::Ptr> sequence_groups{
+        SequenceGroup::Ptr(new SequenceGroup(0, input_tensor, sampling_config, 32)),
+    };
+    sequence_groups.front()->schedule_tokens(sequence_groups.front()->get_num_available_tokens_for_batching());
+
+    // 2 candidates per token, only the last token is used for sampling
+    std::vector<float> logits = {
+        5.f, 4.f,
+        5.f, 4.f,
+        3.f, 1.f,
+    };
+    std::vector<int64_t> token_ids = {
+        10, 11,
+        12, 13,
+        42, 7,
+    };
+    ov::Tensor logits_tensor(ov::element::f32, ov::Shape{3, 1, 2}, logits.data());
+    ov::Tensor token_ids_tensor(ov::element::i64, ov::Shape{3, 1, 2}, token_ids.data());
+
+    Sampler sampler;
+    sampler.sample(sequence_groups, logits_tensor, false, token_ids_tensor);
+
+    TokenIds expected{42};
+    ASSERT_EQ(sequence_groups.front()->get_sequences().front()->get_generated_ids(), expected);
+}
+
+TEST(SamplerLogitsCandidates, multinomial_maps_candidates_to_token_ids) {
+    auto sampling_config = ov::genai::multinomial();
+    sampling_config.top_k = 2;
+    sampling_config.top_p = 1.0f;
+    sampling_config.num_return_sequences = 1;
+    sampling_config.presence_penalty = 0.0f;
+    sampling_config.frequency_penalty = 0.0f;
+    sampling_config.min_new_tokens = 0;
+    std::vector<int64_t> input_vector{0};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 1}, input_vector.data());
+    std::vector<SequenceGroup::Ptr> sequence_groups{
+        SequenceGroup::Ptr(new SequenceGroup(0, input_tensor, sampling_config, 32)),
+    };
+    sequence_groups.front()->schedule_tokens(sequence_groups.front()->get_num_available_tokens_for_batching());
+
+    std::vector<float> logits = {0.f, -std::numeric_limits<float>::infinity()};
+    std::vector<int64_t> token_ids = {100, 200};
+    ov::Tensor logits_tensor(ov::element::f32, ov::Shape{1, 1, 2}, logits.data());
+    ov::Tensor token_ids_tensor(ov::element::i64, ov::Shape{1, 1, 2}, token_ids.data());
+
+    Sampler sampler;
+    sampler.sample(sequence_groups, logits_tensor, false, token_ids_tensor);
+
+    TokenIds expected{100};
+    ASSERT_EQ(sequence_groups.front()->get_sequences().front()->get_generated_ids(), expected);
+}
+
+TEST(SamplerMultinomial, multiple_sequences_sampled_from_nonzero_probabilities) {
+    auto sampling_config = ov::genai::multinomial();
+    sampling_config.top_k = 0;
+    sampling_config.top_p = 1.0f;
+    sampling_config.num_return_sequences = 64;
+    sampling_config.presence_penalty = 0.0f;
+    sampling_config.frequency_penalty = 0.0f;
+    sampling_config.min_new_tokens = 0;
+    std::vector<int64_t> input_vector{0};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 1}, input_vector.data());
+    std::vector<SequenceGroup::Ptr> sequence_groups{
+        SequenceGroup::Ptr(new SequenceGroup(0, input_tensor, sampling_config, 32)),
+    };
+    sequence_groups.front()->schedule_tokens(sequence_groups.front()->get_num_available_tokens_for_batching());
+
+    const float inf = std::numeric_limits<float>::infinity();
+    std::vector<float> logits = {-inf, 1.f, -inf, 1.f, -inf};
+    ov::Tensor logits_tensor(ov::element::f32, ov::Shape{1, 1, 5}, logits.data());
+
+    Sampler sampler;
+    sampler.sample(sequence_groups, logits_tensor);
+
+    std::set<int64_t> sampled_tokens;
+    auto sequences = sequence_groups.front()->get_sequences();
+    ASSERT_EQ(sequences.size(), 64);
+    for (const auto& sequence : sequences) {
+        ASSERT_EQ(sequence->get_generated_ids().size(), 1);
+        sampled_tokens.insert(sequence->get_generated_ids().front());
+    }
+    ASSERT_EQ(sampled_tokens, std::set<int64_t>({1, 3}));
+}
+
+TEST(SamplerMultinomial, sampling_does_not_depend_on_batch_composition) {
+    auto sampling_config = ov::genai::multinomial();
+    sampling_config.top_k = 0;
+    sampling_config.top_p = 1.0f;
+    sampling_config.num_return_sequences = 1;
+    sampling_config.presence_penalty = 0.0f;
+    sampling_config.frequency_penalty = 0.0f;
+    sampling_config.min_new_tokens = 0;
+    sampling_config.rng_seed = 7;
+    std::vector<int64_t> input_vector{0};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 1}, input_vector.data());
+
+    std::vector<float> logits(64);
+    std::iota(logits.begin(), logits.end(), 0.0f);
+    std::transform(logits.begin(), logits.end(), logits.begin(), [](float value) { return value / 16; });
+
+    auto sample_request = [&](const std::vector<uint64_t>& request_ids) {
+        std::vector<SequenceGroup::Ptr> sequence_groups;
+        std::vector<float> batch_logits;
+        for (uint64_t request_id : request_ids) {
+            sequence_groups.push_back(SequenceGroup::Ptr(new SequenceGroup(request_id, input_tensor, sampling_config, 32)));
+            sequence_groups.back()->schedule_tokens(sequence_groups.back()->get_num_available_tokens_for_batching());
+            batch_logits.insert(batch_logits.end(), logits.begin(), logits.end());
+        }
+        ov::Tensor logits_tensor(ov::element::f32, ov::Shape{request_ids.size(), 1, logits.size()}, batch_logits.data());
+
+        Sampler sampler(4);
+        sampler.sample(sequence_groups, logits_tensor);
+        return sequence_groups.back()->get_sequences().front()->get_generated_ids();
+    };
+
+    auto expected = sample_request({5});
+    for (size_t i = 0; i < 8; ++i) {
+        ASSERT_EQ(sample_request({100 + i, 5}), expected);
+    }
+}
+
+TEST(SamplerMultinomial, consecutive_generations_use_different_streams) {
+    auto sampling_config = ov::genai::multinomial();
+    sampling_config.top_k = 0;
+    sampling_config.top_p = 1.0f;
+    sampling_config.num_return_sequences = 1;
+    sampling_config.presence_penalty = 0.0f;
+    sampling_config.frequency_penalty = 0.0f;
+    sampling_config.min_new_tokens = 0;
+    std::vector<int64_t> input_vector{0};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 1}, input_vector.data());
+
+    // uniform distribution over the vocabulary
+    std::vector<float> logits(1024, 0.0f);
+    ov::Tensor logits_tensor(ov::element::f32, ov::Shape{1, 1, logits.size()}, logits.data());
+
+    // request ids restart from 0 in every generation, as generate() of pipelines assigns them
+    auto generate = [&](Sampler& sampler) {
+        sampler.start_generation();
+        SequenceGroup::Ptr sequence_group(new SequenceGroup(0, input_tensor, sampling_config, 32));
+        sequence_group->schedule_tokens(sequence_group->get_num_available_tokens_for_batching());
+        sampler.sample({sequence_group}, logits_tensor);
+        sampler.clear_request_info(0);
+        return sequence_group->get_sequences().front()->get_generated_ids().front();
+    };
+
+    Sampler sampler, same_sampler;
+    std::vector<int64_t> tokens, same_tokens;
+    for (size_t i = 0; i < 4; ++i) {
+        tokens.push_back(generate(sampler));
+        same_tokens.push_back(generate(same_sampler));
+    }
+    // pipelines with the same seed reproduce each other
+    ASSERT_EQ(tokens, same_tokens);
+    // the probability of the same token in all generations is 1024^-3
+    ASSERT_FALSE(std::all_of(tokens.begin(), tokens.end(), [&](int64_t token) { return token == tokens.front(); }));
+}
+
+TEST(SamplerBeamSearch, log_softmax_top_k_equal_to_full_sort) {
+    const size_t vocab_size = 1000, top_k = 8;
+    std::vector<float> logits(2 * vocab_size);
+    for (size_t i = 0; i < logits.size(); ++i)
+        logits[i] = std::sin(0.37f * i) * 10.0f;
+    ov::Tensor logits_tensor(ov::element::f32, ov::Shape{2, 1, vocab_size}, logits.data());
+
+    std::unordered_map<int64_t, float> log_prob_offsets;
+    std::vector<Token> reference = log_softmax(logits_tensor, 1);
+    // ban 3 most probable tokens and penalize another one
+    std::vector<Token> sorted_reference = reference;
+    std::sort(sorted_reference.begin(), sorted_reference.end(), [](const Token& left, const Token& right) {
+        return left.m_log_prob > right.m_log_prob;
+    });
+    for (size_t i = 0; i < 3; ++i)
+        log_prob_offsets[sorted_reference[i].m_index] = -std::numeric_limits<float>::infinity();
+    log_prob_offsets[sorted_reference[5].m_index] = -0.5f;
+
+    for (const auto& [token_id, offset] : log_prob_offsets)
+        reference[token_id].m_log_prob += offset;
+    std::sort(reference.begin(), reference.end(), [](const Token& left, const Token& right) {
+        return left.m_log_prob > right.m_log_prob;
+    });
+
+    std::vector<Token> tokens = log_softmax_top_k(logits_tensor, 1, top_k, log_prob_offsets);
+    ASSERT_EQ(tokens.size(), top_k);
+    for (size_t i = 0; i < top_k; ++i) {
+        EXPECT_EQ(tokens[i].m_index, reference[i].m_index);
+        EXPECT_NEAR(tokens[i].m_log_prob, reference[i].m_log_prob, 1e-5);
+    }
+}
+
+TEST(SamplerStructuredOutput, invalid_description_is_rejected_when_request_is_prepared) {
+    Sampler sampler;
+    GenerationConfig config;
+    config.structured_output_config = StructuredOutputConfig();
+    config.structured_output_config->regex = "a(b";
+    EXPECT_THROW(sampler.prepare_structured_output(0, config), ov::Exception);
+
+    config.structured_output_config->regex = "a(b|c)*";
+    EXPECT_NO_THROW(sampler.prepare_structured_output(1, config));
+    sampler.clear_request_info(1);
+}
+
+TEST(Sampler, batched_sampling_of_plain_requests_matches_per_group_sampling) {
+    auto plain_multinomial = ov::genai::multinomial();
+    plain_multinomial.num_return_sequences = 1;
+    plain_multinomial.presence_penalty = 0.0f;
+    plain_multinomial.frequency_penalty = 0.0f;
+    plain_multinomial.min_new_tokens = 0;
+    plain_multinomial.rng_seed = 11;
+    // the first step forks sequences, so it is sampled per group, while the next steps are plain
+    auto forking_multinomial = plain_multinomial;
+    forking_multinomial.num_return_sequences = 3;
+    auto penalized_greedy = ov::genai::greedy();
+    penalized_greedy.repetition_penalty = 1.5f;
+    const std::vector<GenerationConfig> configs{ov::genai::greedy(), plain_multinomial, forking_multinomial, penalized_greedy, ov::genai::multinomial()};
+    std::vector<int64_t> long_prompt{1, 2, 3}, short_prompt{1};
+    const size_t vocab_size = 64, num_steps = 4;
+
+    auto create_sequence_groups = [&]() {
+        std::vector<SequenceGroup::Ptr> sequence_groups;
+        for (size_t request_id = 0; request_id < configs.size(); ++request_id) {
+            // logits of the whole prompt are computed, only the last row is sampled
+            auto& prompt = request_id == 0 ? long_prompt : short_prompt;
+            ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, prompt.size()}, prompt.data());
+            sequence_groups.push_back(SequenceGroup::Ptr(new SequenceGroup(request_id, input_tensor, configs[request_id], 32)));
+        }
+        return sequence_groups;
+    };
+    auto sample_step = [&](Sampler& sampler, const std::vector<SequenceGroup::Ptr>& sequence_groups, size_t step) {
+        std::vector<float> logits;
+        for (const auto& sequence_group : sequence_groups) {
+            sequence_group->schedule_tokens(sequence_group->get_num_available_tokens_for_batching());
+            // logits of a request do not depend on batch composition
+            std::mt19937 generator(sequence_group->get_request_id() * num_steps + step);
+            std::uniform_real_distribution<float> distribution(-4.0f, 4.0f);
+            const size_t num_rows = sequence_group->num_running_seqs() * sequence_group->get_output_seq_len();
+            for (size_t i = 0; i < num_rows * vocab_size; ++i)
+                logits.push_back(distribution(generator));
+        }
+        ov::Tensor logits_tensor(ov::element::f32, ov::Shape{logits.size() / vocab_size, 1, vocab_size}, logits.data());
+        sampler.sample(sequence_groups, logits_tensor);
+    };
+
+    auto batched_groups = create_sequence_groups(), reference_groups = create_sequence_groups();
+    Sampler batched_sampler(4);
+    std::vector<std::shared_ptr<Sampler>> reference_samplers;
+    for (size_t i = 0; i < configs.size(); ++i)
+        reference_samplers.push_back(std::make_shared<Sampler>());
+    for (size_t step = 0; step < num_steps; ++step) {
+        sample_step(batched_sampler, batched_groups, step);
+        for (size_t i = 0; i < configs.size(); ++i)
+            sample_step(*reference_samplers[i], {reference_groups[i]}, step);
+    }
+
+    ASSERT_EQ(batched_groups[2]->num_total_seqs(), 3);
+    for (size_t i = 0; i < configs.size(); ++i) {
+        const auto batched_sequences = batched_groups[i]->get_sequences(), reference_sequences = reference_groups[i]->get_sequences();
+        ASSERT_EQ(batched_sequences.size(), reference_sequences.size());
+        for (size_t sequence_id = 0; sequence_id < batched_sequences.size(); ++sequence_id) {
+            EXPECT_EQ(batched_sequences[sequence_id]->get_generated_ids(), reference_sequences[sequence_id]->get_generated_ids());
+            EXPECT_EQ(batched_sequences[sequence_id]->get_generated_len(), num_steps);
+            EXPECT_FLOAT_EQ(batched_sequences[sequence_id]->get_cumulative_log_prob(), reference_sequences[sequence_id]->get_cumulative_log_prob());
+        }
+    }
+}
@@ -0,0 +1,135 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "sampler_kernels.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+std::vector<float> generate_logits(size_t size, uint32_t seed = 42) {
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution<float> distribution(-20.0f, 20.0f);
+    std::vector<float> logits(size);
+    for (auto& logit : logits)
+        logit = distribution(engine);
+    return logits;
+}
+
+}  // namespace
+
+class SamplerKernelsTest : public testing::TestWithParam<size_t> {};
+
+TEST_P(SamplerKernelsTest, reduce_max_and_argmax) {
+    auto logits = generate_logits(GetParam());
+    size_t expected_index = std::max_element(logits.begin(), logits.end()) - logits.begin();
+    EXPECT_EQ(kernels::reduce_max(logits.data(), logits.size()), logits[expected_index]);
+    EXPECT_EQ(kernels::argmax(logits.data(), logits.size()), expected_index);
+}
+
+TEST_P(SamplerKernelsTest, exp_sum_and_log_sum_exp) {
+    auto logits = generate_logits(GetParam());
+    float max_value = *std::max_element(logits.begin(), logits.end());
+    double expected_sum = 0.0;
+    for (float logit : logits)
+        expected_sum += std::exp(double(logit) - max_value);
+
+    float sum = kernels::exp_sum(logits.data(), logits.size(), max_value);
+    EXPECT_NEAR(sum, expected_sum, expected_sum * 1e-4);
+
+    float kernel_max_value = 0.0f;
+    float log_sum = kernels::log_sum_exp(logits.data(), logits.size(), &kernel_max_value);
+    EXPECT_EQ(kernel_max_value, max_value);
+    EXPECT_NEAR(log_sum, max_value + std::log(expected_sum), 1e-4);
+}
+
+TEST_P(SamplerKernelsTest, exp_inplace_and_scale_inplace) {
+    auto logits = generate_logits(GetParam());
+    auto expected = logits;
+    const float temperature = 0.7f;
+    float max_value = *std::max_element(logits.begin(), logits.end());
+
+    float sum = kernels::exp_inplace(logits.data(), logits.size(), max_value, 1.0f / temperature);
+    kernels::scale_inplace(logits.data(), logits.size(), 1.0f / sum);
+
+    double expected_sum = 0.0;
+    for (auto& value : expected) {
+        value = std::exp((value - max_value) / temperature);
+        expected_sum += value;
+    }
+    for (size_t i = 0; i < logits.size(); ++i) {
+        EXPECT_NEAR(logits[i], expected[i] / expected_sum, 1e-6);
+    }
+}
+
+TEST_P(SamplerKernelsTest, top_m) {
+    auto logits = generate_logits(GetParam());
+    const size_t m = std::min(size_t(5), logits.size());
+
+    std::vector<size_t> expected_indices(logits.size());
+    std::iota(expected_indices.begin(), expected_indices.end(), 0);
+    std::stable_sort(expected_indices.begin(), expected_indices.end(), [&logits](size_t left, size_t right) {
+        return logits[left] > logits[right];
+    });
+
+    std::vector<float> top_values(m, -std::numeric_limits<float>::infinity());
+    std::vector<size_t> top_indices(m, 0);
+    kernels::top_m(logits.data(), logits.size(), m, top_values.data(), top_indices.data());
+    for (size_t i = 0; i < m; ++i) {
+        EXPECT_EQ(top_indices[i], expected_indices[i]);
+        EXPECT_EQ(top_values[i], logits[expected_indices[i]]);
+    }
+}
+
+TEST_P(SamplerKernelsTest, mask_inplace) {
+    auto logits = generate_logits(GetParam());
+    auto expected = logits;
+    std::mt19937 engine(7);
+    std::vector<uint32_t> bitmask((logits.size() + 31) / 32);
+    for (size_t i = 0; i < bitmask.size(); ++i)
+        bitmask[i] = i % 3 == 0 ? 0xFFFFFFFFu : static_cast<uint32_t>(engine());
+
+    const float min_value = -std::numeric_limits<float>::infinity();
+    kernels::mask_inplace(logits.data(), logits.size(), bitmask.data(), min_value);
+    for (size_t i = 0; i < logits.size(); ++i) {
+        const bool is_allowed = (bitmask[i / 32] >> (i % 32)) & 1u;
+        EXPECT_EQ(logits[i], is_allowed ? expected[i] : min_value);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(VariousSizes,
+                         SamplerKernelsTest,
+                         testing::Values(1, 7, 8, 16, 17, 33, 1000, 32000));
+
+TEST(SamplerKernels, argmax_returns_first_of_equal_values) {
+    std::vector<float> logits(40, 1.0f);
+    logits[19] = logits[35] = 2.0f;
+    EXPECT_EQ(kernels::argmax(logits.data(), logits.size()), 19);
+
+    std::vector<float> top_values(3, -std::numeric_limits<float>::infinity());
+    std::vector<size_t> top_indices(3, 0);
+    kernels::top_m(logits.data(), logits.size(), 3, top_values.data(), top_indices.data());
+    EXPECT_EQ(top_indices, std::vector<size_t>({19, 35, 0}));
+}
+
+TEST(SamplerKernels, exp_of_minus_infinity_is_zero) {
+    std::vector<float> logits(20, -std::numeric_limits<float>::infinity());
+    logits[3] = 0.0f;
+    logits[17] = std::log(3.0f);
+    EXPECT_NEAR(kernels::exp_sum(logits.data(), logits.size(), 0.0f), 4.0f, 1e-6);
+
+    float sum = kernels::exp_inplace(logits.data(), logits.size(), 0.0f, 1.0f);
+    EXPECT_NEAR(sum, 4.0f, 1e-6);
+    for (size_t i = 0; i < logits.size(); ++i) {
+        if (i != 3 && i != 17)
+            EXPECT_EQ(logits[i], 0.0f);
+    }
+}
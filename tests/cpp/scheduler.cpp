@@ -9,6 +9,7 @@
 #include "openvino/genai/generation_config.hpp"
 #include "sequence_group.hpp"
 #include "scheduler.hpp"
+#include "continuous_batching_impl.hpp"
 #include "helper.hpp"
 
 using namespace ov::genai;
@@ -1011,3 +1012,85 @@ TEST(TestScheduler, FullyPreemptsCacheEvictedSequences) {
         }
     }
 }
+
+class CancelledRequestsTest : public testing::Test, public ov::genai::ContinuousBatchingPipeline {
+protected:
+    class PipelineTestInstance : public ContinuousBatchingPipeline::ContinuousBatchingImpl {
+    public:
+        PipelineTestInstance(const SchedulerConfig& scheduler_config) {
+            m_scheduler = std::make_shared<Scheduler>(4, init_cache_manager(scheduler_config), scheduler_config);
+            m_sampler = std::make_shared<Sampler>();
+        }
+
+        SequenceGroup::Ptr add_request(uint64_t request_id, std::vector<int64_t> tokens) {
+            SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(request_id, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                                ov::genai::greedy(), 4);
+            m_requests.push_back(sequence_group);
+            return sequence_group;
+        }
+
+        // the beginning of step(): dropped requests are released before scheduling
+        Scheduler::Output step_schedule() {
+            _free_requests_dropped_by_handle();
+            Scheduler::Output scheduler_output = m_scheduler->schedule(m_requests);
+            for (auto request : m_requests)
+                request->finish_iteration();
+            return scheduler_output;
+        }
+
+        bool has_block_table(const SequenceGroup::Ptr& request) {
+            return m_scheduler->has_block_table((*request)[0]->get_id());
+        }
+
+        const std::vector<SequenceGroup::Ptr>& get_requests() const {
+            return m_requests;
+        }
+    };
+
+    static SchedulerConfig get_scheduler_config() {
+        SchedulerConfig scheduler_config;
+        scheduler_config.max_num_batched_tokens = 32;
+        // enough for 2 requests with 8 tokens
+        scheduler_config.num_kv_blocks = 4;
+        scheduler_config.dynamic_split_fuse = false;
+        scheduler_config.max_num_seqs = 5;
+        return scheduler_config;
+    }
+
+    PipelineTestInstance m_pipeline = PipelineTestInstance(get_scheduler_config());
+};
+
+TEST_F(CancelledRequestsTest, requests_cancelled_before_step_are_released_before_scheduling) {
+    std::vector<int64_t> tokens = {0, 1, 2, 3, 4, 5, 6, 7};
+    auto running = m_pipeline.add_request(0, tokens);
+    auto cancelled_running = m_pipeline.add_request(1, tokens);
+    auto cancelled_waiting = m_pipeline.add_request(2, tokens);
+
+    // the third request doesn't fit into KV cache
+    auto out1 = m_pipeline.step_schedule();
+    EXPECT_EQ(out1.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0, 1}));
+    EXPECT_TRUE(m_pipeline.has_block_table(cancelled_running));
+    EXPECT_FALSE(m_pipeline.has_block_table(cancelled_waiting));
+
+    GenerationHandle cancelled_running_handle = std::make_shared<GenerationHandleImpl>(cancelled_running->get_generation_stream(), ov::genai::greedy());
+    GenerationHandle cancelled_waiting_handle = std::make_shared<GenerationHandleImpl>(cancelled_waiting->get_generation_stream(), ov::genai::greedy());
+    cancelled_running_handle->cancel();
+    cancelled_waiting_handle->cancel();
+    // needs blocks of the cancelled request for its prompt
+    auto added = m_pipeline.add_request(3, tokens);
+
+    auto out2 = m_pipeline.step_schedule();
+    EXPECT_FALSE(m_pipeline.has_block_table(cancelled_running));
+    EXPECT_EQ(m_pipeline.get_requests(), std::vector<SequenceGroup::Ptr>({running, added}));
+    // only the added request is scheduled on prompt phase, cancelled requests are not scheduled
+    EXPECT_TRUE(out2.is_prompt);
+    EXPECT_EQ(out2.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({1}));
+    EXPECT_EQ(out2.m_block_tables[(*added)[0]->get_id()][0].size(), 2);
+    EXPECT_EQ(out2.m_total_num_scheduled_tokens, tokens.size());
+
+    auto metrics = m_pipeline.get_metrics();
+    EXPECT_EQ(metrics.cancelled_requests, 2);
+    // one generated token of the running request and the whole prompt of the waiting request
+    EXPECT_EQ(metrics.cancelled_tokens_saved, 1 + tokens.size());
+    EXPECT_EQ(metrics.requests, 2);
+}
@@ -0,0 +1,104 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <algorithm>
+
+#include "segment_encoder.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// Tokenizer with a token per byte
+struct ByteTokenizer {
+    // token merged from "ab" pair, merges make boundaries between "a" and "b" unstable
+    bool merge_ab = false;
+    // token prepended to every encoded text, like SentencePiece dummy prefix
+    bool add_dummy_prefix = false;
+    // special tokens added around encoded text, like BERT [CLS] and [SEP]
+    std::vector<int64_t> prefix, suffix;
+
+    static constexpr int64_t AB_TOKEN = 256, DUMMY_PREFIX_TOKEN = 257, BOS_TOKEN = 258, EOS_TOKEN = 259;
+
+    std::vector<int64_t> operator()(const std::string& text, bool add_special_tokens) const {
+        std::vector<int64_t> ids;
+        if (add_special_tokens)
+            ids = prefix;
+        if (add_dummy_prefix)
+            ids.push_back(DUMMY_PREFIX_TOKEN);
+        for (size_t i = 0; i < text.size(); ++i) {
+            if (merge_ab && text.compare(i, 2, "ab") == 0) {
+                ids.push_back(AB_TOKEN);
+                ++i;
+            } else {
+                ids.push_back(static_cast<uint8_t>(text[i]));
+            }
+        }
+        if (add_special_tokens)
+            ids.insert(ids.end(), suffix.begin(), suffix.end());
+        return ids;
+    }
+};
+
+std::optional<std::vector<int64_t>> encode(const ByteTokenizer& tokenizer, const std::vector<std::string>& segments, bool add_special_tokens) {
+    return encode_segments(segments, add_special_tokens, std::cref(tokenizer));
+}
+
+const std::vector<std::string> SEGMENTS{"system prompt\n", "few-shot examples\n", "question"};
+
+}  // namespace
+
+TEST(SegmentEncoder, concatenates_tokens_of_segments) {
+    ByteTokenizer tokenizer;
+    auto input_ids = encode(tokenizer, SEGMENTS, true);
+    ASSERT_TRUE(input_ids.has_value());
+    EXPECT_EQ(*input_ids, tokenizer("system prompt\nfew-shot examples\nquestion", true));
+}
+
+TEST(SegmentEncoder, adds_special_tokens_around_whole_sequence) {
+    ByteTokenizer tokenizer;
+    tokenizer.prefix = {ByteTokenizer::BOS_TOKEN};
+    tokenizer.suffix = {ByteTokenizer::EOS_TOKEN};
+    const std::string prompt = "system prompt\nfew-shot examples\nquestion";
+
+    auto input_ids = encode(tokenizer, SEGMENTS, true);
+    ASSERT_TRUE(input_ids.has_value());
+    EXPECT_EQ(*input_ids, tokenizer(prompt, true));
+    EXPECT_EQ(input_ids->front(), ByteTokenizer::BOS_TOKEN);
+    EXPECT_EQ(input_ids->back(), ByteTokenizer::EOS_TOKEN);
+    EXPECT_EQ(std::count(input_ids->begin(), input_ids->end(), ByteTokenizer::EOS_TOKEN), 1);
+
+    // suffix only
+    tokenizer.prefix.clear();
+    input_ids = encode(tokenizer, SEGMENTS, true);
+    ASSERT_TRUE(input_ids.has_value());
+    EXPECT_EQ(*input_ids, tokenizer(prompt, true));
+
+    input_ids = encode(tokenizer, SEGMENTS, false);
+    ASSERT_TRUE(input_ids.has_value());
+    EXPECT_EQ(*input_ids, tokenizer(prompt, false));
+}
+
+TEST(SegmentEncoder, rejects_segments_if_tokens_merge_across_boundary) {
+    ByteTokenizer tokenizer;
+    tokenizer.merge_ab = true;
+    EXPECT_FALSE(encode(tokenizer, {"prompt a", "b"}, false).has_value());
+    EXPECT_TRUE(encode(tokenizer, {"prompt a", "c"}, false).has_value());
+}
+
+TEST(SegmentEncoder, rejects_segments_if_tokenizer_adds_dummy_prefix) {
+    ByteTokenizer tokenizer;
+    tokenizer.add_dummy_prefix = true;
+    EXPECT_FALSE(encode(tokenizer, SEGMENTS, false).has_value());
+}
+
+TEST(SegmentEncoder, rejects_empty_first_segment_with_special_tokens) {
+    ByteTokenizer tokenizer;
+    tokenizer.suffix = {ByteTokenizer::EOS_TOKEN};
+    // special tokens of an empty text can't be split into prefix and suffix
+    EXPECT_FALSE(encode(tokenizer, {"", "question"}, true).has_value());
+    auto input_ids = encode(tokenizer, {"", "question"}, false);
+    ASSERT_TRUE(input_ids.has_value());
+    EXPECT_EQ(*input_ids, tokenizer("question", false));
+}
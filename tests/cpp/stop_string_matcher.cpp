@@ -0,0 +1,90 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <map>
+
+#include "stop_string_matcher.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+class TokenTexts {
+    std::map<int64_t, std::string> m_texts;
+
+public:
+    explicit TokenTexts(std::map<int64_t, std::string> texts) : m_texts(std::move(texts)) {}
+
+    StopStringMatcher::GetTokenTexts get() const {
+        return [this](const TokenIds& token_ids) {
+            std::vector<const std::string*> texts;
+            for (int64_t token_id : token_ids)
+                texts.push_back(&m_texts.at(token_id));
+            return texts;
+        };
+    }
+};
+
+}  // namespace
+
+TEST(StopStringAutomaton, finds_longest_stop_string_ending_at_each_position) {
+    StopStringAutomaton automaton({"he", "she", "his", "hers"});
+    const std::string text = "ushers";
+    std::vector<size_t> match_lengths;
+    StopStringAutomaton::State state = StopStringAutomaton::ROOT;
+    for (unsigned char byte : text) {
+        state = automaton.next(state, byte);
+        match_lengths.push_back(automaton.get_match_length(state));
+    }
+    EXPECT_EQ(match_lengths, std::vector<size_t>({0, 0, 0, 3, 0, 4}));
+}
+
+TEST(StopStringMatcher, matches_stop_string_split_between_tokens) {
+    TokenTexts token_texts({{1, "Hello"}, {2, " wor"}, {3, "ld"}, {4, "!"}, {5, " STO"}, {6, "P"}});
+    StopStringMatcher matcher({"STOP"});
+
+    TokenIds generated_tokens = {1, 2};
+    EXPECT_FALSE(matcher.match(0, generated_tokens, token_texts.get(), false).is_matched);
+    generated_tokens.insert(generated_tokens.end(), {3, 4, 5});
+    EXPECT_FALSE(matcher.match(0, generated_tokens, token_texts.get(), false).is_matched);
+    generated_tokens.push_back(6);
+
+    auto result = matcher.match(0, generated_tokens, token_texts.get(), false);
+    EXPECT_TRUE(result.is_matched);
+    // " STO" and "P" are removed as they contain only stop string and a space
+    EXPECT_EQ(result.to_remove, 2);
+}
+
+TEST(StopStringMatcher, keeps_tokens_of_stop_string_included_to_output) {
+    TokenTexts token_texts({{1, "a"}, {2, "bc"}, {3, "de"}, {4, "f"}});
+    StopStringMatcher matcher({"cd"});
+
+    auto result = matcher.match(0, {1, 2, 3, 4}, token_texts.get(), true);
+    EXPECT_TRUE(result.is_matched);
+    EXPECT_EQ(result.to_remove, 1);
+
+    result = matcher.match(1, {1, 2, 3, 4}, token_texts.get(), false);
+    EXPECT_TRUE(result.is_matched);
+    // "bc" has to be kept as it contains "b" which is not a part of stop string
+    EXPECT_EQ(result.to_remove, 2);
+}
+
+TEST(StopStringMatcher, resumes_matching_after_tokens_are_replaced) {
+    TokenTexts token_texts({{1, "x"}, {2, "ST"}, {3, "OP"}, {4, "y"}});
+    StopStringMatcher matcher({"STOP"});
+
+    EXPECT_FALSE(matcher.match(0, {1, 2}, token_texts.get(), false).is_matched);
+    // "ST" is replaced, so "OP" does not complete stop string
+    EXPECT_FALSE(matcher.match(0, {1, 4, 3}, token_texts.get(), false, 2).is_matched);
+    // sequences are matched independently
+    EXPECT_FALSE(matcher.match(1, {2}, token_texts.get(), false).is_matched);
+
+    auto result = matcher.match(0, {1, 2, 3}, token_texts.get(), false, 2);
+    EXPECT_TRUE(result.is_matched);
+    EXPECT_EQ(result.to_remove, 2);
+
+    result = matcher.match(1, {2, 3}, token_texts.get(), false);
+    EXPECT_TRUE(result.is_matched);
+    EXPECT_EQ(result.to_remove, 2);
+}
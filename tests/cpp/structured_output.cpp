@@ -0,0 +1,139 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <limits>
+
+#include "structured_output.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+bool is_full_match(const ByteDFA& dfa, const std::string& text) {
+    ByteDFA::State state = ByteDFA::INITIAL;
+    for (unsigned char byte : text) {
+        state = dfa.next(state, byte);
+        if (state == ByteDFA::DEAD)
+            return false;
+    }
+    return dfa.is_accepting(state);
+}
+
+}  // namespace
+
+struct RegexTestStruct {
+    std::string regex;
+    std::vector<std::string> matched;
+    std::vector<std::string> not_matched;
+};
+
+using ByteDFATest = testing::TestWithParam<RegexTestStruct>;
+
+TEST_P(ByteDFATest, MatchesWholeText) {
+    const auto& test_struct = GetParam();
+    ByteDFA dfa(test_struct.regex);
+    for (const auto& text : test_struct.matched)
+        EXPECT_TRUE(is_full_match(dfa, text)) << test_struct.regex << " must match " << text;
+    for (const auto& text : test_struct.not_matched)
+        EXPECT_FALSE(is_full_match(dfa, text)) << test_struct.regex << " must not match " << text;
+}
+
+const std::vector<RegexTestStruct> REGEX_TEST_CASES = {
+    {"abc", {"abc"}, {"ab", "abcd", ""}},
+    {"a|bc", {"a", "bc"}, {"ab", "abc"}},
+    {"(?:ab)*c+", {"c", "ababcc"}, {"ab", "abac"}},
+    {"[a-c]{2,3}", {"ab", "cba"}, {"a", "abca", "ad"}},
+    {"x{2,}", {"xx", "xxxxx"}, {"x"}},
+    {"\\d+(\\.\\d+)?", {"12", "3.14"}, {"3.", ".5"}},
+    {"[^\"\\\\]*", {"", "abc", "\xD0\xBF\xD1\x80\xD0\xB8"}, {"a\"", "\\"}},
+    {"^\\u043f\\.$", {"\xD0\xBF."}, {"\xD0\xBF"}},
+};
+
+INSTANTIATE_TEST_SUITE_P(VariousRegexes,
+                         ByteDFATest,
+                         testing::ValuesIn(REGEX_TEST_CASES));
+
+TEST(StructuredOutputConversion, json_schema_to_regex) {
+    const std::string schema = R"({
+        "type": "object",
+        "properties": {
+            "name": {"type": "string", "maxLength": 5},
+            "age": {"type": "integer"},
+            "tags": {"type": "array", "items": {"enum": ["a", "b"]}, "maxItems": 2},
+            "address": {"$ref": "#/$defs/address"}
+        },
+        "required": ["name", "age"],
+        "$defs": {"address": {"type": ["string", "null"]}}
+    })";
+    ByteDFA dfa(json_schema_to_regex(schema));
+    EXPECT_TRUE(is_full_match(dfa, R"({"name": "Bob", "age": 42})"));
+    EXPECT_TRUE(is_full_match(dfa, R"({"name":"Bob","age":-1,"tags":["a","b"],"address":null})"));
+    EXPECT_TRUE(is_full_match(dfa, R"({"name": "Bob", "age": 0, "address": "Main st."})"));
+    EXPECT_FALSE(is_full_match(dfa, R"({"name": "Robert", "age": 42})"));
+    EXPECT_FALSE(is_full_match(dfa, R"({"age": 42, "name": "Bob"})"));
+    EXPECT_FALSE(is_full_match(dfa, R"({"name": "Bob", "age": 42, "tags": ["a", "b", "a"]})"));
+    EXPECT_FALSE(is_full_match(dfa, R"({"name": "Bob"})"));
+}
+
+TEST(StructuredOutputConversion, optional_properties_are_separated_by_commas) {
+    const std::string schema = R"({"properties": {"a": {"type": "boolean"}, "b": {"type": "null"}}})";
+    ByteDFA dfa(json_schema_to_regex(schema));
+    for (const std::string text : {"{}", R"({"a": true})", R"({"b": null})", R"({"a": false, "b": null})"})
+        EXPECT_TRUE(is_full_match(dfa, text)) << text;
+    for (const std::string text : {R"({, "b": null})", R"({"a": true,})", R"({"a": true "b": null})"})
+        EXPECT_FALSE(is_full_match(dfa, text)) << text;
+}
+
+TEST(StructuredOutputConversion, recursive_json_schema_is_not_supported) {
+    const std::string schema = R"({"type": "object", "properties": {"child": {"$ref": "#"}}})";
+    EXPECT_THROW(json_schema_to_regex(schema), ov::Exception);
+}
+
+TEST(StructuredOutputConversion, malformed_descriptions_are_rejected) {
+    EXPECT_THROW(json_schema_to_regex(R"({"type": "object")"), ov::Exception);
+    EXPECT_THROW(ByteDFA("a(b"), ov::Exception);
+    EXPECT_THROW(ByteDFA("a[b"), ov::Exception);
+}
+
+TEST(StructuredOutputConversion, grammar_to_regex) {
+    const std::string grammar = R"(
+        root ::= greeting " " name ("!" | ".")   # comment
+        greeting ::= "Hello" | "Hi"
+        name ::= [A-Z] [a-z]*
+    )";
+    ByteDFA dfa(grammar_to_regex(grammar));
+    EXPECT_TRUE(is_full_match(dfa, "Hello World!"));
+    EXPECT_TRUE(is_full_match(dfa, "Hi Bob."));
+    EXPECT_FALSE(is_full_match(dfa, "Hey Bob."));
+    EXPECT_FALSE(is_full_match(dfa, "Hi bob!"));
+
+    EXPECT_THROW(grammar_to_regex("root ::= \"a\" root?"), ov::Exception);
+}
+
+TEST(StructuredOutputTransform, masks_tokens_not_continuing_output) {
+    // token texts: 0 - "<eos>" (empty text as special token), 1 - "{", 2 - "}", 3 - "a", 4 - "ab", 5 - "b}", 6 - "{a"
+    auto vocabulary = std::make_shared<TokenVocabulary>(std::vector<std::string>{"", "{", "}", "a", "ab", "b}", "{a"});
+    auto automaton = std::make_shared<TokenAutomaton>(vocabulary, "\\{a*b?\\}");
+    StructuredOutputTransform transform(automaton, {0});
+    const float min_value = -std::numeric_limits<float>::infinity();
+
+    auto get_allowed_tokens = [&](const std::vector<int64_t>& generated_tokens) {
+        std::vector<float> logits_data(8, 1.0f);
+        Logits logits(logits_data.data(), logits_data.size());
+        transform.apply(logits, 0, generated_tokens, generated_tokens.size());
+        std::vector<int64_t> allowed_tokens;
+        for (size_t i = 0; i < logits_data.size(); ++i) {
+            if (logits_data[i] != min_value)
+                allowed_tokens.push_back(i);
+        }
+        return allowed_tokens;
+    };
+
+    EXPECT_EQ(get_allowed_tokens({}), std::vector<int64_t>({1, 6}));
+    EXPECT_EQ(get_allowed_tokens({6}), std::vector<int64_t>({2, 3, 4, 5}));
+    EXPECT_EQ(get_allowed_tokens({6, 4}), std::vector<int64_t>({2}));
+    EXPECT_EQ(get_allowed_tokens({6, 4, 2}), std::vector<int64_t>({0}));
+    // sequence is rolled back to the replaced token
+    EXPECT_EQ(get_allowed_tokens({1}), std::vector<int64_t>({2, 3, 4, 5}));
+}
@@ -0,0 +1,188 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <numeric>
+
+#include "openvino/genai/text_streamer.hpp"
+#include "vocabulary_table.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+// TextStreamer which decodes tokens with a function instead of detokenizer model and records printed texts
+class TestTextStreamer : public TextStreamer {
+public:
+    using DecodeFunction = std::function<std::string(const std::vector<int64_t>&)>;
+
+    TestTextStreamer(DecodeFunction decode_function, size_t delay_n_tokens) :
+        TextStreamer([this](std::string text) { printed.push_back(std::move(text)); return StreamingStatus::RUNNING; }, delay_n_tokens),
+        m_decode_function(std::move(decode_function)) {}
+
+    void write_all(const std::vector<int64_t>& tokens) {
+        for (int64_t token : tokens)
+            EXPECT_EQ(write(token), StreamingStatus::RUNNING);
+    }
+
+    std::vector<std::string> printed;
+
+protected:
+    std::string decode(const std::vector<int64_t>& tokens) override {
+        return m_decode_function(tokens);
+    }
+
+private:
+    DecodeFunction m_decode_function;
+};
+
+// decodes tokens as concatenation of token texts, incomplete UTF-8 symbols are kept as raw bytes
+TestTextStreamer::DecodeFunction concatenate(const std::vector<std::string>& token_texts) {
+    return [token_texts](const std::vector<int64_t>& tokens) {
+        std::string text;
+        for (int64_t token : tokens)
+            text += token_texts.at(token);
+        return text;
+    };
+}
+
+TestTextStreamer::DecodeFunction decode_with_table(std::shared_ptr<VocabularyTable> table) {
+    return [table](const std::vector<int64_t>& tokens) {
+        return table->decode(tokens.data(), tokens.size(), true);
+    };
+}
+
+}  // namespace
+
+TEST(TextStreamer, waits_for_utf8_symbol_replaced_with_replacement_character) {
+    VocabularyTable::DecoderOptions options;
+    options.is_byte_level = true;
+    options.validate_utf8 = true;
+    options.replace_invalid_utf8 = true;
+    // "Ã" and "©" encode bytes of "é", incomplete symbol is decoded as U+FFFD
+    auto table = std::make_shared<VocabularyTable>(std::vector<std::string>{"Hello", "Ġworld", "Ã", "©"}, std::vector<int64_t>{}, options);
+    TestTextStreamer streamer(decode_with_table(table), 0);
+
+    streamer.write_all({0, 1, 2});
+    EXPECT_EQ(streamer.printed, std::vector<std::string>({"Hello", " world"}));
+    streamer.write_all({3});
+    streamer.end();
+    EXPECT_EQ(streamer.printed, std::vector<std::string>({"Hello", " world", "\xC3\xA9"}));
+}
+
+TEST(TextStreamer, waits_for_utf8_symbol_decoded_as_raw_bytes) {
+    // "п" and "€" are split into single bytes
+    TestTextStreamer streamer(concatenate({"a", "\xD0", "\xBF", "\xE2", "\x82", "\xAC"}), 0);
+
+    streamer.write_all({0, 1});
+    EXPECT_EQ(streamer.printed, std::vector<std::string>({"a"}));
+    streamer.write_all({2, 3, 4});
+    EXPECT_EQ(streamer.printed, std::vector<std::string>({"a", "\xD0\xBF"}));
+    streamer.write_all({5});
+    streamer.end();
+    EXPECT_EQ(streamer.printed, std::vector<std::string>({"a", "\xD0\xBF", "\xE2\x82\xAC"}));
+}
+
+TEST(TextStreamer, prints_every_token_without_delay) {
+    TestTextStreamer streamer(concatenate({"Hello", " world", "!\n", " Bye"}), 0);
+
+    streamer.write_all({0, 1, 2, 3});
+    EXPECT_EQ(streamer.printed, std::vector<std::string>({"Hello", " world", "!\n", " Bye"}));
+    streamer.end();
+    EXPECT_EQ(streamer.printed.size(), 4);
+}
+
+TEST(TextStreamer, delays_last_tokens_until_new_line) {
+    TestTextStreamer streamer(concatenate({"a", "b", "c", "d", "e", "\n", "f"}), 3);
+
+    streamer.write_all({0, 1, 2});
+    EXPECT_TRUE(streamer.printed.empty());
+    streamer.write_all({3, 4});
+    EXPECT_EQ(streamer.printed, std::vector<std::string>({"a", "b"}));
+    // new line flushes delayed tokens
+    streamer.write_all({5});
+    EXPECT_EQ(streamer.printed, std::vector<std::string>({"a", "b", "cde\n"}));
+    streamer.write_all({6});
+    EXPECT_EQ(streamer.printed.size(), 3);
+    streamer.end();
+    EXPECT_EQ(streamer.printed, std::vector<std::string>({"a", "b", "cde\n", "f"}));
+}
+
+TEST(TextStreamer, does_not_print_when_text_shrinks) {
+    // detokenizer post-processing removes a space before a dot
+    auto concatenated = concatenate({"Hi", " ", ".", " there"});
+    auto decode = [concatenated](const std::vector<int64_t>& tokens) {
+        std::string text = concatenated(tokens);
+        for (size_t pos = text.find(" ."); pos != std::string::npos; pos = text.find(" ."))
+            text.erase(pos, 1);
+        return text;
+    };
+
+    TestTextStreamer streamer(decode, 0);
+    streamer.write_all({0, 1, 2});
+    // " ." is shorter than printed " ", so nothing is printed
+    EXPECT_EQ(streamer.printed, std::vector<std::string>({"Hi", " "}));
+    streamer.write_all({3});
+    EXPECT_EQ(streamer.printed, std::vector<std::string>({"Hi", " ", " there"}));
+
+    // delay keeps the last tokens until post-processing of their text is final
+    TestTextStreamer delayed_streamer(decode, 3);
+    delayed_streamer.write_all({0, 1, 2, 3});
+    delayed_streamer.end();
+    std::string text;
+    for (const std::string& printed : delayed_streamer.printed)
+        text += printed;
+    EXPECT_EQ(text, "Hi. there");
+}
+
+TEST(TextStreamer, keeps_sentencepiece_leading_space_when_window_moves) {
+    VocabularyTable::DecoderOptions options;
+    options.replace_metaspace = true;
+    options.strip_leading_space = true;
+    // leading space of decoded text is stripped, so a separately decoded "▁world" would lose its space
+    auto table = std::make_shared<VocabularyTable>(
+        std::vector<std::string>{"<s>", "\xE2\x96\x81Hello", "\xE2\x96\x81world", "\xE2\x96\x81" "again", "!"}, std::vector<int64_t>{0}, options);
+    TestTextStreamer streamer(decode_with_table(table), 0);
+
+    streamer.write_all({1, 2, 3, 4});
+    streamer.end();
+    EXPECT_EQ(streamer.printed, std::vector<std::string>({"Hello", " world", " again", "!"}));
+
+    // long text, so that the window is moved several times
+    std::vector<int64_t> tokens;
+    for (size_t i = 0; i < 50; ++i)
+        tokens.push_back(i % 5 == 4 ? 4 : 1 + i % 3);
+    TestTextStreamer long_streamer(decode_with_table(table), 0);
+    long_streamer.write_all(tokens);
+    long_streamer.end();
+    std::string text;
+    for (const std::string& printed : long_streamer.printed)
+        text += printed;
+    EXPECT_EQ(text, table->decode(tokens.data(), tokens.size(), true));
+}
+
+TEST(TextStreamer, decodes_window_once_per_token) {
+    std::vector<std::string> token_texts;
+    for (size_t i = 0; i < 100; ++i)
+        token_texts.push_back(" w" + std::to_string(i));
+    auto concatenated = concatenate(token_texts);
+
+    for (size_t delay_n_tokens : {0, 3}) {
+        size_t num_decodes = 0;
+        TestTextStreamer streamer([&](const std::vector<int64_t>& tokens) {
+            ++num_decodes;
+            return concatenated(tokens);
+        }, delay_n_tokens);
+        std::vector<int64_t> tokens(token_texts.size());
+        std::iota(tokens.begin(), tokens.end(), 0);
+        streamer.write_all(tokens);
+        streamer.end();
+
+        std::string text;
+        for (const std::string& printed : streamer.printed)
+            text += printed;
+        EXPECT_EQ(text, concatenated(tokens));
+        // the window is decoded once more only when it's moved, once per several tokens
+        EXPECT_LE(num_decodes, tokens.size() + tokens.size() / 4) << delay_n_tokens << " delayed tokens";
+    }
+}
@@ -0,0 +1,125 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <future>
+#include <optional>
+
+#include "openvino/genai/tokenizer.hpp"
+#include "helper.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+std::vector<int64_t> to_vector(const ov::Tensor& tensor) {
+    return std::vector<int64_t>(tensor.data<int64_t>(), tensor.data<int64_t>() + tensor.get_size());
+}
+
+// model files are read into memory, so that models are read by Tokenizer without compile properties
+struct ModelInMemory {
+    std::string xml;
+    ov::Tensor weights;
+
+    explicit ModelInMemory(const std::filesystem::path& xml_path) {
+        std::ifstream xml_file(xml_path, std::ios::binary);
+        xml.assign(std::istreambuf_iterator<char>(xml_file), std::istreambuf_iterator<char>());
+        std::filesystem::path bin_path = xml_path;
+        bin_path.replace_extension(".bin");
+        weights = ov::Tensor(ov::element::u8, {std::filesystem::file_size(bin_path)});
+        std::ifstream bin_file(bin_path, std::ios::binary);
+        bin_file.read(reinterpret_cast<char*>(weights.data()), weights.get_byte_size());
+    }
+};
+
+const std::vector<std::string> PROMPTS{"Why is the Sun yellow?", "1+1=", "Multiline\nstring!", "若我有一亿美元"};
+
+}  // namespace
+
+TEST(Tokenizer, concurrent_encode_async_calls_use_their_own_special_tokens_mode) {
+    const std::filesystem::path model_dir = get_test_model_dir();
+    if (model_dir.empty())
+        GTEST_SKIP() << "Test model is not found";
+
+    // fewer infer requests than concurrent calls, so the same infer request is switched between modes
+    Tokenizer tokenizer(model_dir, ov::genai::num_tokenizer_infer_requests(2));
+    std::vector<std::vector<int64_t>> expected[2];
+    for (bool add_special_tokens_flag : {false, true}) {
+        for (const std::string& prompt : PROMPTS)
+            expected[add_special_tokens_flag].push_back(to_vector(tokenizer.encode(prompt, ov::genai::add_special_tokens(add_special_tokens_flag)).input_ids));
+    }
+    ASSERT_NE(expected[false], expected[true]);
+
+    std::vector<std::future<TokenizedInputs>> results;
+    for (size_t i = 0; i < 64; ++i) {
+        const bool add_special_tokens_flag = i % 3 == 0;
+        results.push_back(tokenizer.encode_async(PROMPTS[i % PROMPTS.size()], {ov::genai::add_special_tokens(add_special_tokens_flag)}));
+    }
+    for (size_t i = 0; i < results.size(); ++i) {
+        const bool add_special_tokens_flag = i % 3 == 0;
+        EXPECT_EQ(to_vector(results[i].get().input_ids), expected[add_special_tokens_flag][i % PROMPTS.size()]) << "call " << i;
+    }
+
+    std::vector<std::future<std::string>> decoded;
+    for (size_t i = 0; i < 16; ++i)
+        decoded.push_back(tokenizer.decode_async(expected[false][i % PROMPTS.size()], {ov::genai::skip_special_tokens(true)}));
+    for (size_t i = 0; i < decoded.size(); ++i)
+        EXPECT_EQ(decoded[i].get(), tokenizer.decode(expected[false][i % PROMPTS.size()], ov::genai::skip_special_tokens(true)));
+}
+
+TEST(Tokenizer, num_tokenizer_infer_requests_property_is_honoured) {
+    const std::filesystem::path model_dir = get_test_model_dir();
+    if (model_dir.empty())
+        GTEST_SKIP() << "Test model is not found";
+
+    // the property is consumed by tokenizer, passing it to a device plugin would fail compilation
+    Tokenizer default_tokenizer(model_dir);
+    const std::vector<int64_t> expected = to_vector(default_tokenizer.encode(PROMPTS.front()).input_ids);
+    for (size_t num_infer_requests : {1, 3}) {
+        Tokenizer tokenizer(model_dir, ov::genai::num_tokenizer_infer_requests(num_infer_requests));
+        // with a single infer request concurrent calls wait for each other
+        std::vector<std::future<TokenizedInputs>> results;
+        for (size_t i = 0; i < 8; ++i)
+            results.push_back(tokenizer.encode_async(PROMPTS.front()));
+        for (auto& result : results)
+            EXPECT_EQ(to_vector(result.get().input_ids), expected) << num_infer_requests << " infer requests";
+    }
+
+    EXPECT_THROW(Tokenizer tokenizer(model_dir, ov::genai::num_tokenizer_infer_requests(0)), ov::Exception);
+}
+
+TEST(Tokenizer, compilation_error_is_thrown_on_first_use) {
+    const std::filesystem::path model_dir = get_test_model_dir();
+    if (model_dir.empty())
+        GTEST_SKIP() << "Test model is not found";
+
+    ModelInMemory tokenizer_model(model_dir / "openvino_tokenizer.xml");
+    ModelInMemory detokenizer_model(model_dir / "openvino_detokenizer.xml");
+    // models are read successfully, but the device rejects the property when they are compiled in background
+    std::optional<Tokenizer> tokenizer;
+    ASSERT_NO_THROW(tokenizer.emplace(tokenizer_model.xml, tokenizer_model.weights, detokenizer_model.xml, detokenizer_model.weights,
+                                      ov::AnyMap{{"UNSUPPORTED_TOKENIZER_TEST_PROPERTY", true}}));
+    // ids of special tokens don't require compiled models
+    EXPECT_NO_THROW(tokenizer->get_eos_token_id());
+    EXPECT_THROW(tokenizer->encode(PROMPTS.front()), ov::Exception);
+    EXPECT_THROW(tokenizer->decode(std::vector<int64_t>{1, 2, 3}), ov::Exception);
+    // the error is kept for subsequent calls
+    EXPECT_THROW(tokenizer->encode(PROMPTS.front()), ov::Exception);
+}
+
+TEST(Tokenizer, special_tokens_wait_for_compilation) {
+    const std::filesystem::path model_dir = get_test_model_dir();
+    if (model_dir.empty())
+        GTEST_SKIP() << "Test model is not found";
+
+    // without tokenizer config files eos token is decoded by detokenizer once it's compiled
+    ModelInMemory tokenizer_model(model_dir / "openvino_tokenizer.xml");
+    ModelInMemory detokenizer_model(model_dir / "openvino_detokenizer.xml");
+    Tokenizer tokenizer(tokenizer_model.xml, tokenizer_model.weights, detokenizer_model.xml, detokenizer_model.weights);
+    const std::string eos_token = tokenizer.get_eos_token();
+
+    ASSERT_NE(tokenizer.get_eos_token_id(), -1);
+    EXPECT_FALSE(eos_token.empty());
+    EXPECT_EQ(eos_token, tokenizer.decode(std::vector<int64_t>{tokenizer.get_eos_token_id()}, ov::genai::skip_special_tokens(false)));
+}
@@ -0,0 +1,104 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <numeric>
+#include <random>
+
+#include "openvino/runtime/core.hpp"
+#include "vocabulary_table.hpp"
+#include "tokenizers_path.hpp"
+#include "helper.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+std::string decode(const VocabularyTable& table, const std::vector<int64_t>& token_ids, bool skip_special_tokens = true) {
+    EXPECT_TRUE(table.can_decode(token_ids.data(), token_ids.size()));
+    return table.decode(token_ids.data(), token_ids.size(), skip_special_tokens);
+}
+
+}  // namespace
+
+TEST(VocabularyTable, decodes_byte_level_tokens) {
+    VocabularyTable::DecoderOptions options;
+    options.is_byte_level = true;
+    options.validate_utf8 = true;
+    options.replace_invalid_utf8 = true;
+    // "Ġ" encodes space, "Ã" and "©" encode bytes of "é", "<|endoftext|>" is a special token
+    VocabularyTable table({"Hello", "Ġworld", "Ã", "©", "<|endoftext|>"}, {4}, options);
+
+    EXPECT_EQ(table.get_token_bytes()[1], " world");
+    EXPECT_EQ(decode(table, {0, 1, 4}), "Hello world");
+    EXPECT_EQ(decode(table, {0, 1, 4}, false), "Hello world<|endoftext|>");
+    EXPECT_EQ(decode(table, {1, 2, 3}), " world\xC3\xA9");
+    // incomplete UTF-8 symbol is replaced with U+FFFD
+    EXPECT_EQ(decode(table, {1, 2}), " world\xEF\xBF\xBD");
+}
+
+TEST(VocabularyTable, decodes_sentencepiece_tokens) {
+    VocabularyTable::DecoderOptions options;
+    options.replace_metaspace = true;
+    options.byte_fallback = true;
+    options.strip_leading_space = true;
+    VocabularyTable table({"<s>", "\xE2\x96\x81Hello", "\xE2\x96\x81world", "<0x0A>", "<0xD0>", "<0xBF>"}, {0}, options);
+
+    EXPECT_EQ(table.get_token_bytes()[1], " Hello");
+    EXPECT_EQ(decode(table, {0, 1, 2, 3}), "Hello world\n");
+    EXPECT_EQ(decode(table, {0, 1}, false), "<s> Hello");
+    EXPECT_EQ(decode(table, {4, 5}), "\xD0\xBF");
+}
+
+TEST(VocabularyTable, handles_invalid_utf8_and_unknown_tokens) {
+    VocabularyTable::DecoderOptions options;
+    options.validate_utf8 = true;
+    VocabularyTable table({"a", "\xE2\x96", "\xFF"}, {}, options);
+
+    EXPECT_EQ(decode(table, {0, 1, 0, 2}), "aa");
+    // without UTF8Validate operation detokenizer keeps invalid bytes
+    VocabularyTable not_validating_table({"a", "\xE2\x96", "\xFF"}, {}, VocabularyTable::DecoderOptions{});
+    EXPECT_EQ(decode(not_validating_table, {0, 1, 0, 2}), "a\xE2\x96" "a\xFF");
+    std::vector<int64_t> out_of_vocab = {0, 3};
+    EXPECT_FALSE(table.can_decode(out_of_vocab.data(), out_of_vocab.size()));
+    out_of_vocab = {-1};
+    EXPECT_FALSE(table.can_decode(out_of_vocab.data(), out_of_vocab.size()));
+}
+
+TEST(VocabularyTable, decodes_tokens_as_detokenizer_model) {
+    const std::filesystem::path model_dir = get_test_model_dir();
+    if (model_dir.empty())
+        GTEST_SKIP() << "Test model is not found";
+
+    ScopedVar env_manager(tokenizers_relative_to_genai());
+    ov::Core core;
+    core.add_extension(getenv(ScopedVar::ENVIRONMENT_VARIABLE_NAME));
+    std::shared_ptr<ov::Model> detokenizer = core.read_model(model_dir / "openvino_detokenizer.xml");
+    std::shared_ptr<VocabularyTable> table = VocabularyTable::from_detokenizer(detokenizer);
+    ASSERT_TRUE(table);
+    ov::InferRequest infer_request = core.compile_model(detokenizer, "CPU").create_infer_request();
+
+    auto check_decode = [&](std::vector<int64_t> token_ids) {
+        infer_request.set_input_tensor(ov::Tensor(ov::element::i64, {1, token_ids.size()}, token_ids.data()));
+        infer_request.infer();
+        // detokenizer model skips special tokens by default
+        EXPECT_EQ(decode(*table, token_ids), infer_request.get_output_tensor().data<std::string>()[0]) << "tokens from " << token_ids.front();
+    };
+
+    // consecutive tokens cover special tokens and byte tokens forming invalid UTF-8 sequences
+    constexpr size_t num_tokens = 8;
+    for (size_t first_token = 0; first_token + num_tokens <= table->size(); first_token += num_tokens) {
+        std::vector<int64_t> token_ids(num_tokens);
+        std::iota(token_ids.begin(), token_ids.end(), first_token);
+        check_decode(token_ids);
+    }
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int64_t> token_distribution(0, table->size() - 1);
+    for (size_t sequence = 0; sequence < 200; ++sequence) {
+        std::vector<int64_t> token_ids(1 + sequence % 16);
+        for (int64_t& token_id : token_ids)
+            token_id = token_distribution(generator);
+        check_decode(token_ids);
+    }
+}
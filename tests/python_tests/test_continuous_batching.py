@@ -4,12 +4,14 @@
 import os
 import pytest
 import math
+import numpy as np
+import openvino as ov
 
 from pathlib import Path
 from shutil import rmtree
 from typing import Dict
 
-from openvino_genai import ContinuousBatchingPipeline, LLMPipeline, GenerationConfig, SchedulerConfig,  draft_model
+from openvino_genai import ContinuousBatchingPipeline, LLMPipeline, GenerationConfig, GenerationStatus, SchedulerConfig,  draft_model
 
 from common import generate_and_compare_with_reference_text, run_cb_pipeline_with_ref
 from test_sampling import RandomSamplingTestStruct, get_current_platform_ref_texts
@@ -408,3 +410,139 @@ def test_pipelines_generate_with_streaming_empty_output(tmp_path, pipeline_type)
     rmtree(models_path)
 
     assert it_cnt == 0
+
+#
+# Prefill / decode disaggregation
+#
+
+def get_disaggregated_properties():
+    return {**get_default_llm_properties(), "decode_device": "CPU"}
+
+@pytest.mark.parametrize("generation_config", [get_greedy(), get_beam_search()], ids=["greedy", "beam_search"])
+@pytest.mark.precommit
+def test_disaggregated_vs_continuous_batching(tmp_path, generation_config):
+    model_id : str = "facebook/opt-125m"
+    _, _, models_path = download_and_convert_model(model_id, tmp_path)
+
+    prompts = ['table is made', 'They sky is blue because', 'Difference between Jupiter and Mars is that', 'hello']
+    generation_configs = [generation_config] * len(prompts)
+
+    cb_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.CONTINIOUS_BATCHING)
+    ref_results = cb_pipe.generate(prompts, generation_configs)
+    del cb_pipe
+
+    disaggregated_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.CONTINIOUS_BATCHING, ov_config=get_disaggregated_properties())
+    # the second call checks that the pipeline is reusable after all requests were transferred from prefill instance
+    for _ in range(2):
+        results = disaggregated_pipe.generate(prompts, generation_configs)
+        assert len(results) == len(ref_results)
+        for result, ref_result in zip(results, ref_results):
+            assert result.m_status == ref_result.m_status
+            assert result.m_generation_ids == ref_result.m_generation_ids
+
+
+@pytest.mark.precommit
+def test_disaggregated_streaming(tmp_path):
+    model_id : str = "facebook/opt-125m"
+    _, _, models_path = download_and_convert_model(model_id, tmp_path)
+
+    generation_config = get_greedy()
+    disaggregated_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.CONTINIOUS_BATCHING, ov_config=get_disaggregated_properties())
+
+    streamed_text = ""
+    def py_streamer(subword: str):
+        nonlocal streamed_text
+        streamed_text += subword
+        return False
+
+    results = disaggregated_pipe.generate(["table is made"], [generation_config], streamer=py_streamer)
+    assert streamed_text == results[0].m_generation_ids[0]
+
+
+@pytest.mark.precommit
+def test_disaggregated_skips_cancelled_requests(tmp_path):
+    model_id : str = "facebook/opt-125m"
+    _, _, models_path = download_and_convert_model(model_id, tmp_path)
+
+    generation_config = get_greedy()
+    generation_config.max_new_tokens = 10
+    disaggregated_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.CONTINIOUS_BATCHING, ov_config=get_disaggregated_properties())
+
+    cancelled_handle = disaggregated_pipe.add_request(0, "Difference between Jupiter and Mars is that", generation_config)
+    cancelled_handle.cancel()
+    handle = disaggregated_pipe.add_request(1, "table is made", generation_config)
+
+    while disaggregated_pipe.has_non_finished_requests():
+        disaggregated_pipe.step()
+
+    assert cancelled_handle.get_status() == GenerationStatus.CANCEL
+    assert handle.get_status() == GenerationStatus.FINISHED
+    assert len(handle.read_all()[0].generated_ids) > 0
+    # the cancelled request is released by the decode instance without being generated
+    assert disaggregated_pipe.get_metrics().cancelled_requests == 1
+
+#
+# NumPy token ids
+#
+
+@pytest.mark.precommit
+def test_cb_numpy_token_ids(tmp_path):
+    model_id : str = "facebook/opt-125m"
+    _, _, models_path = download_and_convert_model(model_id, tmp_path)
+
+    cb_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.CONTINIOUS_BATCHING)
+    tokenizer = cb_pipe.get_tokenizer()
+    prompts_ids = [np.array(tokenizer.encode(prompt).input_ids.data) for prompt in ['table is made', 'They sky is blue because']]
+    generation_configs = [get_greedy()] * len(prompts_ids)
+
+    ref_results = cb_pipe.generate([ov.Tensor(prompt_ids) for prompt_ids in prompts_ids], generation_configs)
+    inputs_variants = [
+        prompts_ids,
+        [prompt_ids[0] for prompt_ids in prompts_ids],
+        [prompt_ids.astype(np.int32) for prompt_ids in prompts_ids],
+        [prompt_ids.tolist() for prompt_ids in prompts_ids],
+    ]
+    for input_ids in inputs_variants:
+        results = cb_pipe.generate(input_ids, generation_configs)
+        assert [result.m_generation_ids for result in results] == [result.m_generation_ids for result in ref_results]
+
+    handle = cb_pipe.add_request(0, prompts_ids[0].astype(np.int32), generation_configs[0])
+    while cb_pipe.has_non_finished_requests():
+        cb_pipe.step()
+    assert handle.read_all()[0].generated_ids == ref_results[0].m_generation_ids[0]
+
+
+@pytest.mark.precommit
+def test_cb_token_ids_views(tmp_path):
+    model_id : str = "facebook/opt-125m"
+    _, _, models_path = download_and_convert_model(model_id, tmp_path)
+
+    cb_pipe = create_ov_pipeline(models_path, pipeline_type=PipelineType.CONTINIOUS_BATCHING)
+    generation_config = get_greedy()
+    result = cb_pipe.generate([ov.Tensor(np.array([[2, 37, 8]], dtype=np.int64))], [generation_config])[0]
+    generation_ids = result.m_generation_ids
+
+    views = result.get_generation_ids_views()
+    assert [view.tolist() for view in views] == generation_ids
+    assert all(view.dtype == np.int64 and not view.flags.writeable for view in views)
+    with pytest.raises(ValueError):
+        views[0][0] = 0
+
+    # views share memory with the result, so it can't be reassigned while they exist
+    with pytest.raises(RuntimeError):
+        result.m_generation_ids = [[1, 2, 3]]
+    # views keep the result alive
+    del result
+    assert [view.tolist() for view in views] == generation_ids
+
+    handle = cb_pipe.add_request(0, np.array([2, 37, 8]), generation_config)
+    while cb_pipe.has_non_finished_requests():
+        cb_pipe.step()
+    output = handle.read_all()[0]
+    view = output.get_generated_ids_view()
+    assert view.tolist() == output.generated_ids
+    with pytest.raises(RuntimeError):
+        output.generated_ids = [1, 2, 3]
+    del view
+    output.generated_ids = [1, 2, 3]
+    assert output.generated_ids == [1, 2, 3]
@@ -102,6 +102,27 @@ def test_batch_size_switch():
     ov_pipe.generate(["a"], max_new_tokens=2)
 
 
+@pytest.mark.precommit
+@pytest.mark.nightly
+def test_numpy_inputs():
+    model_id = 'katuni4ka/tiny-random-phi3'
+    _, _, models_path = download_and_convert_model(model_id)
+    ov_pipe = create_ov_pipeline(models_path)
+
+    input_ids = np.array([[1, 4, 42]], dtype=np.int64)
+    ref_tokens = ov_pipe.generate(ov.Tensor(input_ids), max_new_tokens=5).tokens
+    # int64 array is used without copying, other integer arrays and lists are converted, 1D array is a batch of one prompt
+    for inputs in [input_ids, input_ids[0], input_ids.astype(np.int32), input_ids.tolist()]:
+        res = ov_pipe.generate(inputs, max_new_tokens=5)
+        assert res.tokens == ref_tokens
+        views = res.get_tokens_views()
+        assert [view.tolist() for view in views] == ref_tokens
+        assert all(view.dtype == np.int64 and not view.flags.writeable for view in views)
+
+    # string inputs are still decoded
+    assert isinstance(ov_pipe.generate("table is made", max_new_tokens=5), str)
+
+
 @pytest.mark.precommit
 @pytest.mark.nightly
 def test_empty_encoded_inputs_throw():